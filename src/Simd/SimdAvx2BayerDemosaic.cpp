@@ -0,0 +1,211 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i BayerLoad(const uint8_t * src)
+        {
+            return _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src));
+        }
+
+        SIMD_INLINE __m256i BayerLoad(const uint16_t * src)
+        {
+            return _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<class T> SIMD_INLINE void BayerLoadRow(const T * src, const __m256i & gains, const __m256i & max, int32_t * dst)
+        {
+            __m256i value = _mm256_mullo_epi32(BayerLoad(src), gains);
+            value = _mm256_srli_epi32(_mm256_add_epi32(value, _mm256_set1_epi32(Base::BAYER_GAIN_ROUND)), Base::BAYER_GAIN_SHIFT);
+            _mm256_storeu_si256((__m256i*)dst, _mm256_min_epi32(value, max));
+        }
+
+        template<class T> void BayerLoadRow(const T * src, size_t width, int32_t even, int32_t odd, int32_t max, int32_t * dst)
+        {
+            __m256i _gains = _mm256_setr_epi32(even, odd, even, odd, even, odd, even, odd);
+            __m256i _max = _mm256_set1_epi32(max);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                BayerLoadRow(src + x, _gains, _max, dst + x);
+            if (widthF != width)
+                BayerLoadRow(src + width - F, _gains, _max, dst + width - F);
+        }
+
+        SIMD_INLINE __m256i Load(const int32_t * src)
+        {
+            return _mm256_loadu_si256((__m256i*)src);
+        }
+
+        template<SimdBayerDemosaicType demosaic> SIMD_INLINE void BayerDemosaic(const int32_t * const * r, size_t x,
+            __m256i & c, __m256i & gx, __m256i & hn, __m256i & vn, __m256i & dg)
+        {
+            __m256i r2 = Load(r[2] + x);
+            __m256i h2 = _mm256_add_epi32(Load(r[2] + x - 1), Load(r[2] + x + 1));
+            __m256i v2 = _mm256_add_epi32(Load(r[1] + x), Load(r[3] + x));
+            __m256i d4 = _mm256_add_epi32(_mm256_add_epi32(Load(r[1] + x - 1), Load(r[1] + x + 1)), _mm256_add_epi32(Load(r[3] + x - 1), Load(r[3] + x + 1)));
+            __m256i hv2 = _mm256_slli_epi32(_mm256_add_epi32(h2, v2), 2);
+            c = _mm256_slli_epi32(r2, 4);
+            if (demosaic == SimdBayerDemosaicMhc)
+            {
+                __m256i hh = _mm256_add_epi32(Load(r[2] + x - 2), Load(r[2] + x + 2));
+                __m256i vv = _mm256_add_epi32(Load(r[0] + x), Load(r[4] + x));
+                __m256i hhvv = _mm256_add_epi32(hh, vv);
+                __m256i r2x2 = _mm256_slli_epi32(r2, 1);
+                __m256i r2x8 = _mm256_slli_epi32(r2, 3);
+                __m256i r2x10 = _mm256_add_epi32(r2x8, r2x2);
+                gx = _mm256_sub_epi32(_mm256_add_epi32(r2x8, hv2), _mm256_slli_epi32(hhvv, 1));
+                hn = _mm256_add_epi32(_mm256_sub_epi32(_mm256_add_epi32(r2x10, _mm256_slli_epi32(h2, 3)), _mm256_slli_epi32(_mm256_add_epi32(hh, d4), 1)), vv);
+                vn = _mm256_add_epi32(_mm256_sub_epi32(_mm256_add_epi32(r2x10, _mm256_slli_epi32(v2, 3)), _mm256_slli_epi32(_mm256_add_epi32(vv, d4), 1)), hh);
+                dg = _mm256_add_epi32(_mm256_add_epi32(r2x8, _mm256_slli_epi32(r2, 2)), _mm256_slli_epi32(d4, 2));
+                dg = _mm256_sub_epi32(dg, _mm256_add_epi32(_mm256_slli_epi32(hhvv, 1), hhvv));
+            }
+            else
+            {
+                __m256i dh = _mm256_abs_epi32(_mm256_sub_epi32(Load(r[2] + x - 2), Load(r[2] + x + 2)));
+                __m256i dv = _mm256_abs_epi32(_mm256_sub_epi32(Load(r[0] + x), Load(r[4] + x)));
+                hn = _mm256_slli_epi32(h2, 3);
+                vn = _mm256_slli_epi32(v2, 3);
+                dg = _mm256_slli_epi32(d4, 2);
+                gx = _mm256_blendv_epi8(hv2, vn, _mm256_cmpgt_epi32(dh, dv));
+                gx = _mm256_blendv_epi8(gx, hn, _mm256_cmpgt_epi32(dv, dh));
+            }
+        }
+
+        SIMD_INLINE void BayerOutput(__m256i value, __m256i round, __m128i shift, uint8_t * dst)
+        {
+            value = _mm256_sra_epi32(_mm256_add_epi32(value, round), shift);
+            value = _mm256_packus_epi16(_mm256_packs_epi32(value, K_ZERO), K_ZERO);
+            _mm_storel_epi64((__m128i*)dst, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4))));
+        }
+
+        template<SimdBayerDemosaicType demosaic> SIMD_INLINE void BayerDemosaic(const int32_t * const * r, size_t x, bool redRow, 
+            __m256i green, __m256i round, __m128i shift, uint8_t * b, uint8_t * g, uint8_t * rd)
+        {
+            __m256i c, gx, hn, vn, dg;
+            BayerDemosaic<demosaic>(r, x, c, gx, hn, vn, dg);
+            __m256i blue = redRow ? _mm256_blendv_epi8(dg, vn, green) : _mm256_blendv_epi8(c, hn, green);
+            __m256i red = redRow ? _mm256_blendv_epi8(c, hn, green) : _mm256_blendv_epi8(dg, vn, green);
+            BayerOutput(blue, round, shift, b + x);
+            BayerOutput(_mm256_blendv_epi8(gx, c, green), round, shift, g + x);
+            BayerOutput(red, round, shift, rd + x);
+        }
+
+        template<SimdBayerDemosaicType demosaic> void BayerDemosaicRow(const int32_t * const * r, size_t width,
+            bool redRow, bool greenEven, size_t bitDepth, uint8_t * b, uint8_t * g, uint8_t * rd)
+        {
+            __m128i shift = _mm_cvtsi32_si128(int(bitDepth) - 4);
+            __m256i round = _mm256_set1_epi32(1 << (bitDepth - 5));
+            __m256i green = _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+            if (!greenEven)
+                green = _mm256_xor_si256(green, K_INV_ZERO);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                BayerDemosaic<demosaic>(r, x, redRow, green, round, shift, b, g, rd);
+            if (widthF != width)
+                BayerDemosaic<demosaic>(r, width - F, redRow, green, round, shift, b, g, rd);
+        }
+
+        template<class T, SimdBayerDemosaicType demosaic, size_t channels> void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride,
+            SimdPixelFormatType bayerFormat, size_t bitDepth, const float * gains, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            Base::BayerRows rows(width, height, bitDepth, gains);
+            Array8u buffer(width * 4);
+            uint8_t * b = buffer.data, * g = b + width, * rd = g + width, * a = rd + width;
+            if (channels == 4)
+                memset(a, alpha, width);
+            const int32_t * r[5];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (ptrdiff_t i = 0; i < 5; ++i)
+                {
+                    size_t index = rows.Index(ptrdiff_t(row) + i - 2);
+                    bool load;
+                    int32_t * p = rows.Row(index, load);
+                    if (load)
+                    {
+                        int32_t even, odd;
+                        rows.Gains(bayerFormat, index, even, odd);
+                        BayerLoadRow((const T*)(bayer + index * bayerStride), width, even, odd, rows.Max(), p);
+                        rows.Pad(p);
+                    }
+                    r[i] = p;
+                }
+                bool redRow, greenEven;
+                Base::BayerRowType(bayerFormat, row, redRow, greenEven);
+                BayerDemosaicRow<demosaic>(r, width, redRow, greenEven, bitDepth, b, g, rd);
+                if (channels == 4)
+                    InterleaveBgra(b, width, g, width, rd, width, a, width, width, 1, dst, dstStride);
+                else
+                    InterleaveBgr(b, width, g, width, rd, width, width, 1, dst, dstStride);
+                dst += dstStride;
+            }
+        }
+
+        template<size_t channels> void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride,
+            SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A && bitDepth >= 8 && bitDepth <= 16);
+
+            if (bitDepth == 8)
+            {
+                if (demosaic == SimdBayerDemosaicMhc)
+                    BayerToBgrV2<uint8_t, SimdBayerDemosaicMhc, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+                else
+                    BayerToBgrV2<uint8_t, SimdBayerDemosaicBilinear, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+            }
+            else
+            {
+                if (demosaic == SimdBayerDemosaicMhc)
+                    BayerToBgrV2<uint16_t, SimdBayerDemosaicMhc, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+                else
+                    BayerToBgrV2<uint16_t, SimdBayerDemosaicBilinear, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+            }
+        }
+
+        void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgr, size_t bgrStride)
+        {
+            if (bitDepth == 8 && demosaic == SimdBayerDemosaicBilinear && gains == NULL)
+                BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+            else
+                BayerToBgrV2<3>(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgr, bgrStride, 0xFF);
+        }
+
+        void BayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if (bitDepth == 8 && demosaic == SimdBayerDemosaicBilinear && gains == NULL)
+                BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+            else
+                BayerToBgrV2<4>(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgra, bgraStride, alpha);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
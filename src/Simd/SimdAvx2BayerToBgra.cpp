@@ -55,7 +55,7 @@ namespace Simd
             const uint8_t * src[3];
             __m256i _src[12];
             __m256i _alpha = _mm256_set1_epi8((char)alpha);
-            size_t body = AlignHi(width - 2, A) - A;
+            size_t body = AlignHi(width - 1, A) - A;
             for (size_t row = 0; row < height; row += 2)
             {
                 src[0] = (row == 0 ? bayer : bayer - 2 * bayerStride);
@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdStream.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE   
+    namespace Avx2
+    {
+        SIMD_INLINE void CopyStream(const uint8_t * src, size_t size, uint8_t * dst)
+        {
+            size_t head = Simd::Min<size_t>((uint8_t*)AlignHi(dst, A) - dst, size);
+            size_t body = head + AlignLo(size - head, A);
+            memcpy(dst, src, head);
+            for (size_t offset = head; offset < body; offset += A)
+                Stream<true, true>((__m256i*)(dst + offset), Load<false>((__m256i*)(src + offset)));
+            memcpy(dst + body, src + body, size - body);
+        }
+
+        void Copy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
+        {
+            size_t rowSize = width * pixelSize;
+            if (!Base::NeedStream(rowSize * height))
+            {
+                Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
+                return;
+            }
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t row = begin; row < end; ++row)
+                    CopyStream(src + row * srcStride, rowSize, dst + row * dstStride);
+                _mm_sfence();
+            }, Simd::Min(Base::GetThreadNumber(), height));
+        }
+
+        void CopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+            size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride)
+        {
+            if (frameTop > frameBottom || frameBottom > height || frameLeft > frameRight || frameRight > width)
+                return;
+
+            if (frameTop > 0)
+                Copy(src, srcStride, width, frameTop, pixelSize, dst, dstStride);
+            if (frameBottom < height)
+                Copy(src + frameBottom * srcStride, srcStride, width, height - frameBottom, pixelSize,
+                    dst + frameBottom * dstStride, dstStride);
+            if (frameLeft > 0)
+                Copy(src + frameTop * srcStride, srcStride, frameLeft, frameBottom - frameTop, pixelSize,
+                    dst + frameTop * dstStride, dstStride);
+            if (frameRight < width)
+                Copy(src + frameTop * srcStride + frameRight * pixelSize, srcStride, width - frameRight, frameBottom - frameTop, pixelSize,
+                    dst + frameTop * dstStride + frameRight * pixelSize, dstStride);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
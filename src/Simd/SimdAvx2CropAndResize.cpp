@@ -0,0 +1,121 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdCropAndResize.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        CropAndResize::CropAndResize(const CropAndResizeParam & param)
+            : Base::CropAndResize(param)
+        {
+        }
+
+        void CropAndResize::VerticalRow8u(const uint8_t * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 w0 = _mm256_set1_ps(weight[0]);
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i)))), w0));
+            for (; i < size; ++i)
+                dst[i] = src[i] * weight[0];
+            for (size_t t = 1; t < taps; ++t)
+            {
+                if (weight[t] == 0.0f)
+                    continue;
+                const uint8_t * s = src + t * stride;
+                __m256 wt = _mm256_set1_ps(weight[t]);
+                for (i = 0; i < sizeF; i += F)
+                {
+                    __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(s + i))));
+                    _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(v, wt, _mm256_loadu_ps(dst + i)));
+                }
+                for (; i < size; ++i)
+                    dst[i] += s[i] * weight[t];
+            }
+        }
+
+        void CropAndResize::VerticalRow32f(const float * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 w0 = _mm256_set1_ps(weight[0]);
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(src + i), w0));
+            for (; i < size; ++i)
+                dst[i] = src[i] * weight[0];
+            for (size_t t = 1; t < taps; ++t)
+            {
+                if (weight[t] == 0.0f)
+                    continue;
+                const float * s = src + t * stride;
+                __m256 wt = _mm256_set1_ps(weight[t]);
+                for (i = 0; i < sizeF; i += F)
+                    _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_loadu_ps(s + i), wt, _mm256_loadu_ps(dst + i)));
+                for (; i < size; ++i)
+                    dst[i] += s[i] * weight[t];
+            }
+        }
+
+        void CropAndResize::HorizontalRow(const float * src, const int32_t * index, const float * weight, size_t taps, size_t size, float * dst) const
+        {
+            const float * k = _k.data, * b = _b.data;
+            size_t C = _param.channels, sizeF = AlignLo(size, F), i = 0;
+            __m256i _C = _mm256_set1_epi32((int)C);
+            for (; i < sizeF; i += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(index + i));
+                __m256 sum = _mm256_mul_ps(_mm256_i32gather_ps(src, idx, 4), _mm256_loadu_ps(weight + i));
+                for (size_t t = 1; t < taps; ++t)
+                {
+                    idx = _mm256_add_epi32(idx, _C);
+                    sum = _mm256_fmadd_ps(_mm256_i32gather_ps(src, idx, 4), _mm256_loadu_ps(weight + t * size + i), sum);
+                }
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(sum, _mm256_loadu_ps(k + i), _mm256_loadu_ps(b + i)));
+            }
+            for (; i < size; ++i)
+            {
+                const float * s = src + index[i];
+                float sum = s[0] * weight[i];
+                for (size_t t = 1; t < taps; ++t)
+                    sum += s[t * C] * weight[t * size + i];
+                dst[i] = sum * k[i] + b[i];
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * CropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+            SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType)
+        {
+            CropAndResizeParam param(srcWidth, srcHeight, channels, srcType, dstWidth, dstHeight, method, lower, upper, tensorFormat, tensorType);
+            if (!param.Valid())
+                return NULL;
+            return new CropAndResize(param);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
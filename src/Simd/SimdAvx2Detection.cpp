@@ -166,39 +166,48 @@ namespace Simd
             stageSum = _mm256_add_ps(stageSum, _mm256_blendv_ps(_mm256_broadcast_ss(leaves + 1), _mm256_broadcast_ss(leaves + 0), mask));
         }
 
-        void Detect32f(const HidHaarCascade & hid, size_t offset, const __m256 & norm, __m256i & result)
+        SIMD_INLINE __m256 StageSum32f(const HidHaarCascade & hid, const HidHaarStage & stage, size_t offset, const __m256 & norm)
         {
             typedef HidHaarCascade Hid;
-            const float * leaves = hid.leaves.data();
-            const Hid::Node * node = hid.nodes.data();
-            const Hid::Stage * stages = hid.stages.data();
-            for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
+            if (stage.canSkip)
+                return _mm256_set1_ps(stage.threshold);
+            const float * leaves = hid.leaves.data() + stage.first * 2;
+            const Hid::Node * node = hid.nodes.data() + stage.first;
+            const Hid::Node * end = node + stage.ntrees;
+            __m256 stageSum = _mm256_setzero_ps();
+            if (stage.hasThree)
             {
-                const Hid::Stage & stage = stages[i];
-                if (stage.canSkip)
-                    continue;
-                const Hid::Node * end = node + stage.ntrees;
-                __m256 stageSum = _mm256_setzero_ps();
-                if (stage.hasThree)
+                for (; node < end; ++node, leaves += 2)
                 {
-                    for (; node < end; ++node, leaves += 2)
-                    {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m256 sum = _mm256_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
-                        if (feature.rect[2].p0)
-                            sum = _mm256_add_ps(sum, WeightedSum32f(feature.rect[2], offset));
-                        StageSum32f(leaves, node->threshold, sum, norm, stageSum);
-                    }
+                    const Hid::Feature & feature = hid.features[node->featureIdx];
+                    __m256 sum = _mm256_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
+                    if (feature.rect[2].p0)
+                        sum = _mm256_add_ps(sum, WeightedSum32f(feature.rect[2], offset));
+                    StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                 }
-                else
+            }
+            else
+            {
+                for (; node < end; ++node, leaves += 2)
                 {
-                    for (; node < end; ++node, leaves += 2)
-                    {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m256 sum = _mm256_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
-                        StageSum32f(leaves, node->threshold, sum, norm, stageSum);
-                    }
+                    const Hid::Feature & feature = hid.features[node->featureIdx];
+                    __m256 sum = _mm256_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
+                    StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                 }
+            }
+            return stageSum;
+        }
+
+        void Detect32f(const HidHaarCascade & hid, size_t offset, int startStage, const __m256 & norm, __m256i & result)
+        {
+            typedef HidHaarCascade Hid;
+            const Hid::Stage * stages = hid.stages.data();
+            for (int i = startStage, n = (int)hid.stages.size(); i < n; ++i)
+            {
+                const Hid::Stage & stage = stages[i];
+                if (stage.canSkip)
+                    continue;
+                __m256 stageSum = StageSum32f(hid, stage, offset, norm);
                 result = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(_mm256_broadcast_ss(&stage.threshold), stageSum, _CMP_GT_OQ)), result);
                 int resultCount = ResultCount(result);
                 if (resultCount == 0)
@@ -244,7 +253,7 @@ namespace Simd
                     if (_mm256_testz_si256(result, K32_00000001))
                         continue;
                     __m256 norm = Norm32fp(hid, pq_offset + col);
-                    Detect32f(hid, p_offset + col, norm, result);
+                    Detect32f(hid, p_offset + col, 0, norm, result);
                     _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                 }
                 if (evenWidth > alignedWidth + 2)
@@ -254,7 +263,7 @@ namespace Simd
                     if (!_mm256_testz_si256(result, K32_00000001))
                     {
                         __m256 norm = Norm32fp(hid, pq_offset + col);
-                        Detect32f(hid, p_offset + col, norm, result);
+                        Detect32f(hid, p_offset + col, 0, norm, result);
                         _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                     }
                     col += 8;
@@ -280,6 +289,63 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        const __m256i K32_RAMP = SIMD_MM256_SETR_EPI32(0, 1, 2, 3, 4, 5, 6, 7);
+
+        struct Survivors
+        {
+        private:
+            Buffer<uint32_t> _buffer;
+        public:
+            uint32_t * index;
+            float * norm;
+            size_t count;
+
+            Survivors(size_t size)
+                : _buffer(size)
+                , index(_buffer.m)
+                , norm((float*)_buffer.d)
+                , count(0)
+            {
+            }
+        };
+
+        SIMD_INLINE void Detect32fi(const HidHaarCascade & hid, size_t p_offset, size_t pq_offset, size_t col, const __m256i & fresh,
+            Buffer<uint16_t> & buffer, Buffer<uint16_t> & skip, Survivors & survivors)
+        {
+            __m256i result = _mm256_and_si256(_mm256_andnot_si256(_mm256_loadu_si256((__m256i*)(skip.m + col)),
+                _mm256_loadu_si256((__m256i*)(buffer.m + col))), fresh);
+            __m256i strong = _mm256_setzero_si256();
+            if (!_mm256_testz_si256(result, K32_00000001))
+            {
+                __m256 norm = Norm32fi(hid, pq_offset + col);
+                __m256 sum = StageSum32f(hid, hid.stages[0], p_offset + col / 2, norm);
+                strong = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(_mm256_set1_ps(hid.skipThreshold), sum, _CMP_GT_OQ)), result);
+                result = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(_mm256_set1_ps(hid.stages[0].threshold), sum, _CMP_GT_OQ)), result);
+                int count = ResultCount(result);
+                if (count >= 2)
+                {
+                    Detect32f(hid, p_offset + col / 2, 1, norm, result);
+                    _mm256_storeu_si256((__m256i*)(buffer.d + col), _mm256_or_si256(_mm256_loadu_si256((__m256i*)(buffer.d + col)), result));
+                }
+                else if (count == 1)
+                {
+                    uint32_t SIMD_ALIGNED(32) _result[8];
+                    float SIMD_ALIGNED(32) _norm[8];
+                    _mm256_store_si256((__m256i*)_result, result);
+                    _mm256_store_ps(_norm, norm);
+                    for (size_t j = 0; j < 8; ++j)
+                    {
+                        if (_result[j])
+                        {
+                            survivors.index[survivors.count] = uint32_t(col + 2 * j);
+                            survivors.norm[survivors.count++] = _norm[j];
+                        }
+                    }
+                }
+            }
+            _mm256_storeu_si256((__m256i*)(skip.d + col), _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(skip.d + col)), strong, fresh));
+        }
+
         void DetectionHaarDetect32fi(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
         {
             const size_t step = 2;
@@ -288,6 +354,9 @@ namespace Simd
             size_t evenWidth = Simd::AlignLo(width, 2);
 
             Buffer<uint16_t> buffer(evenWidth);
+            Buffer<uint16_t> skip(width);
+            memset(skip.m, 0, width * sizeof(uint16_t));
+            Survivors survivors(width);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += step)
             {
                 size_t col = 0;
@@ -296,36 +365,34 @@ namespace Simd
 
                 UnpackMask16i(mask.data + row*mask.stride + rect.left, evenWidth, buffer.m, K16_0001);
                 memset(buffer.d, 0, evenWidth * sizeof(uint16_t));
+                survivors.count = 0;
                 for (; col < alignedWidth; col += HA)
-                {
-                    __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
-                    if (_mm256_testz_si256(result, K32_00000001))
-                        continue;
-                    __m256 norm = Norm32fi(hid, pq_offset + col);
-                    Detect32f(hid, p_offset + col / 2, norm, result);
-                    _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
-                }
+                    Detect32fi(hid, p_offset, pq_offset, col, K_INV_ZERO, buffer, skip, survivors);
                 if (evenWidth > alignedWidth)
                 {
                     col = evenWidth - HA;
-                    __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
-                    if (!_mm256_testz_si256(result, K32_00000001))
-                    {
-                        __m256 norm = Norm32fi(hid, pq_offset + col);
-                        Detect32f(hid, p_offset + col / 2, norm, result);
-                        _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
-                    }
+                    __m256i fresh = _mm256_cmpgt_epi32(K32_RAMP, _mm256_set1_epi32(int(alignedWidth - col) / 2 - 1));
+                    Detect32fi(hid, p_offset, pq_offset, col, fresh, buffer, skip, survivors);
                     col += HA;
                 }
                 for (; col < width; col += step)
                 {
-                    if (mask.At<uint8_t>(col + rect.left, row) == 0)
+                    skip.d[col] = 0;
+                    if (mask.At<uint8_t>(col + rect.left, row) == 0 || skip.m[col])
                         continue;
+                    uint8_t strong;
                     float norm = Base::Norm32f(hid, pq_offset + col);
-                    if (Base::Detect32f(hid, p_offset + col / 2, 0, norm) > 0)
+                    if (Base::Detect32f(hid, p_offset + col / 2, norm, strong) > 0)
                         dst.At<uint8_t>(col + rect.left, row) = 1;
+                    skip.d[col] = strong;
+                }
+                for (size_t i = 0; i < survivors.count; ++i)
+                {
+                    if (Base::Detect32f(hid, p_offset + survivors.index[i] / 2, 1, survivors.norm[i]) > 0)
+                        buffer.d[survivors.index[i]] = 1;
                 }
                 PackResult16i(buffer.d, evenWidth, dst.data + row*dst.stride + rect.left);
+                Swap(skip.m, skip.d);
             }
         }
 
@@ -631,29 +698,28 @@ namespace Simd
             return _mm256_andnot_si256(_mm256_cmpeq_epi16(value, _mm256_setzero_si256()), Simd::Avx2::K_INV_ZERO);
         }
 
-        void Detect(const HidLbpCascade<int, uint16_t> & hid, size_t offset, __m256i & result)
+        SIMD_INLINE __m256i StageSum(const HidLbpCascade<int, uint16_t> & hid, const HidLbpStage<int> & stage, size_t offset)
+        {
+            size_t subsetSize = (hid.ncategories + 31) / 32;
+            __m256i sum = _mm256_setzero_si256();
+            for (int node = stage.first, end = stage.first + stage.ntrees; node < end; ++node)
+            {
+                const HidLbpFeature<uint16_t> & feature = hid.features[hid.nodes[node].featureIdx];
+                __m256i mask = LeafMask(feature, offset, hid.subsets.data() + node*subsetSize);
+                sum = _mm256_add_epi16(sum, _mm256_blendv_epi8(_mm256_set1_epi16(hid.leaves[2 * node + 1]), _mm256_set1_epi16(hid.leaves[2 * node + 0]), mask));
+            }
+            return sum;
+        }
+
+        void Detect(const HidLbpCascade<int, uint16_t> & hid, size_t offset, int startStage, __m256i & result)
         {
             typedef HidLbpCascade<int, uint16_t> Hid;
 
-            size_t subsetSize = (hid.ncategories + 31) / 32;
-            const int * subsets = hid.subsets.data();
-            const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
-            int nodeOffset = 0, leafOffset = 0;
-            for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
+            for (int i_stage = startStage, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
             {
                 const Hid::Stage & stage = stages[i_stage];
-                __m256i sum = _mm256_setzero_si256();
-                for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
-                {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
-                    const int * subset = subsets + nodeOffset*subsetSize;
-                    __m256i mask = LeafMask(feature, offset, subset);
-                    sum = _mm256_add_epi16(sum, _mm256_blendv_epi8(_mm256_set1_epi16(leaves[leafOffset + 1]), _mm256_set1_epi16(leaves[leafOffset + 0]), mask));
-                    nodeOffset++;
-                    leafOffset += 2;
-                }
+                __m256i sum = StageSum(hid, stage, offset);
                 result = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(stage.threshold), sum), result);
                 int resultCount = ResultCount(result);
                 if (resultCount == 0)
@@ -693,7 +759,7 @@ namespace Simd
                     __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
                     if (_mm256_testz_si256(result, K16_0001))
                         continue;
-                    Detect(hid, offset + col, result);
+                    Detect(hid, offset + col, 0, result);
                     _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                 }
                 if (evenWidth > alignedWidth + 2)
@@ -702,7 +768,7 @@ namespace Simd
                     __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
                     if (!_mm256_testz_si256(result, K16_0001))
                     {
-                        Detect(hid, offset + col, result);
+                        Detect(hid, offset + col, 0, result);
                         _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                     }
                     col += HA;
@@ -727,6 +793,35 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        const __m256i K16_RAMP = SIMD_MM256_SETR_EPI16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+        SIMD_INLINE void Detect16ii(const HidLbpCascade<int, uint16_t> & hid, size_t offset, size_t col, const __m256i & fresh,
+            const uint8_t * m, uint8_t * d, Buffer<uint8_t> & skip, Survivors & survivors)
+        {
+            __m256i result = _mm256_and_si256(_mm256_andnot_si256(_mm256_loadu_si256((__m256i*)(skip.m + col)),
+                _mm256_loadu_si256((__m256i*)(m + col))), _mm256_and_si256(fresh, K16_0001));
+            __m256i strong = _mm256_setzero_si256();
+            if (!_mm256_testz_si256(result, K16_0001))
+            {
+                __m256i sum = StageSum(hid, hid.stages[0], offset + col / 2);
+                strong = _mm256_and_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(hid.skipThreshold), sum), result);
+                result = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(hid.stages[0].threshold), sum), result);
+                int count = ResultCount(result);
+                if (count >= 4)
+                {
+                    Detect(hid, offset + col / 2, 1, result);
+                    _mm256_storeu_si256((__m256i*)(d + col), _mm256_or_si256(_mm256_loadu_si256((__m256i*)(d + col)), result));
+                }
+                else if (count > 0)
+                {
+                    uint32_t bits = ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(result, _mm256_setzero_si256()));
+                    for (; bits; bits &= bits - 1)
+                        survivors.index[survivors.count++] = uint32_t(col + _tzcnt_u32(bits));
+                }
+            }
+            _mm256_storeu_si256((__m256i*)(skip.d + col), _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(skip.d + col)), strong, fresh));
+        }
+
         void DetectionLbpDetect16ii(const HidLbpCascade<int, uint16_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
             const size_t step = 2;
@@ -734,38 +829,39 @@ namespace Simd
             size_t alignedWidth = Simd::AlignLo(width, A);
             size_t evenWidth = Simd::AlignLo(width, 2);
 
+            Buffer<uint8_t> skip(width);
+            memset(skip.m, 0, width);
+            Survivors survivors(width);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += step)
             {
                 size_t col = 0;
                 size_t offset = row * hid.isum.stride / sizeof(uint16_t) + rect.left / 2;
                 const uint8_t * m = mask.data + row*mask.stride + rect.left;
                 uint8_t * d = dst.data + row*dst.stride + rect.left;
+                survivors.count = 0;
                 for (; col < alignedWidth; col += A)
-                {
-                    __m256i result = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(m + col)), K16_0001);
-                    if (_mm256_testz_si256(result, K16_0001))
-                        continue;
-                    Detect(hid, offset + col / 2, result);
-                    _mm256_storeu_si256((__m256i*)(d + col), result);
-                }
+                    Detect16ii(hid, offset, col, K_INV_ZERO, m, d, skip, survivors);
                 if (evenWidth > alignedWidth + 2)
                 {
                     col = evenWidth - A;
-                    __m256i result = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(m + col)), K16_0001);
-                    if (!_mm256_testz_si256(result, K16_0001))
-                    {
-                        Detect(hid, offset + col / 2, result);
-                        _mm256_storeu_si256((__m256i*)(d + col), result);
-                    }
+                    __m256i fresh = _mm256_cmpgt_epi16(K16_RAMP, _mm256_set1_epi16(int16_t(alignedWidth - col) / 2 - 1));
+                    Detect16ii(hid, offset, col, fresh, m, d, skip, survivors);
                     col += A;
                 }
                 for (; col < width; col += step)
                 {
-                    if (mask.At<uint8_t>(col + rect.left, row) == 0)
+                    skip.d[col] = 0;
+                    if (m[col] == 0 || skip.m[col])
                         continue;
-                    if (Base::Detect(hid, offset + col / 2, 0) > 0)
-                        dst.At<uint8_t>(col + rect.left, row) = 1;
+                    if (Base::Detect(hid, offset + col / 2, skip.d[col]) > 0)
+                        d[col] = 1;
+                }
+                for (size_t i = 0; i < survivors.count; ++i)
+                {
+                    if (Base::Detect(hid, offset + survivors.index[i] / 2, 1) > 0)
+                        d[survivors.index[i]] = 1;
                 }
+                Swap(skip.m, skip.d);
             }
         }
 
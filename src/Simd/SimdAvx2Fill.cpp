@@ -23,12 +23,46 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdStream.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        SIMD_INLINE void FillStream(uint8_t * dst, size_t size, __m256i value)
+        {
+            assert(size >= A);
+            size_t head = (uint8_t*)AlignHi(dst, A) - dst;
+            size_t body = head + AlignLo(size - head, A);
+            Store<false>((__m256i*)dst, value);
+            for (size_t offset = head; offset < body; offset += A)
+                Stream<true, true>((__m256i*)(dst + offset), value);
+            if (body < size)
+                Store<false>((__m256i*)(dst + size - A), value);
+        }
+
+        void FillStream(uint8_t * dst, size_t stride, size_t size, size_t height, __m256i value)
+        {
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t row = begin; row < end; ++row)
+                    FillStream(dst + row * stride, size, value);
+                _mm_sfence();
+            }, Simd::Min(Base::GetThreadNumber(), height));
+        }
+
+        void Fill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
+        {
+            size_t size = width * pixelSize;
+            if (size >= A && Base::NeedStream(size * height))
+                FillStream(dst, stride, size, height, _mm256_set1_epi8(value));
+            else
+                Base::Fill(dst, stride, width, height, pixelSize, value);
+        }
+
         template <bool align> void FillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
         {
             assert(width >= A);
@@ -96,7 +130,12 @@ namespace Simd
 
         void FillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
         {
-            if (Aligned(dst) && Aligned(stride))
+            if (Aligned(dst, 4) && Aligned(stride, 4) && Base::NeedStream(width * 4 * height))
+            {
+                uint32_t bgra32 = uint32_t(blue) | (uint32_t(green) << 8) | (uint32_t(red) << 16) | (uint32_t(alpha) << 24);
+                FillStream(dst, stride, width * 4, height, _mm256_set1_epi32(bgra32));
+            }
+            else if (Aligned(dst) && Aligned(stride))
                 FillBgra<true>(dst, stride, width, height, blue, green, red, alpha);
             else
                 FillBgra<false>(dst, stride, width, height, blue, green, red, alpha);
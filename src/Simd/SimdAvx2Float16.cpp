@@ -26,6 +26,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -457,6 +458,32 @@ namespace Simd
                 }
             }
         }
+
+        static size_t CosineSelect32f(const float * src, size_t size, float threshold, uint32_t * indices)
+        {
+            size_t sizeF = AlignLo(size, F), count = 0, i = 0;
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            for (; i < sizeF; i += F)
+            {
+                uint32_t mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + i), _threshold, _CMP_LE_OQ));
+                for (; mask; mask &= mask - 1)
+                    indices[count++] = uint32_t(i + _tzcnt_u32(mask));
+            }
+            for (; i < size; ++i)
+                if (src[i] <= threshold)
+                    indices[count++] = (uint32_t)i;
+            return count;
+        }
+
+        void SquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums)
+        {
+            Base::SquareSums16f(N, K, A, sums, Squares);
+        }
+
+        void CosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances)
+        {
+            Base::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances, Squares, MacroCosineDistances, CosineSelect32f);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdTranspose.h"
+#include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void StoreBlur(uint8_t * dst, __m256 value)
+        {
+            __m256i i32 = _mm256_cvtps_epi32(value);
+            __m128i i16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(i16, i16));
+        }
+
+        GaussianBlurFilter::GaussianBlurFilter(const BlurParam & param)
+            : Base::GaussianBlurFilter(param)
+        {
+        }
+
+        void GaussianBlurFilter::VerticalSum(const uint8_t * src, size_t srcStride, size_t row, float * dst) const
+        {
+            const BlurParam & p = _param;
+            const size_t kernel = _kernel.size, sizeF = AlignLo(_size, F);
+            const uint8_t * rows[Base::BLUR_KERNEL_MAX];
+            __m256 weights[Base::BLUR_KERNEL_MAX];
+            for (size_t k = 0; k < kernel; ++k)
+            {
+                rows[k] = src + Simd::RestrictRange<ptrdiff_t>(ptrdiff_t(row + k) - ptrdiff_t(_radius), 0, p.height - 1) * srcStride;
+                weights[k] = _mm256_set1_ps(_kernel[k]);
+            }
+            size_t x = 0;
+            if (p.typeSize == 1)
+            {
+                for (; x < sizeF; x += F)
+                {
+                    __m256 sum = _mm256_setzero_ps();
+                    for (size_t k = 0; k < kernel; ++k)
+                    {
+                        __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(rows[k] + x))));
+                        sum = _mm256_fmadd_ps(weights[k], value, sum);
+                    }
+                    _mm256_storeu_ps(dst + x, sum);
+                }
+                for (; x < _size; ++x)
+                {
+                    float sum = 0;
+                    for (size_t k = 0; k < kernel; ++k)
+                        sum += _kernel[k] * rows[k][x];
+                    dst[x] = sum;
+                }
+            }
+            else
+            {
+                for (; x < sizeF; x += F)
+                {
+                    __m256 sum = _mm256_setzero_ps();
+                    for (size_t k = 0; k < kernel; ++k)
+                        sum = _mm256_fmadd_ps(weights[k], _mm256_loadu_ps((float*)rows[k] + x), sum);
+                    _mm256_storeu_ps(dst + x, sum);
+                }
+                for (; x < _size; ++x)
+                {
+                    float sum = 0;
+                    for (size_t k = 0; k < kernel; ++k)
+                        sum += _kernel[k] * ((float*)rows[k])[x];
+                    dst[x] = sum;
+                }
+            }
+        }
+
+        void GaussianBlurFilter::HorizontalSum(const float * src, uint8_t * dst) const
+        {
+            const size_t channels = _param.channels, kernel = _kernel.size, sizeF = AlignLo(_size, F);
+            __m256 weights[Base::BLUR_KERNEL_MAX];
+            for (size_t k = 0; k < kernel; ++k)
+                weights[k] = _mm256_set1_ps(_kernel[k]);
+            size_t x = 0;
+            for (; x < sizeF; x += F)
+            {
+                __m256 sum = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernel; ++k)
+                    sum = _mm256_fmadd_ps(weights[k], _mm256_loadu_ps(src + x + k * channels), sum);
+                if (_param.typeSize == 1)
+                    StoreBlur(dst + x, sum);
+                else
+                    _mm256_storeu_ps((float*)dst + x, sum);
+            }
+            for (; x < _size; ++x)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += _kernel[k] * src[x + k * channels];
+                if (_param.typeSize == 1)
+                    dst[x] = (uint8_t)RestrictRange(Round(sum), 0, 255);
+                else
+                    ((float*)dst)[x] = sum;
+            }
+        }
+
+        void GaussianBlurFilter::RecursiveRows(const uint8_t * src, size_t srcStride, size_t begin, size_t end) const
+        {
+            const size_t channels = _param.channels, last = _size - channels, sizeF = AlignLo(_size, F);
+            const size_t last1 = last >= channels ? last - channels : last, last2 = last1 >= channels ? last1 - channels : last1;
+            const __m256 b = _mm256_set1_ps(_coefs[0]), a1 = _mm256_set1_ps(_coefs[1]), a2 = _mm256_set1_ps(_coefs[2]), a3 = _mm256_set1_ps(_coefs[3]);
+            __m256 m[9];
+            for (size_t i = 0; i < 9; ++i)
+                m[i] = _mm256_set1_ps(_border[i]);
+            Array32f buf(_size * F);
+            float * t = buf.data;
+            size_t y = begin;
+            for (; y + F <= end; y += F)
+            {
+                float * dst = _buffer.data + y * _size;
+                const float * rows = dst;
+                size_t stride = _size;
+                if (_param.typeSize == 1)
+                {
+                    for (size_t i = 0; i < F; ++i)
+                    {
+                        const uint8_t * s = src + (y + i) * srcStride;
+                        float * d = dst + i * _size;
+                        size_t x = 0;
+                        for (; x < sizeF; x += F)
+                            _mm256_storeu_ps(d + x, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(s + x)))));
+                        for (; x < _size; ++x)
+                            d[x] = s[x];
+                    }
+                }
+                else
+                {
+                    rows = (const float*)(src + y * srcStride);
+                    stride = srcStride / sizeof(float);
+                }
+                for (size_t x = 0; x < sizeF; x += F)
+                    Avx::Transpose8x8<false>(rows + x, stride, t + x * F, F);
+                for (size_t x = sizeF; x < _size; ++x)
+                    for (size_t i = 0; i < F; ++i)
+                        t[x * F + i] = rows[i * stride + x];
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m256 plus = _mm256_load_ps(t + (last + c) * F);
+                    __m256 p1 = _mm256_load_ps(t + c * F), p2 = p1, p3 = p1;
+                    for (size_t x = c; x < _size; x += channels)
+                    {
+                        __m256 w = _mm256_fmadd_ps(a1, p1, _mm256_fmadd_ps(a2, p2, _mm256_fmadd_ps(a3, p3, _mm256_mul_ps(b, _mm256_load_ps(t + x * F)))));
+                        p3 = p2, p2 = p1, p1 = w;
+                        _mm256_store_ps(t + x * F, w);
+                    }
+                    __m256 u0 = _mm256_sub_ps(_mm256_load_ps(t + (last + c) * F), plus);
+                    __m256 u1 = _mm256_sub_ps(_mm256_load_ps(t + (last1 + c) * F), plus);
+                    __m256 u2 = _mm256_sub_ps(_mm256_load_ps(t + (last2 + c) * F), plus);
+                    p1 = _mm256_fmadd_ps(m[0], u0, _mm256_fmadd_ps(m[1], u1, _mm256_fmadd_ps(m[2], u2, plus)));
+                    p2 = _mm256_fmadd_ps(m[3], u0, _mm256_fmadd_ps(m[4], u1, _mm256_fmadd_ps(m[5], u2, plus)));
+                    p3 = _mm256_fmadd_ps(m[6], u0, _mm256_fmadd_ps(m[7], u1, _mm256_fmadd_ps(m[8], u2, plus)));
+                    _mm256_store_ps(t + (last + c) * F, p1);
+                    for (ptrdiff_t x = last + c - channels; x >= 0; x -= channels)
+                    {
+                        __m256 w = _mm256_fmadd_ps(a1, p1, _mm256_fmadd_ps(a2, p2, _mm256_fmadd_ps(a3, p3, _mm256_mul_ps(b, _mm256_load_ps(t + x * F)))));
+                        p3 = p2, p2 = p1, p1 = w;
+                        _mm256_store_ps(t + x * F, w);
+                    }
+                }
+                for (size_t x = 0; x < sizeF; x += F)
+                    Avx::Transpose8x8<false>(t + x * F, F, dst + x, _size);
+                for (size_t x = sizeF; x < _size; ++x)
+                    for (size_t i = 0; i < F; ++i)
+                        dst[i * _size + x] = t[x * F + i];
+            }
+            for (; y < end; ++y)
+                RecursiveRow(src + y * srcStride, _buffer.data + y * _size);
+        }
+
+        void GaussianBlurFilter::RecursiveColumns(float * buf, size_t begin, size_t end, uint8_t * dst, size_t dstStride) const
+        {
+            const size_t height = _param.height, endF = begin + AlignLo(end - begin, F);
+            const float b = _coefs[0], a1 = _coefs[1], a2 = _coefs[2], a3 = _coefs[3];
+            const __m256 _b = _mm256_set1_ps(b), _a1 = _mm256_set1_ps(a1), _a2 = _mm256_set1_ps(a2), _a3 = _mm256_set1_ps(a3);
+            memcpy(buf + (height + 2) * _size + begin, buf + (height - 1) * _size + begin, (end - begin) * 4);
+            for (size_t y = 0; y < height; ++y)
+            {
+                float * c = buf + y * _size;
+                const float * p1 = buf + (y > 0 ? y - 1 : 0) * _size;
+                const float * p2 = buf + (y > 1 ? y - 2 : 0) * _size;
+                const float * p3 = buf + (y > 2 ? y - 3 : 0) * _size;
+                size_t x = begin;
+                for (; x < endF; x += F)
+                {
+                    __m256 sum = _mm256_mul_ps(_b, _mm256_loadu_ps(c + x));
+                    sum = _mm256_fmadd_ps(_a1, _mm256_loadu_ps(p1 + x), sum);
+                    sum = _mm256_fmadd_ps(_a2, _mm256_loadu_ps(p2 + x), sum);
+                    sum = _mm256_fmadd_ps(_a3, _mm256_loadu_ps(p3 + x), sum);
+                    _mm256_storeu_ps(c + x, sum);
+                }
+                for (; x < end; ++x)
+                    c[x] = b * c[x] + a1 * p1[x] + a2 * p2[x] + a3 * p3[x];
+            }
+            RecursiveBorder(buf, begin, end, dst, dstStride);
+            for (ptrdiff_t y = height - 2; y >= 0; --y)
+            {
+                float * c = buf + y * _size;
+                const float * n1 = c + _size, * n2 = n1 + _size, * n3 = n2 + _size;
+                uint8_t * d = dst + y * dstStride;
+                size_t x = begin;
+                for (; x < endF; x += F)
+                {
+                    __m256 sum = _mm256_mul_ps(_b, _mm256_loadu_ps(c + x));
+                    sum = _mm256_fmadd_ps(_a1, _mm256_loadu_ps(n1 + x), sum);
+                    sum = _mm256_fmadd_ps(_a2, _mm256_loadu_ps(n2 + x), sum);
+                    sum = _mm256_fmadd_ps(_a3, _mm256_loadu_ps(n3 + x), sum);
+                    _mm256_storeu_ps(c + x, sum);
+                    if (_param.typeSize == 1)
+                        StoreBlur(d + x, sum);
+                    else
+                        _mm256_storeu_ps((float*)d + x, sum);
+                }
+                for (; x < end; ++x)
+                {
+                    c[x] = b * c[x] + a1 * n1[x] + a2 * n2[x] + a3 * n3[x];
+                    if (_param.typeSize == 1)
+                        d[x] = (uint8_t)RestrictRange(Round(c[x]), 0, 255);
+                    else
+                        ((float*)d)[x] = c[x];
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float * radius)
+        {
+            BlurParam param(width, height, channels, 1, radius);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianBlurFilter(param);
+        }
+
+        void * GaussianBlurInit32f(size_t width, size_t height, size_t channels, const float * radius)
+        {
+            BlurParam param(width, height, channels, 4, radius);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianBlurFilter(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -23,12 +23,41 @@
 */
 #include "Simd/SimdStore.h"
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdStream.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        typedef void(*ReorderPtr)(const uint8_t * src, size_t size, uint8_t * dst);
+
+        SIMD_INLINE void ReorderStream(const uint8_t * src, size_t size, uint8_t * dst, __m256i shuffle)
+        {
+            for (size_t offset = 0; offset < size; offset += A)
+                Stream<true, true>((__m256i*)(dst + offset), _mm256_shuffle_epi8(Load<false>((__m256i*)(src + offset)), shuffle));
+        }
+
+        bool ReorderStream(const uint8_t * src, size_t size, uint8_t * dst, size_t step, __m256i shuffle, ReorderPtr reorder)
+        {
+            size_t head = (uint8_t*)AlignHi(dst, A) - dst;
+            if (!Base::NeedStream(size) || head % step)
+                return false;
+            size_t body = AlignLo(size - head, A);
+            reorder(src, head, dst);
+            src += head;
+            dst += head;
+            Simd::Parallel(0, body, [&](size_t thread, size_t begin, size_t end)
+            {
+                ReorderStream(src + begin, end - begin, dst + begin, shuffle);
+                _mm_sfence();
+            }, Base::GetThreadNumber(), A);
+            reorder(src + body, size - head - body, dst + body);
+            return true;
+        }
+
         const __m256i K8_SHUFFLE_REORDER_16 = SIMD_MM256_SETR_EPI8(
             0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE,
             0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE);
@@ -52,6 +81,8 @@ namespace Simd
 
         void Reorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
         {
+            if (ReorderStream(src, size, dst, 2, K8_SHUFFLE_REORDER_16, Base::Reorder16bit))
+                return;
             if (Aligned(src) && Aligned(dst))
                 Reorder16bit<true>(src, size, dst);
             else
@@ -81,6 +112,8 @@ namespace Simd
 
         void Reorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
         {
+            if (ReorderStream(src, size, dst, 4, K8_SHUFFLE_REORDER_32, Base::Reorder32bit))
+                return;
             if (Aligned(src) && Aligned(dst))
                 Reorder32bit<true>(src, size, dst);
             else
@@ -110,6 +143,8 @@ namespace Simd
 
         void Reorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
         {
+            if (ReorderStream(src, size, dst, 8, K8_SHUFFLE_REORDER_64, Base::Reorder64bit))
+                return;
             if (Aligned(src) && Aligned(dst))
                 Reorder64bit<true>(src, size, dst);
             else
@@ -119,8 +119,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            SetBuffer(size, 2);
         }
 
         template <size_t channelCount> void ResizerByteBilinearInterpolateX(const __m256i * alpha, __m256i * buffer);
@@ -226,7 +225,7 @@ namespace Simd
             Store<false>((__m256i*)dst, PackI16ToU8(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -237,7 +236,7 @@ namespace Simd
             size_t dstW = _param.dstW;
             ptrdiff_t previous = -2;
             __m256i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
 
@@ -278,7 +277,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -286,7 +285,7 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m256i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
@@ -323,22 +322,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, dst, dstStride, buffer);
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, dst, dstStride, buffer);
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); break;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); break;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); break;
             default:
                 assert(0);
             }
@@ -478,14 +476,14 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = (int32_t*)buffer;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -496,14 +494,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, buffer); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); return;
             default:
                 assert(0);
             }
@@ -516,11 +514,11 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buffer, buffer + _rowSize / sizeof(float) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx::F);
             size_t rsh = AlignLo(rs, Sse::F);
@@ -642,7 +640,11 @@ namespace Simd
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
             if (param.IsByteBilinear() && dstX >= A)
-                return new ResizerByteBilinear(param);
+            {
+                ResizerByteBilinear * resizer = new ResizerByteBilinear(param);
+                resizer->EstimateParams();
+                return resizer;
+            }
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
@@ -0,0 +1,91 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SvmKernel::SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights)
+            : Base::SvmKernel(param, svs, weights)
+        {
+            _gemm = Avx2::Gemm32fNN;
+        }
+
+        void SvmKernel::Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const
+        {
+            const SvmKernelParam & p = _param;
+            size_t countF = AlignLo(count, F);
+            Exp exp(-p.gamma);
+            __m256 gamma = _mm256_set1_ps(p.gamma), coef0 = _mm256_set1_ps(p.coef0), _2 = _mm256_set1_ps(2.0f), _0 = _mm256_setzero_ps();
+            for (size_t b = 0; b < batch; ++b, dot += count)
+            {
+                __m256 _sum = _mm256_setzero_ps();
+                size_t c = 0;
+                if (p.type == SimdSvmKernelLinear)
+                {
+                    for (; c < countF; c += F)
+                        _sum = _mm256_fmadd_ps(Avx::Load<false>(weights + c), Avx::Load<false>(dot + c), _sum);
+                }
+                else if (p.type == SimdSvmKernelPolynomial)
+                {
+                    for (; c < countF; c += F)
+                    {
+                        __m256 value = _mm256_fmadd_ps(gamma, Avx::Load<false>(dot + c), coef0), kernel = value;
+                        for (int i = 1; i < p.degree; ++i)
+                            kernel = _mm256_mul_ps(kernel, value);
+                        _sum = _mm256_fmadd_ps(Avx::Load<false>(weights + c), kernel, _sum);
+                    }
+                }
+                else
+                {
+                    __m256 norm = _mm256_set1_ps(norms[b]);
+                    for (; c < countF; c += F)
+                    {
+                        __m256 distance = _mm256_fnmadd_ps(_2, Avx::Load<false>(dot + c), _mm256_add_ps(norm, Avx::Load<false>(svNorms + c)));
+                        _sum = _mm256_fmadd_ps(Avx::Load<false>(weights + c), exp.Exponent(_mm256_max_ps(distance, _0)), _sum);
+                    }
+                }
+                float s = Avx::ExtractSum(_sum);
+                for (; c < count; ++c)
+                    s += weights[c] * Base::SvmKernelValue(p, dot[c], norms[b], svNorms[c]);
+                sum[b] += s;
+            }
+        }
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree)
+        {
+            SvmKernelParam param(length, count, type, gamma, coef0, degree);
+            if (!param.Valid())
+                return NULL;
+            return new Avx2::SvmKernel(param, svs, weights);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
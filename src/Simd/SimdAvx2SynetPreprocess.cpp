@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static void SwapRgb(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            BgrToRgb(src, srcStride, width, height, dst, dstStride);
+        }
+
+        static void SetConverter(const PreprocessParam & p, PreprocessConverter & c)
+        {
+            bool gray = p.dstFormat == SimdPixelFormatGray8, rgb = p.dstFormat == SimdPixelFormatRgb24;
+            c.packed = NULL;
+            c.gray = NULL;
+            c.yuv = NULL;
+            c.minWidth = A;
+            switch (p.srcFormat)
+            {
+            case SimdSynetSourceGray8:
+                if (!gray) c.packed = GrayToBgr;
+                break;
+            case SimdSynetSourceBgr24:
+                if (gray) c.packed = BgrToGray;
+                else if (rgb) c.packed = SwapRgb;
+                break;
+            case SimdSynetSourceBgra32:
+                if (gray) c.packed = BgraToGray;
+                else if (rgb) c.packed = BgraToRgb;
+                else c.packed = BgraToBgr;
+                break;
+            case SimdSynetSourceRgb24:
+                if (gray) c.packed = RgbToGray;
+                else if (!rgb) c.packed = SwapRgb;
+                break;
+            case SimdSynetSourceNv12:
+            case SimdSynetSourceYuv420p:
+                if (rgb) c.yuv = Yuv444pToRgbV2;
+                else c.yuv = Yuv444pToBgrV2;
+                if (gray) c.gray = BgrToGray;
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        SynetPreprocess::SynetPreprocess(const PreprocessParam & param)
+            : Base::SynetPreprocess(param)
+        {
+            SetConverter(_param, _fast);
+            _src.Resize((_param.srcW + 1) * _param.channels + F);
+        }
+
+        void SynetPreprocess::HorizontalRow(const uint8_t * src, size_t dstSize, float * dst)
+        {
+            const int32_t * ix = _ix.data;
+            const float * fx = _fx.data;
+            size_t C = _param.channels, srcSize = ix[dstSize - 1] + C + 1;
+            float * buf = _src.data;
+            size_t srcSizeF = AlignLo(srcSize, F), i = 0;
+            for (; i < srcSizeF; i += F)
+                _mm256_storeu_ps(buf + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i)))));
+            for (; i < srcSize; ++i)
+                buf[i] = src[i];
+
+            size_t dstSizeF = AlignLo(dstSize, F);
+            __m256i _C = _mm256_set1_epi32((int)C);
+            for (i = 0; i < dstSizeF; i += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(ix + i));
+                __m256 s0 = _mm256_i32gather_ps(buf, idx, 4);
+                __m256 s1 = _mm256_i32gather_ps(buf, _mm256_add_epi32(idx, _C), 4);
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(fx + i), s0));
+            }
+            for (; i < dstSize; ++i)
+            {
+                float s0 = buf[ix[i]], s1 = buf[ix[i] + C];
+                dst[i] = s0 + (s1 - s0) * fx[i];
+            }
+        }
+
+        void SynetPreprocess::VerticalRow(const float * src0, const float * src1, float fy, size_t size, float * dst)
+        {
+            const float * k = _k.data, * b = _b.data;
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 _fy = _mm256_set1_ps(fy);
+            for (; i < sizeF; i += F)
+            {
+                __m256 s0 = _mm256_loadu_ps(src0 + i);
+                __m256 v = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(src1 + i), s0), _fy, s0);
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(v, _mm256_loadu_ps(k + i), _mm256_loadu_ps(b + i)));
+            }
+            for (; i < size; ++i)
+                dst[i] = (src0[i] + (src1[i] - src0[i]) * fy) * k[i] + b[i];
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+            SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding)
+        {
+            PreprocessParam param(srcWidth, srcHeight, srcFormat, yuvType, dstWidth, dstHeight, dstFormat, lower, upper, tensorFormat, tensorType, letterbox, padding);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocess(param);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,163 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i ReduceDepth(const uint16_t * src, __m256i offset, __m128i shift)
+        {
+            return _mm256_srl_epi16(_mm256_adds_epu16(_mm256_loadu_si256((__m256i*)src), offset), shift);
+        }
+
+        SIMD_INLINE void ReduceDepth(const uint16_t * src, __m256i offset, __m128i shift, uint8_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(ReduceDepth(src + 0, offset, shift), ReduceDepth(src + HA, offset, shift)));
+        }
+
+        SIMD_INLINE void ReduceDepth(const uint16_t * src, size_t size, const uint16_t * pattern, __m128i shift, uint8_t * dst)
+        {
+            assert(size >= A);
+            size_t sizeA = AlignLo(size, A);
+            __m256i offset = _mm256_loadu_si256((__m256i*)pattern);
+            for (size_t i = 0; i < sizeA; i += A)
+                ReduceDepth(src + i, offset, shift, dst + i);
+            if (sizeA != size)
+            {
+                size_t i = size - A;
+                ReduceDepth(src + i, _mm256_loadu_si256((__m256i*)(pattern + (i & 3))), shift, dst + i);
+            }
+        }
+
+        SIMD_INLINE void DepthReductionPattern(size_t bitDepth, SimdDepthReductionType reduction, size_t row, uint16_t * pattern)
+        {
+            Base::DepthReductionOffsets(bitDepth, reduction, row, pattern, HA + 4);
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride, size_t bitDepth, SimdDepthReductionType reduction)
+        {
+            assert(width >= A);
+
+            __m128i shift = _mm_cvtsi32_si128(int(bitDepth - 8));
+            uint16_t pattern[4][HA + 4];
+            for (size_t i = 0; i < 4; ++i)
+                DepthReductionPattern(bitDepth, reduction, i, pattern[i]);
+            for (size_t row = 0; row < height; ++row)
+            {
+                ReduceDepth((const uint16_t*)src, width, pattern[row & 3], shift, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Yuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+            uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, size_t bitDepth, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            Uint16ToGray(y, width, height, yStride, dy, dyStride, bitDepth, reduction);
+            Uint16ToGray(u, width / 2, height / 2, uStride, du, duStride, bitDepth, reduction);
+            Uint16ToGray(v, width / 2, height / 2, vStride, dv, dvStride, bitDepth, reduction);
+        }
+
+        void P010ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            Uint16ToGray(y, width, height, yStride, dy, dyStride, 16, reduction);
+            __m128i shift = _mm_cvtsi32_si128(8);
+            Array8u buffer(width);
+            uint16_t pattern[HA + 4];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                DepthReductionPattern(16, reduction, row / 2, pattern);
+                ReduceDepth((const uint16_t*)uv, width, pattern, shift, buffer.data);
+                DeinterleaveUv(buffer.data, width, width / 2, 1, du, duStride, dv, dvStride);
+                uv += uvStride;
+                du += duStride;
+                dv += dvStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, size_t bitDepth, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            __m128i shift = _mm_cvtsi32_si128(int(bitDepth - 8));
+            size_t widthUv = width / 2, strideY = AlignHi(width, A), strideUv = AlignHi(widthUv, A);
+            Array8u buffer(strideY * 2 + strideUv * 2);
+            uint8_t * by = buffer.data, * bu = by + strideY * 2, * bv = bu + strideUv;
+            uint16_t pattern[HA + 4];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                DepthReductionPattern(bitDepth, reduction, row + 0, pattern);
+                ReduceDepth((const uint16_t*)y, width, pattern, shift, by);
+                DepthReductionPattern(bitDepth, reduction, row + 1, pattern);
+                ReduceDepth((const uint16_t*)(y + yStride), width, pattern, shift, by + strideY);
+                DepthReductionPattern(bitDepth, reduction, row / 2, pattern);
+                ReduceDepth((const uint16_t*)u, widthUv, pattern, shift, bu);
+                ReduceDepth((const uint16_t*)v, widthUv, pattern, shift, bv);
+                Yuv420pToBgraV2(by, strideY, bu, strideUv, bv, strideUv, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void P010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            __m128i shift = _mm_cvtsi32_si128(8);
+            size_t widthUv = width / 2, strideY = AlignHi(width, A), strideUv = AlignHi(widthUv, A);
+            Array8u buffer(strideY * 3 + strideUv * 2);
+            uint8_t * by = buffer.data, * buv = by + strideY * 2, * bu = buv + strideY, * bv = bu + strideUv;
+            uint16_t pattern[HA + 4];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                DepthReductionPattern(16, reduction, row + 0, pattern);
+                ReduceDepth((const uint16_t*)y, width, pattern, shift, by);
+                DepthReductionPattern(16, reduction, row + 1, pattern);
+                ReduceDepth((const uint16_t*)(y + yStride), width, pattern, shift, by + strideY);
+                DepthReductionPattern(16, reduction, row / 2, pattern);
+                ReduceDepth((const uint16_t*)uv, width, pattern, shift, buv);
+                DeinterleaveUv(buv, strideY, widthUv, 1, bu, strideUv, bv, strideUv);
+                Yuv420pToBgraV2(by, strideY, bu, strideUv, bv, strideUv, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
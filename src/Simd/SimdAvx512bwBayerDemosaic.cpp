@@ -0,0 +1,208 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i BayerLoad(const uint8_t * src)
+        {
+            return _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE __m512i BayerLoad(const uint16_t * src)
+        {
+            return _mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i*)src));
+        }
+
+        template<class T> SIMD_INLINE void BayerLoadRow(const T * src, const __m512i & gains, const __m512i & max, int32_t * dst)
+        {
+            __m512i value = _mm512_mullo_epi32(BayerLoad(src), gains);
+            value = _mm512_srli_epi32(_mm512_add_epi32(value, _mm512_set1_epi32(Base::BAYER_GAIN_ROUND)), Base::BAYER_GAIN_SHIFT);
+            _mm512_storeu_si512(dst, _mm512_min_epi32(value, max));
+        }
+
+        template<class T> void BayerLoadRow(const T * src, size_t width, int32_t even, int32_t odd, int32_t max, int32_t * dst)
+        {
+            __m512i _gains = _mm512_mask_set1_epi32(_mm512_set1_epi32(even), 0xAAAA, odd);
+            __m512i _max = _mm512_set1_epi32(max);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                BayerLoadRow(src + x, _gains, _max, dst + x);
+            if (widthF != width)
+                BayerLoadRow(src + width - F, _gains, _max, dst + width - F);
+        }
+
+        SIMD_INLINE __m512i Load(const int32_t * src)
+        {
+            return _mm512_loadu_si512(src);
+        }
+
+        template<SimdBayerDemosaicType demosaic> SIMD_INLINE void BayerDemosaic(const int32_t * const * r, size_t x,
+            __m512i & c, __m512i & gx, __m512i & hn, __m512i & vn, __m512i & dg)
+        {
+            __m512i r2 = Load(r[2] + x);
+            __m512i h2 = _mm512_add_epi32(Load(r[2] + x - 1), Load(r[2] + x + 1));
+            __m512i v2 = _mm512_add_epi32(Load(r[1] + x), Load(r[3] + x));
+            __m512i d4 = _mm512_add_epi32(_mm512_add_epi32(Load(r[1] + x - 1), Load(r[1] + x + 1)), _mm512_add_epi32(Load(r[3] + x - 1), Load(r[3] + x + 1)));
+            __m512i hv2 = _mm512_slli_epi32(_mm512_add_epi32(h2, v2), 2);
+            c = _mm512_slli_epi32(r2, 4);
+            if (demosaic == SimdBayerDemosaicMhc)
+            {
+                __m512i hh = _mm512_add_epi32(Load(r[2] + x - 2), Load(r[2] + x + 2));
+                __m512i vv = _mm512_add_epi32(Load(r[0] + x), Load(r[4] + x));
+                __m512i hhvv = _mm512_add_epi32(hh, vv);
+                __m512i r2x2 = _mm512_slli_epi32(r2, 1);
+                __m512i r2x8 = _mm512_slli_epi32(r2, 3);
+                __m512i r2x10 = _mm512_add_epi32(r2x8, r2x2);
+                gx = _mm512_sub_epi32(_mm512_add_epi32(r2x8, hv2), _mm512_slli_epi32(hhvv, 1));
+                hn = _mm512_add_epi32(_mm512_sub_epi32(_mm512_add_epi32(r2x10, _mm512_slli_epi32(h2, 3)), _mm512_slli_epi32(_mm512_add_epi32(hh, d4), 1)), vv);
+                vn = _mm512_add_epi32(_mm512_sub_epi32(_mm512_add_epi32(r2x10, _mm512_slli_epi32(v2, 3)), _mm512_slli_epi32(_mm512_add_epi32(vv, d4), 1)), hh);
+                dg = _mm512_add_epi32(_mm512_add_epi32(r2x8, _mm512_slli_epi32(r2, 2)), _mm512_slli_epi32(d4, 2));
+                dg = _mm512_sub_epi32(dg, _mm512_add_epi32(_mm512_slli_epi32(hhvv, 1), hhvv));
+            }
+            else
+            {
+                __m512i dh = _mm512_abs_epi32(_mm512_sub_epi32(Load(r[2] + x - 2), Load(r[2] + x + 2)));
+                __m512i dv = _mm512_abs_epi32(_mm512_sub_epi32(Load(r[0] + x), Load(r[4] + x)));
+                hn = _mm512_slli_epi32(h2, 3);
+                vn = _mm512_slli_epi32(v2, 3);
+                dg = _mm512_slli_epi32(d4, 2);
+                gx = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(dh, dv), hv2, vn);
+                gx = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(dv, dh), gx, hn);
+            }
+        }
+
+        SIMD_INLINE void BayerOutput(__m512i value, __m512i round, __m128i shift, uint8_t * dst)
+        {
+            value = _mm512_sra_epi32(_mm512_add_epi32(value, round), shift);
+            _mm_storeu_si128((__m128i*)dst, _mm512_cvtusepi32_epi8(_mm512_max_epi32(value, K_ZERO)));
+        }
+
+        template<SimdBayerDemosaicType demosaic> SIMD_INLINE void BayerDemosaic(const int32_t * const * r, size_t x, bool redRow,
+            __mmask16 green, __m512i round, __m128i shift, uint8_t * b, uint8_t * g, uint8_t * rd)
+        {
+            __m512i c, gx, hn, vn, dg;
+            BayerDemosaic<demosaic>(r, x, c, gx, hn, vn, dg);
+            __m512i blue = redRow ? _mm512_mask_blend_epi32(green, dg, vn) : _mm512_mask_blend_epi32(green, c, hn);
+            __m512i red = redRow ? _mm512_mask_blend_epi32(green, c, hn) : _mm512_mask_blend_epi32(green, dg, vn);
+            BayerOutput(blue, round, shift, b + x);
+            BayerOutput(_mm512_mask_blend_epi32(green, gx, c), round, shift, g + x);
+            BayerOutput(red, round, shift, rd + x);
+        }
+
+        template<SimdBayerDemosaicType demosaic> void BayerDemosaicRow(const int32_t * const * r, size_t width,
+            bool redRow, bool greenEven, size_t bitDepth, uint8_t * b, uint8_t * g, uint8_t * rd)
+        {
+            __m128i shift = _mm_cvtsi32_si128(int(bitDepth) - 4);
+            __m512i round = _mm512_set1_epi32(1 << (bitDepth - 5));
+            __mmask16 green = greenEven ? 0x5555 : 0xAAAA;
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                BayerDemosaic<demosaic>(r, x, redRow, green, round, shift, b, g, rd);
+            if (widthF != width)
+                BayerDemosaic<demosaic>(r, width - F, redRow, green, round, shift, b, g, rd);
+        }
+
+        template<class T, SimdBayerDemosaicType demosaic, size_t channels> void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride,
+            SimdPixelFormatType bayerFormat, size_t bitDepth, const float * gains, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            Base::BayerRows rows(width, height, bitDepth, gains);
+            Array8u buffer(width * 4);
+            uint8_t * b = buffer.data, * g = b + width, * rd = g + width, * a = rd + width;
+            if (channels == 4)
+                memset(a, alpha, width);
+            const int32_t * r[5];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (ptrdiff_t i = 0; i < 5; ++i)
+                {
+                    size_t index = rows.Index(ptrdiff_t(row) + i - 2);
+                    bool load;
+                    int32_t * p = rows.Row(index, load);
+                    if (load)
+                    {
+                        int32_t even, odd;
+                        rows.Gains(bayerFormat, index, even, odd);
+                        BayerLoadRow((const T*)(bayer + index * bayerStride), width, even, odd, rows.Max(), p);
+                        rows.Pad(p);
+                    }
+                    r[i] = p;
+                }
+                bool redRow, greenEven;
+                Base::BayerRowType(bayerFormat, row, redRow, greenEven);
+                BayerDemosaicRow<demosaic>(r, width, redRow, greenEven, bitDepth, b, g, rd);
+                if (channels == 4)
+                    InterleaveBgra(b, width, g, width, rd, width, a, width, width, 1, dst, dstStride);
+                else
+                    InterleaveBgr(b, width, g, width, rd, width, width, 1, dst, dstStride);
+                dst += dstStride;
+            }
+        }
+
+        template<size_t channels> void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride,
+            SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A && bitDepth >= 8 && bitDepth <= 16);
+
+            if (bitDepth == 8)
+            {
+                if (demosaic == SimdBayerDemosaicMhc)
+                    BayerToBgrV2<uint8_t, SimdBayerDemosaicMhc, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+                else
+                    BayerToBgrV2<uint8_t, SimdBayerDemosaicBilinear, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+            }
+            else
+            {
+                if (demosaic == SimdBayerDemosaicMhc)
+                    BayerToBgrV2<uint16_t, SimdBayerDemosaicMhc, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+                else
+                    BayerToBgrV2<uint16_t, SimdBayerDemosaicBilinear, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+            }
+        }
+
+        void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgr, size_t bgrStride)
+        {
+            if (bitDepth == 8 && demosaic == SimdBayerDemosaicBilinear && gains == NULL)
+                BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+            else
+                BayerToBgrV2<3>(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgr, bgrStride, 0xFF);
+        }
+
+        void BayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if (bitDepth == 8 && demosaic == SimdBayerDemosaicBilinear && gains == NULL)
+                BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+            else
+                BayerToBgrV2<4>(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgra, bgraStride, alpha);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
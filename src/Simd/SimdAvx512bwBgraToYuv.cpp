@@ -37,20 +37,20 @@ namespace Simd
             g16_1 = _mm512_or_si512(_mm512_shuffle_epi8(_bgra, K8_SUFFLE_BGRA_TO_G000), K32_00010000);
         }
 
-        template <bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgraToY16(const uint8_t * bgra, __m512i & b16_r16, __m512i & g16_1, const __mmask64 * ms)
+        template <class T, bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgraToY16(const uint8_t * bgra, __m512i & b16_r16, __m512i & g16_1, const __mmask64 * ms)
         {
             __m512i _b16_r16[2], _g16_1[2];
             LoadPreparedBgra16<align, mask>(bgra + 0, _b16_r16[0], _g16_1[0], ms + 0);
             LoadPreparedBgra16<align, mask>(bgra + A, _b16_r16[1], _g16_1[1], ms + 1);
             b16_r16 = Hadd32(_b16_r16[0], _b16_r16[1]);
             g16_1 = Hadd32(_g16_1[0], _g16_1[1]);
-            return Saturate16iTo8u(_mm512_add_epi16(K16_Y_ADJUST, _mm512_packs_epi32(BgrToY32(_b16_r16[0], _g16_1[0]), BgrToY32(_b16_r16[1], _g16_1[1]))));
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_ADJUST), _mm512_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
         }
 
-        template <bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgraToY8(const uint8_t * bgra, __m512i b16_r16[2], __m512i g16_1[2], const __mmask64 * ms)
+        template <class T, bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgraToY8(const uint8_t * bgra, __m512i b16_r16[2], __m512i g16_1[2], const __mmask64 * ms)
         {
-            __m512i lo = LoadAndConvertBgraToY16<align, mask>(bgra + 0 * A, b16_r16[0], g16_1[0], ms + 0);
-            __m512i hi = LoadAndConvertBgraToY16<align, mask>(bgra + 2 * A, b16_r16[1], g16_1[1], ms + 2);
+            __m512i lo = LoadAndConvertBgraToY16<T, align, mask>(bgra + 0 * A, b16_r16[0], g16_1[0], ms + 0);
+            __m512i hi = LoadAndConvertBgraToY16<T, align, mask>(bgra + 2 * A, b16_r16[1], g16_1[1], ms + 2);
             return Permuted2Pack16iTo8u(lo, hi);
         }
 
@@ -59,26 +59,26 @@ namespace Simd
             a = _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(a, b), K16_0002), 2);
         }
 
-        SIMD_INLINE __m512i ConvertU16(__m512i b16_r16[2], __m512i g16_1[2])
+        template <class T> SIMD_INLINE __m512i ConvertU16(__m512i b16_r16[2], __m512i g16_1[2])
         {
-            return Saturate16iTo8u(_mm512_add_epi16(K16_UV_ADJUST, _mm512_packs_epi32(BgrToU32(b16_r16[0], g16_1[0]), BgrToU32(b16_r16[1], g16_1[1]))));
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::UV_ADJUST), _mm512_packs_epi32(BgrToU32<T>(b16_r16[0], g16_1[0]), BgrToU32<T>(b16_r16[1], g16_1[1]))));
         }
 
-        SIMD_INLINE __m512i ConvertV16(__m512i b16_r16[2], __m512i g16_1[2])
+        template <class T> SIMD_INLINE __m512i ConvertV16(__m512i b16_r16[2], __m512i g16_1[2])
         {
-            return Saturate16iTo8u(_mm512_add_epi16(K16_UV_ADJUST, _mm512_packs_epi32(BgrToV32(b16_r16[0], g16_1[0]), BgrToV32(b16_r16[1], g16_1[1]))));
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::UV_ADJUST), _mm512_packs_epi32(BgrToV32<T>(b16_r16[0], g16_1[0]), BgrToV32<T>(b16_r16[1], g16_1[1]))));
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        template <class T, bool align, bool mask> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, const __mmask64 * ms)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
             uint8_t * y1 = y0 + yStride;
 
             __m512i _b16_r16[2][2][2], _g16_1[2][2][2];
-            Store<align, mask>(y0 + 0, LoadAndConvertBgraToY8<align, mask>(bgra0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], ms + 0), ms[8]);
-            Store<align, mask>(y0 + A, LoadAndConvertBgraToY8<align, mask>(bgra0 + 4 * A, _b16_r16[0][1], _g16_1[0][1], ms + 4), ms[9]);
-            Store<align, mask>(y1 + 0, LoadAndConvertBgraToY8<align, mask>(bgra1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], ms + 0), ms[8]);
-            Store<align, mask>(y1 + A, LoadAndConvertBgraToY8<align, mask>(bgra1 + 4 * A, _b16_r16[1][1], _g16_1[1][1], ms + 4), ms[9]);
+            Store<align, mask>(y0 + 0, LoadAndConvertBgraToY8<T, align, mask>(bgra0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], ms + 0), ms[8]);
+            Store<align, mask>(y0 + A, LoadAndConvertBgraToY8<T, align, mask>(bgra0 + 4 * A, _b16_r16[0][1], _g16_1[0][1], ms + 4), ms[9]);
+            Store<align, mask>(y1 + 0, LoadAndConvertBgraToY8<T, align, mask>(bgra1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], ms + 0), ms[8]);
+            Store<align, mask>(y1 + A, LoadAndConvertBgraToY8<T, align, mask>(bgra1 + 4 * A, _b16_r16[1][1], _g16_1[1][1], ms + 4), ms[9]);
 
             Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
             Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
@@ -90,11 +90,11 @@ namespace Simd
             Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
             Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
 
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0][0], _g16_1[0][0]), ConvertU16(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0][0], _g16_1[0][0]), ConvertV16(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16<T>(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16<T>(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
         }
 
-        template <bool align> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0));
@@ -117,9 +117,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgraToYuv420p<align, false>(bgra + col * 8, bgraStride, y + col * 2, yStride, u + col, v + col, tailMasks);
+                    BgraToYuv420p<T, align, false>(bgra + col * 8, bgraStride, y + col * 2, yStride, u + col, v + col, tailMasks);
                 if (col < width)
-                    BgraToYuv420p<align, true>(bgra + col * 8, bgraStride, y + col * 2, yStride, u + col, v + col, tailMasks);
+                    BgraToYuv420p<T, align, true>(bgra + col * 8, bgraStride, y + col * 2, yStride, u + col, v + col, tailMasks);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -127,14 +127,36 @@ namespace Simd
             }
         }
 
-        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv420p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv420p<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv420p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv420p<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv420p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv420p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv420p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv420p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv420p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv420p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv420p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
 
         SIMD_INLINE void Average16(__m512i a[2][2])
@@ -145,20 +167,20 @@ namespace Simd
             a[1][1] = _mm512_srli_epi16(_mm512_add_epi16(a[1][1], K16_0001), 1);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        template <class T, bool align, bool mask> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
         {
             __m512i _b16_r16[2][2], _g16_1[2][2];
-            Store<align, mask>(y + 0, LoadAndConvertBgraToY8<align, mask>(bgra + 0 * A, _b16_r16[0], _g16_1[0], ms + 0), ms[8]);
-            Store<align, mask>(y + A, LoadAndConvertBgraToY8<align, mask>(bgra + 4 * A, _b16_r16[1], _g16_1[1], ms + 4), ms[9]);
+            Store<align, mask>(y + 0, LoadAndConvertBgraToY8<T, align, mask>(bgra + 0 * A, _b16_r16[0], _g16_1[0], ms + 0), ms[8]);
+            Store<align, mask>(y + A, LoadAndConvertBgraToY8<T, align, mask>(bgra + 4 * A, _b16_r16[1], _g16_1[1], ms + 4), ms[9]);
 
             Average16(_b16_r16);
             Average16(_g16_1);
 
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1])), ms[10]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1])), ms[10]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0], _g16_1[0]), ConvertU16<T>(_b16_r16[1], _g16_1[1])), ms[10]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0], _g16_1[0]), ConvertV16<T>(_b16_r16[1], _g16_1[1])), ms[10]);
         }
 
-        template <bool align> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert(width % 2 == 0);
@@ -181,9 +203,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgraToYuv422p<align, false>(bgra + col * 8, y + col * 2, u + col, v + col, tailMasks);
+                    BgraToYuv422p<T, align, false>(bgra + col * 8, y + col * 2, u + col, v + col, tailMasks);
                 if (col < width)
-                    BgraToYuv422p<align, true>(bgra + col * 8, y + col * 2, u + col, v + col, tailMasks);
+                    BgraToYuv422p<T, align, true>(bgra + col * 8, y + col * 2, u + col, v + col, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -191,22 +213,44 @@ namespace Simd
             }
         }
 
-        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv422p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv422p<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv422p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv422p<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv422p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
         }
 
-        SIMD_INLINE __m512i ConvertY16(__m512i b16_r16[2], __m512i g16_1[2])
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
         {
-            return Saturate16iTo8u(_mm512_add_epi16(K16_Y_ADJUST, _mm512_packs_epi32(BgrToY32(b16_r16[0], g16_1[0]), BgrToY32(b16_r16[1], g16_1[1]))));
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv422p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv422p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv422p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv422p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv422p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv422p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgraToYuv444p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        template <class T> SIMD_INLINE __m512i ConvertY16(__m512i b16_r16[2], __m512i g16_1[2])
+        {
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_ADJUST), _mm512_packs_epi32(BgrToY32<T>(b16_r16[0], g16_1[0]), BgrToY32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void BgraToYuv444p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
         {
             __m512i _b16_r16[2][2], _g16_1[2][2];
             LoadPreparedBgra16<align, mask>(bgra + 0 * A, _b16_r16[0][0], _g16_1[0][0], ms + 0);
@@ -214,12 +258,12 @@ namespace Simd
             LoadPreparedBgra16<align, mask>(bgra + 2 * A, _b16_r16[1][0], _g16_1[1][0], ms + 2);
             LoadPreparedBgra16<align, mask>(bgra + 3 * A, _b16_r16[1][1], _g16_1[1][1], ms + 3);
 
-            Store<align, mask>(y, Permuted2Pack16iTo8u(ConvertY16(_b16_r16[0], _g16_1[0]), ConvertY16(_b16_r16[1], _g16_1[1])), ms[4]);
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1])), ms[4]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(y, Permuted2Pack16iTo8u(ConvertY16<T>(_b16_r16[0], _g16_1[0]), ConvertY16<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0], _g16_1[0]), ConvertU16<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0], _g16_1[0]), ConvertV16<T>(_b16_r16[1], _g16_1[1])), ms[4]);
         }
 
-        template <bool align> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (align)
@@ -238,9 +282,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgraToYuv444p<align, false>(bgra + col * 4, y + col, u + col, v + col, tailMasks);
+                    BgraToYuv444p<T, align, false>(bgra + col * 4, y + col, u + col, v + col, tailMasks);
                 if (col < width)
-                    BgraToYuv444p<align, true>(bgra + col * 4, y + col, u + col, v + col, tailMasks);
+                    BgraToYuv444p<T, align, true>(bgra + col * 4, y + col, u + col, v + col, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -248,14 +292,36 @@ namespace Simd
             }
         }
 
-        void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv444p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv444p<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv444p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv444p<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv444p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv444p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv444p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv444p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv444p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv444p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv444p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
 
 
@@ -267,37 +333,37 @@ namespace Simd
             a32 = _mm512_shuffle_epi8(_bgra, K8_SUFFLE_BGRA_TO_A000);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void LoadAndConvertYA16(const uint8_t * bgra, __m512i & b16_r16, __m512i & g16_1, __m512i & y16, __m512i & a16, const __mmask64 * tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void LoadAndConvertYA16(const uint8_t * bgra, __m512i & b16_r16, __m512i & g16_1, __m512i & y16, __m512i & a16, const __mmask64 * tails)
         {
             __m512i _b16_r16[2], _g16_1[2], a32[2];
             LoadPreparedBgra16<align, mask>(bgra + 0, _b16_r16[0], _g16_1[0], a32[0], tails + 0);
             LoadPreparedBgra16<align, mask>(bgra + A, _b16_r16[1], _g16_1[1], a32[1], tails + 1);
             b16_r16 = Hadd32(_b16_r16[0], _b16_r16[1]);
             g16_1 = Hadd32(_g16_1[0], _g16_1[1]);
-            y16 = Saturate16iTo8u(_mm512_add_epi16(K16_Y_ADJUST, _mm512_packs_epi32(BgrToY32(_b16_r16[0], _g16_1[0]), BgrToY32(_b16_r16[1], _g16_1[1]))));
+            y16 = Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_ADJUST), _mm512_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
             a16 = _mm512_packs_epi32(a32[0], a32[1]);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void LoadAndStoreYA(const uint8_t * bgra, __m512i b16_r16[2], __m512i g16_1[2], uint8_t * y, uint8_t * a, const __mmask64 * tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void LoadAndStoreYA(const uint8_t * bgra, __m512i b16_r16[2], __m512i g16_1[2], uint8_t * y, uint8_t * a, const __mmask64 * tails)
         {
             __m512i y16[2], a16[2];
-            LoadAndConvertYA16<align, mask>(bgra + 0 * A, b16_r16[0], g16_1[0], y16[0], a16[0], tails + 0);
-            LoadAndConvertYA16<align, mask>(bgra + 2 * A, b16_r16[1], g16_1[1], y16[1], a16[1], tails + 2);
+            LoadAndConvertYA16<T, align, mask>(bgra + 0 * A, b16_r16[0], g16_1[0], y16[0], a16[0], tails + 0);
+            LoadAndConvertYA16<T, align, mask>(bgra + 2 * A, b16_r16[1], g16_1[1], y16[1], a16[1], tails + 2);
             Store<align, mask>(y, Permuted2Pack16iTo8u(y16[0], y16[1]), tails[4]);
             Store<align, mask>(a, Permuted2Pack16iTo8u(a16[0], a16[1]), tails[4]);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgraToYuva420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, uint8_t * a0, size_t aStride, const __mmask64 * tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void BgraToYuva420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, uint8_t * a0, size_t aStride, const __mmask64 * tails)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
             uint8_t * y1 = y0 + yStride;
             uint8_t * a1 = a0 + aStride;
 
             __m512i _b16_r16[2][2][2], _g16_1[2][2][2];
-            LoadAndStoreYA<align, mask>(bgra0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], y0 + 0, a0 + 0, tails + 0);
-            LoadAndStoreYA<align, mask>(bgra0 + 4 * A, _b16_r16[0][1], _g16_1[0][1], y0 + A, a0 + A, tails + 5);
-            LoadAndStoreYA<align, mask>(bgra1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], y1 + 0, a1 + 0, tails + 0);
-            LoadAndStoreYA<align, mask>(bgra1 + 4 * A, _b16_r16[1][1], _g16_1[1][1], y1 + A, a1 + A, tails + 5);
+            LoadAndStoreYA<T, align, mask>(bgra0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], y0 + 0, a0 + 0, tails + 0);
+            LoadAndStoreYA<T, align, mask>(bgra0 + 4 * A, _b16_r16[0][1], _g16_1[0][1], y0 + A, a0 + A, tails + 5);
+            LoadAndStoreYA<T, align, mask>(bgra1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], y1 + 0, a1 + 0, tails + 0);
+            LoadAndStoreYA<T, align, mask>(bgra1 + 4 * A, _b16_r16[1][1], _g16_1[1][1], y1 + A, a1 + A, tails + 5);
 
             Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
             Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
@@ -309,11 +375,11 @@ namespace Simd
             Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
             Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
 
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0][0], _g16_1[0][0]), ConvertU16(_b16_r16[0][1], _g16_1[0][1])), tails[10]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0][0], _g16_1[0][0]), ConvertV16(_b16_r16[0][1], _g16_1[0][1])), tails[10]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16<T>(_b16_r16[0][1], _g16_1[0][1])), tails[10]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16<T>(_b16_r16[0][1], _g16_1[0][1])), tails[10]);
         }
 
-        template <bool align> void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -339,9 +405,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgraToYuva420p<align, false>(bgra + col*8, bgraStride, y + col*2, yStride, u + col, v + col, a + col*2, aStride, tails);
+                    BgraToYuva420p<T, align, false>(bgra + col*8, bgraStride, y + col*2, yStride, u + col, v + col, a + col*2, aStride, tails);
                 if (col < width)
-                    BgraToYuva420p<align, true>(bgra + col*8, bgraStride, y + col*2, yStride, u + col, v + col, a + col*2, aStride, tails);
+                    BgraToYuva420p<T, align, true>(bgra + col*8, bgraStride, y + col*2, yStride, u + col, v + col, a + col*2, aStride, tails);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -350,14 +416,20 @@ namespace Simd
             }
         }
 
-        void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride)
                 && Aligned(a) && Aligned(aStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuva420p<true>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+                BgraToYuva420p<T, true>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
             else
-                BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+                BgraToYuva420p<T, false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+        }
+
+        void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
+        {
+            BgraToYuva420p<Base::Bt601>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
@@ -179,42 +179,51 @@ namespace Simd
             stageSum = _mm512_add_ps(stageSum, _mm512_mask_blend_ps(mask, _mm512_set1_ps(leaves[0]), _mm512_set1_ps(leaves[1])));
         }
 
-        template <bool masked> __mmask16 Detect32f(const HidHaarCascade & hid, size_t offset, const __m512 & norm, __mmask16 result)
+        template <bool masked> SIMD_INLINE __m512 StageSum32f(const HidHaarCascade & hid, const HidHaarStage & stage, size_t offset, const __m512 & norm, __mmask16 tail)
         {
             typedef HidHaarCascade Hid;
-            const float * leaves = hid.leaves.data();
-            const Hid::Node * node = hid.nodes.data();
-            const Hid::Stage * stages = hid.stages.data();
-            for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
+            if (stage.canSkip)
+                return _mm512_set1_ps(stage.threshold);
+            const float * leaves = hid.leaves.data() + stage.first * 2;
+            const Hid::Node * node = hid.nodes.data() + stage.first;
+            const Hid::Node * end = node + stage.ntrees;
+            __m512 stageSum = _mm512_setzero_ps();
+            if (stage.hasThree)
             {
-                const Hid::Stage & stage = stages[i];
-                if (stage.canSkip)
-                    continue;
-                const Hid::Node * end = node + stage.ntrees;
-                __m512 stageSum = _mm512_setzero_ps();
-                if (stage.hasThree)
+                for (; node < end; ++node, leaves += 2)
                 {
-                    for (; node < end; ++node, leaves += 2)
-                    {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m512 sum = _mm512_add_ps(
-                            WeightedSum32f<masked>(feature.rect[0], offset, result),
-                            WeightedSum32f<masked>(feature.rect[1], offset, result));
-                        if (feature.rect[2].p0)
-                            sum = _mm512_add_ps(sum, WeightedSum32f<masked>(feature.rect[2], offset, result));
-                        StageSum32f(leaves, node->threshold, sum, norm, stageSum);
-                    }
+                    const Hid::Feature & feature = hid.features[node->featureIdx];
+                    __m512 sum = _mm512_add_ps(
+                        WeightedSum32f<masked>(feature.rect[0], offset, tail),
+                        WeightedSum32f<masked>(feature.rect[1], offset, tail));
+                    if (feature.rect[2].p0)
+                        sum = _mm512_add_ps(sum, WeightedSum32f<masked>(feature.rect[2], offset, tail));
+                    StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                 }
-                else
+            }
+            else
+            {
+                for (; node < end; ++node, leaves += 2)
                 {
-                    for (; node < end; ++node, leaves += 2)
-                    {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m512 sum = _mm512_add_ps(WeightedSum32f<masked>(feature.rect[0], offset, result),
-                            WeightedSum32f<masked>(feature.rect[1], offset, result));
-                        StageSum32f(leaves, node->threshold, sum, norm, stageSum);
-                    }
+                    const Hid::Feature & feature = hid.features[node->featureIdx];
+                    __m512 sum = _mm512_add_ps(WeightedSum32f<masked>(feature.rect[0], offset, tail),
+                        WeightedSum32f<masked>(feature.rect[1], offset, tail));
+                    StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                 }
+            }
+            return stageSum;
+        }
+
+        template <bool masked> __mmask16 Detect32f(const HidHaarCascade & hid, size_t offset, int startStage, const __m512 & norm, __mmask16 result)
+        {
+            typedef HidHaarCascade Hid;
+            const Hid::Stage * stages = hid.stages.data();
+            for (int i = startStage, n = (int)hid.stages.size(); i < n; ++i)
+            {
+                const Hid::Stage & stage = stages[i];
+                if (stage.canSkip)
+                    continue;
+                __m512 stageSum = StageSum32f<masked>(hid, stage, offset, norm, result);
                 result = result & _mm512_cmp_ps_mask(stageSum, _mm512_set1_ps(stage.threshold), _CMP_GE_OQ);
                 if (!result)
                     return result;
@@ -248,7 +257,7 @@ namespace Simd
                     if (result)
                     {
                         __m512 norm = Norm32fp<false>(hid, pq_offset + col);
-                        result = Detect32f<false>(hid, p_offset + col, norm, result);
+                        result = Detect32f<false>(hid, p_offset + col, 0, norm, result);
                         Store<false>(buffer.d + col, _mm512_maskz_set1_epi32(result, 1));
                     }
                 }
@@ -258,7 +267,7 @@ namespace Simd
                     if (result)
                     {
                         __m512 norm = Norm32fp<true>(hid, pq_offset + col, tailMask);
-                        result = Detect32f<true>(hid, p_offset + col, norm, result);
+                        result = Detect32f<true>(hid, p_offset + col, 0, norm, result);
                         Store<false, true>(buffer.d + col, _mm512_maskz_set1_epi32(result, 1), tailMask);
                     }
                 }
@@ -276,6 +285,55 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        struct Survivors
+        {
+        private:
+            Buffer<uint32_t> _buffer;
+        public:
+            uint32_t * index;
+            float * norm;
+            size_t count;
+
+            Survivors(size_t size)
+                : _buffer(size)
+                , index(_buffer.m)
+                , norm((float*)_buffer.d)
+                , count(0)
+            {
+            }
+        };
+
+        template <bool masked> SIMD_INLINE void Detect32fi(const HidHaarCascade & hid, size_t p_offset, size_t pq_offset, size_t col,
+            const __mmask16 * tails, Buffer<uint16_t> & buffer, Buffer<uint16_t> & skip, Survivors & survivors)
+        {
+            __mmask16 tail = masked ? tails[2] : __mmask16(-1);
+            __mmask16 result = _mm512_cmpneq_epi32_mask(_mm512_and_si512((Load<false, masked>((uint32_t*)buffer.m + col / 2, tail)), K32_0000FFFF), K_ZERO);
+            result = result & ~_mm512_cmpneq_epi32_mask(_mm512_and_si512((Load<false, masked>((uint32_t*)skip.m + col / 2, tail)), K32_0000FFFF), K_ZERO);
+            __mmask16 strong = 0;
+            if (result)
+            {
+                __m512 norm = Norm32fi<masked>(hid, pq_offset + col, tails);
+                __m512 sum = StageSum32f<masked>(hid, hid.stages[0], p_offset + col / 2, norm, result);
+                strong = result & _mm512_cmp_ps_mask(sum, _mm512_set1_ps(hid.skipThreshold), _CMP_LT_OQ);
+                result = result & _mm512_cmp_ps_mask(sum, _mm512_set1_ps(hid.stages[0].threshold), _CMP_GE_OQ);
+                if (_mm_popcnt_u32(result) >= 4)
+                {
+                    result = Detect32f<masked>(hid, p_offset + col / 2, 1, norm, result);
+                    Store<false, masked>((uint32_t*)buffer.d + col / 2, _mm512_maskz_set1_epi32(result, 1), tail);
+                }
+                else
+                {
+                    for (; result; result &= result - 1)
+                    {
+                        int j = _tzcnt_u32(result);
+                        survivors.index[survivors.count] = uint32_t(col + 2 * j);
+                        survivors.norm[survivors.count++] = Avx512f::Extract(norm, j);
+                    }
+                }
+            }
+            Store<false, masked>((uint32_t*)skip.d + col / 2, _mm512_maskz_set1_epi32(strong, 1), tail);
+        }
+
         void DetectionHaarDetect32fi(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
         {
             const size_t step = 2;
@@ -287,6 +345,9 @@ namespace Simd
                 tailMasks[c] = TailMask16(width - alignedWidth - F*c);
             tailMasks[2] = TailMask16((width - alignedWidth) / 2);
             Buffer<uint16_t> buffer(evenWidth);
+            Buffer<uint16_t> skip(width);
+            memset(skip.m, 0, width * sizeof(uint16_t));
+            Survivors survivors(width);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += step)
             {
                 size_t col = 0;
@@ -295,36 +356,32 @@ namespace Simd
 
                 UnpackMask16i(mask.data + row*mask.stride + rect.left, evenWidth, buffer.m, K16_0001);
                 memset(buffer.d, 0, evenWidth * sizeof(uint16_t));
+                survivors.count = 0;
                 for (; col < alignedWidth; col += HA)
-                {
-                    __mmask16 result = _mm512_cmpneq_epi32_mask(_mm512_and_si512(Load<false>(buffer.m + col), K32_0000FFFF), K_ZERO);
-                    if (result)
-                    {
-                        __m512 norm = Norm32fi<false>(hid, pq_offset + col, tailMasks);
-                        result = Detect32f<false>(hid, p_offset + col / 2, norm, result);
-                        Store<false>(buffer.d + col, _mm512_maskz_set1_epi32(result, 1));
-                    }
-                }
+                    Detect32fi<false>(hid, p_offset, pq_offset, col, tailMasks, buffer, skip, survivors);
                 if (col < evenWidth)
                 {
-                    __mmask16 result = _mm512_cmpneq_epi32_mask(_mm512_and_si512((Load<false, true>((uint32_t*)buffer.m + col / 2, tailMasks[2])), K32_0000FFFF), K_ZERO);
-                    if (result)
-                    {
-                        __m512 norm = Norm32fi<true>(hid, pq_offset + col, tailMasks);
-                        result = Detect32f<true>(hid, p_offset + col / 2, norm, result);
-                        Store<false, true>((uint32_t*)buffer.d + col / 2, _mm512_maskz_set1_epi32(result, 1), tailMasks[2]);
-                    }
-                    col += HA;
+                    Detect32fi<true>(hid, p_offset, pq_offset, col, tailMasks, buffer, skip, survivors);
+                    col = evenWidth;
                 }
                 for (; col < width; col += step)
                 {
-                    if (mask.At<uint8_t>(col + rect.left, row) == 0)
+                    skip.d[col] = 0;
+                    if (mask.At<uint8_t>(col + rect.left, row) == 0 || skip.m[col])
                         continue;
+                    uint8_t strong;
                     float norm = Base::Norm32f(hid, pq_offset + col);
-                    if (Base::Detect32f(hid, p_offset + col / 2, 0, norm) > 0)
+                    if (Base::Detect32f(hid, p_offset + col / 2, norm, strong) > 0)
                         dst.At<uint8_t>(col + rect.left, row) = 1;
+                    skip.d[col] = strong;
+                }
+                for (size_t i = 0; i < survivors.count; ++i)
+                {
+                    if (Base::Detect32f(hid, p_offset + survivors.index[i] / 2, 1, survivors.norm[i]) > 0)
+                        buffer.d[survivors.index[i]] = 1;
                 }
                 PackResult16i(buffer.d, evenWidth, dst.data + row*dst.stride + rect.left);
+                Swap(skip.m, skip.d);
             }
         }
 
@@ -607,29 +664,28 @@ namespace Simd
             return _mm512_cmpneq_epi16_mask(value, K_ZERO);
         }
 
+        template<bool masked> SIMD_INLINE __m512i StageSum(const HidLbpCascade<int, uint16_t> & hid, const HidLbpStage<int> & stage, size_t offset, __mmask32 tail)
+        {
+            size_t subsetSize = (hid.ncategories + 31) / 32;
+            __m512i sum = _mm512_setzero_si512();
+            for (int node = stage.first, end = stage.first + stage.ntrees; node < end; ++node)
+            {
+                const HidLbpFeature<uint16_t> & feature = hid.features[hid.nodes[node].featureIdx];
+                __mmask32 mask = LeafMask<masked>(feature, offset, hid.subsets.data() + node*subsetSize, tail);
+                sum = _mm512_add_epi16(sum, _mm512_mask_blend_epi16(mask, _mm512_set1_epi16(hid.leaves[2 * node + 1]), _mm512_set1_epi16(hid.leaves[2 * node + 0])));
+            }
+            return sum;
+        }
+
         template<bool masked> __mmask32 Detect(const HidLbpCascade<int, uint16_t> & hid, size_t offset, int startStage, __mmask32 result)
         {
             typedef HidLbpCascade<int, uint16_t> Hid;
 
-            size_t subsetSize = (hid.ncategories + 31) / 32;
-            const int * subsets = hid.subsets.data();
-            const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
-            int nodeOffset = 0, leafOffset = 0;
-            for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
+            for (int i_stage = startStage, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
             {
                 const Hid::Stage & stage = stages[i_stage];
-                __m512i sum = _mm512_setzero_si512();
-                for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
-                {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
-                    const int * subset = subsets + nodeOffset*subsetSize;
-                    __mmask32 mask = LeafMask<masked>(feature, offset, subset, result);
-                    sum = _mm512_add_epi16(sum, _mm512_mask_blend_epi16(mask, _mm512_set1_epi16(leaves[leafOffset + 1]), _mm512_set1_epi16(leaves[leafOffset + 0])));
-                    nodeOffset++;
-                    leafOffset += 2;
-                }
+                __m512i sum = StageSum<masked>(hid, stage, offset, result);
                 result = result & _mm512_cmpge_epi16_mask(sum, _mm512_set1_epi16(stage.threshold));
                 if (!result)
                     return result;
@@ -688,6 +744,31 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        template <bool masked> SIMD_INLINE void Detect16ii(const HidLbpCascade<int, uint16_t> & hid, size_t offset, size_t col, __mmask32 tail,
+            const uint8_t * m, uint8_t * d, Buffer<uint8_t> & skip, Survivors & survivors)
+        {
+            __mmask32 result = _mm512_cmpneq_epi16_mask(_mm512_and_si512((Load<false, masked>((uint16_t*)(m + col), tail)), K16_00FF), K_ZERO);
+            result = result & ~_mm512_cmpneq_epi16_mask(_mm512_and_si512((Load<false, masked>((uint16_t*)(skip.m + col), tail)), K16_00FF), K_ZERO);
+            __mmask32 strong = 0;
+            if (result)
+            {
+                __m512i sum = StageSum<masked>(hid, hid.stages[0], offset + col / 2, result);
+                strong = result & _mm512_cmplt_epi16_mask(sum, _mm512_set1_epi16(hid.skipThreshold));
+                result = result & _mm512_cmpge_epi16_mask(sum, _mm512_set1_epi16(hid.stages[0].threshold));
+                if (_mm_popcnt_u32(result) >= 8)
+                {
+                    result = Detect<masked>(hid, offset + col / 2, 1, result);
+                    Store<false, masked>((uint16_t*)(d + col), _mm512_maskz_set1_epi16(result, 1), tail);
+                }
+                else
+                {
+                    for (; result; result &= result - 1)
+                        survivors.index[survivors.count++] = uint32_t(col + 2 * _tzcnt_u32(result));
+                }
+            }
+            Store<false, masked>((uint16_t*)(skip.d + col), _mm512_maskz_set1_epi16(strong, 1), tail);
+        }
+
         void DetectionLbpDetect16ii(const HidLbpCascade<int, uint16_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
             const size_t step = 2;
@@ -696,38 +777,37 @@ namespace Simd
             __mmask32 tailMask = TailMask32((width - alignedWidth) / 2);
             size_t evenWidth = Simd::AlignLo(width, 2);
 
+            Buffer<uint8_t> skip(width);
+            memset(skip.m, 0, width);
+            Survivors survivors(width);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += step)
             {
                 size_t col = 0;
                 size_t offset = row * hid.isum.stride / sizeof(uint16_t) + rect.left / 2;
                 const uint8_t * m = mask.data + row*mask.stride + rect.left;
                 uint8_t * d = dst.data + row*dst.stride + rect.left;
+                survivors.count = 0;
                 for (; col < alignedWidth; col += A)
-                {
-                    __mmask32 result = _mm512_cmpneq_epi16_mask(_mm512_and_si512(Load<false>(m + col), K16_00FF), K_ZERO);
-                    if (result)
-                    {
-                        result = Detect<false>(hid, offset + col / 2, 0, result);
-                        Store<false>(d + col, _mm512_maskz_set1_epi16(result, 1));
-                    }
-                }
+                    Detect16ii<false>(hid, offset, col, -1, m, d, skip, survivors);
                 if (col < evenWidth)
                 {
-                    __mmask32 result = _mm512_cmpneq_epi16_mask(_mm512_and_si512((Load<false, true>((uint16_t*)m + col / 2, tailMask)), K16_00FF), K_ZERO);
-                    if (result)
-                    {
-                        result = Detect<true>(hid, offset + col / 2, 0, result);
-                        Store<false, true>((uint16_t*)d + col / 2, _mm512_maskz_set1_epi16(result, 1), tailMask);
-                    }
-                    col += A;
+                    Detect16ii<true>(hid, offset, col, tailMask, m, d, skip, survivors);
+                    col = evenWidth;
                 }
                 for (; col < width; col += step)
                 {
-                    if (mask.At<uint8_t>(col + rect.left, row) == 0)
+                    skip.d[col] = 0;
+                    if (m[col] == 0 || skip.m[col])
                         continue;
-                    if (Base::Detect(hid, offset + col / 2, 0) > 0)
-                        dst.At<uint8_t>(col + rect.left, row) = 1;
+                    if (Base::Detect(hid, offset + col / 2, skip.d[col]) > 0)
+                        d[col] = 1;
+                }
+                for (size_t i = 0; i < survivors.count; ++i)
+                {
+                    if (Base::Detect(hid, offset + survivors.index[i] / 2, 1) > 0)
+                        d[survivors.index[i]] = 1;
                 }
+                Swap(skip.m, skip.d);
             }
         }
 
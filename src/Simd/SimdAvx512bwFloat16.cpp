@@ -25,6 +25,7 @@
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -685,6 +686,30 @@ namespace Simd
                 }
             }
         }
+
+        static size_t CosineSelect32f(const float * src, size_t size, float threshold, uint32_t * indices)
+        {
+            size_t count = 0;
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            for (size_t i = 0; i < size; i += F)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                uint32_t mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + i), _threshold, _CMP_LE_OQ);
+                for (; mask; mask &= mask - 1)
+                    indices[count++] = uint32_t(i + _tzcnt_u32(mask));
+            }
+            return count;
+        }
+
+        void SquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums)
+        {
+            Base::SquareSums16f(N, K, A, sums, Squares);
+        }
+
+        void CosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances)
+        {
+            Base::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances, Squares, MacroCosineDistances, CosineSelect32f);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
@@ -203,7 +203,7 @@ namespace Simd
             }
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -213,7 +213,7 @@ namespace Simd
             const size_t step = A * N;
             ptrdiff_t previous = -2;
             __m512i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
@@ -252,7 +252,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -260,7 +260,7 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m512i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
@@ -297,22 +297,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, dst, dstStride, buffer);
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, dst, dstStride, buffer);
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); break;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); break;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); break;
             default:
                 assert(0);
             }
@@ -464,7 +463,7 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
@@ -473,7 +472,7 @@ namespace Simd
             __mmask64 tail = TailMask64(rowSize - rowSizeA);
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = (int32_t*)buffer;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, rowSizeA, ay[dy], ay0, ay[dy + 1], buf, tail), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -484,14 +483,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, buffer); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); return;
             default:
                 assert(0);
             }
@@ -503,7 +502,11 @@ namespace Simd
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512i));
             if (param.IsByteBilinear() && dstX >= A)
-                return new ResizerByteBilinear(param);
+            {
+                ResizerByteBilinear * resizer = new ResizerByteBilinear(param);
+                resizer->EstimateParams();
+                return resizer;
+            }
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
             else
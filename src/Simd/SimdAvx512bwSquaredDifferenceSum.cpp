@@ -25,6 +25,7 @@
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -89,6 +90,79 @@ namespace Simd
             *sum = ExtractSum<uint64_t>(_sum);
         }
 
+        template <int n> void SquaredDifferenceSums1xN(const uint8_t * a, const uint8_t * b, size_t bStride, size_t K, uint32_t threshold, uint32_t * sums)
+        {
+            const size_t KB = 256, K32 = AlignLo(K, 32);
+            const __mmask32 tail = TailMask32(K - K32);
+            __m512i _sums[n];
+            for (int j = 0; j < n; ++j)
+                _sums[j] = _mm512_setzero_si512();
+            for (size_t kb = 0; kb < K32; kb += KB)
+            {
+                for (size_t k = kb, ke = Simd::Min(kb + KB, K32); k < ke; k += 32)
+                {
+                    const __m512i _a = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(a + k)));
+                    for (int j = 0; j < n; ++j)
+                    {
+                        const __m512i d = _mm512_sub_epi16(_a, _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(b + j*bStride + k))));
+                        _sums[j] = _mm512_add_epi32(_sums[j], _mm512_madd_epi16(d, d));
+                    }
+                }
+                if (threshold != UINT32_MAX && kb + KB < K)
+                {
+                    int exceeded = 0;
+                    for (int j = 0; j < n; ++j)
+                        exceeded += ExtractSum<uint32_t>(_sums[j]) > threshold ? 1 : 0;
+                    if (exceeded == n)
+                    {
+                        for (int j = 0; j < n; ++j)
+                            sums[j] = UINT32_MAX;
+                        return;
+                    }
+                }
+            }
+            if (tail)
+            {
+                const __m512i _a = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, a + K32));
+                for (int j = 0; j < n; ++j)
+                {
+                    const __m512i d = _mm512_sub_epi16(_a, _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, b + j*bStride + K32)));
+                    _sums[j] = _mm512_add_epi32(_sums[j], _mm512_madd_epi16(d, d));
+                }
+            }
+            for (int j = 0; j < n; ++j)
+            {
+                uint32_t sum = ExtractSum<uint32_t>(_sums[j]);
+                sums[j] = sum > threshold ? UINT32_MAX : sum;
+            }
+        }
+
+        static void SquaredDifferenceSumsMxN(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums, size_t sumsStride)
+        {
+            size_t N4 = AlignLo(N, 4);
+            for (size_t i = 0; i < M; ++i)
+            {
+                const uint8_t * a = A + i*aStride;
+                uint32_t * s = sums + i*sumsStride;
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    SquaredDifferenceSums1xN<4>(a, B + j*bStride, bStride, K, threshold, s + j);
+                switch (N - N4)
+                {
+                case 1: SquaredDifferenceSums1xN<1>(a, B + j*bStride, bStride, K, threshold, s + j); break;
+                case 2: SquaredDifferenceSums1xN<2>(a, B + j*bStride, bStride, K, threshold, s + j); break;
+                case 3: SquaredDifferenceSums1xN<3>(a, B + j*bStride, bStride, K, threshold, s + j); break;
+                }
+            }
+        }
+
+        void SquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums)
+        {
+            Base::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums, SquaredDifferenceSumsMxN);
+        }
+
         void SquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
             size_t width, size_t height, uint64_t * sum)
         {
@@ -30,17 +30,17 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
-        template <bool align, bool mask> SIMD_INLINE void YuvToBgr(const __m512i & y, const __m512i & u, const __m512i & v, uint8_t * bgr, const __mmask64 * tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void YuvToBgr(const __m512i & y, const __m512i & u, const __m512i & v, uint8_t * bgr, const __mmask64 * tails)
         {
-            __m512i blue = YuvToBlue(y, u);
-            __m512i green = YuvToGreen(y, u, v);
-            __m512i red = YuvToRed(y, v);
+            __m512i blue = YuvToBlue<T>(y, u);
+            __m512i green = YuvToGreen<T>(y, u, v);
+            __m512i red = YuvToRed<T>(y, v);
             Store<align, mask>(bgr + 0 * A, InterleaveBgr<0>(blue, green, red), tails[0]);
             Store<align, mask>(bgr + 1 * A, InterleaveBgr<1>(blue, green, red), tails[1]);
             Store<align, mask>(bgr + 2 * A, InterleaveBgr<2>(blue, green, red), tails[2]);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv420pToBgr(const uint8_t * y0, const uint8_t * y1, const uint8_t * u, const uint8_t * v, uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void Yuv420pToBgr(const uint8_t * y0, const uint8_t * y1, const uint8_t * u, const uint8_t * v, uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
             __m512i u0 = UnpackU8<0>(_u, _u);
@@ -48,13 +48,13 @@ namespace Simd
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
             __m512i v0 = UnpackU8<0>(_v, _v);
             __m512i v1 = UnpackU8<1>(_v, _v);
-            YuvToBgr<align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, bgr0 + 0 * A, tails + 3);
-            YuvToBgr<align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, bgr0 + 3 * A, tails + 6);
-            YuvToBgr<align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, bgr1 + 0 * A, tails + 3);
-            YuvToBgr<align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, bgr1 + 3 * A, tails + 6);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, bgr0 + 0 * A, tails + 3);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, bgr0 + 3 * A, tails + 6);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, bgr1 + 0 * A, tails + 3);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, bgr1 + 3 * A, tails + 6);
         }
 
-        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0));
@@ -77,9 +77,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv420pToBgr<align, false>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                    Yuv420pToBgr<T, align, false>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
                 if (col < width)
-                    Yuv420pToBgr<align, true>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                    Yuv420pToBgr<T, align, true>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -87,25 +87,112 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool mask, bool swap> SIMD_INLINE void NvToBgr(const uint8_t * y0, const uint8_t * y1, const uint8_t * uv,
+            uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
+        {
+            __m512i _u, _v;
+            LoadUv<align, mask, swap>(uv, _u, _v, tails + 1);
+            __m512i u0 = UnpackU8<0>(_u, _u);
+            __m512i u1 = UnpackU8<1>(_u, _u);
+            __m512i v0 = UnpackU8<0>(_v, _v);
+            __m512i v1 = UnpackU8<1>(_v, _v);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, bgr0 + 0 * A, tails + 3);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, bgr0 + 3 * A, tails + 6);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, bgr1 + 0 * A, tails + 3);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, bgr1 + 3 * A, tails + 6);
+        }
+
+        template <class T, bool align, bool swap> void NvToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[9];
+            tailMasks[0] = TailMask64(tail);
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[1 + i] = TailMask64(tail * 2 - A * i);
+            for (size_t i = 0; i < 6; ++i)
+                tailMasks[3 + i] = TailMask64(tail * 6 - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    NvToBgr<T, align, false, swap>(y + col * 2, y + yStride + col * 2, uv + col * 2, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                if (col < width)
+                    NvToBgr<T, align, true, swap>(y + col * 2, y + yStride + col * 2, uv + col * 2, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T, bool swap> void NvToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                NvToBgr<T, true, swap>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+            else
+                NvToBgr<T, false, swap>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            NvToBgr<Base::Bt601, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            NvToBgr<Base::Bt601, true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
-            YuvToBgr<align, mask>(Load<align, mask>(y + 0, tails[1]), _mm512_unpacklo_epi8(_u, _u), _mm512_unpacklo_epi8(_v, _v), bgr + 0 * A, tails + 3);
-            YuvToBgr<align, mask>(Load<align, mask>(y + A, tails[2]), _mm512_unpackhi_epi8(_u, _u), _mm512_unpackhi_epi8(_v, _v), bgr + 3 * A, tails + 6);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y + 0, tails[1]), _mm512_unpacklo_epi8(_u, _u), _mm512_unpacklo_epi8(_v, _v), bgr + 0 * A, tails + 3);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y + A, tails[2]), _mm512_unpackhi_epi8(_u, _u), _mm512_unpackhi_epi8(_v, _v), bgr + 3 * A, tails + 6);
         }
 
-        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0));
@@ -128,9 +215,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv422pToBgr<align, false>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
+                    Yuv422pToBgr<T, align, false>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
                 if (col < width)
-                    Yuv422pToBgr<align, true>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
+                    Yuv422pToBgr<T, align, true>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -138,22 +225,44 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
         {
-            YuvToBgr<align, mask>(Load<align, mask>(y, tails[0]), Load<align, mask>(u, tails[0]), Load<align, mask>(v, tails[0]), bgr, tails + 1);
+            YuvToBgr<T, align, mask>(Load<align, mask>(y, tails[0]), Load<align, mask>(u, tails[0]), Load<align, mask>(v, tails[0]), bgr, tails + 1);
         }
 
-        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (align)
@@ -172,9 +281,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv444pToBgr<align, false>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
+                    Yuv444pToBgr<T, align, false>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
                 if (col < width)
-                    Yuv444pToBgr<align, true>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
+                    Yuv444pToBgr<T, align, true>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -182,29 +291,51 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
         }
 
         //---------------------------------------------------------------------
 
-        template <bool align, bool mask> SIMD_INLINE void YuvToRgb(const __m512i& y, const __m512i& u, const __m512i& v, uint8_t* rgb, const __mmask64* tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void YuvToRgb(const __m512i& y, const __m512i& u, const __m512i& v, uint8_t* rgb, const __mmask64* tails)
         {
-            __m512i blue = YuvToBlue(y, u);
-            __m512i green = YuvToGreen(y, u, v);
-            __m512i red = YuvToRed(y, v);
+            __m512i blue = YuvToBlue<T>(y, u);
+            __m512i green = YuvToGreen<T>(y, u, v);
+            __m512i red = YuvToRed<T>(y, v);
             Store<align, mask>(rgb + 0 * A, InterleaveBgr<0>(red, green, blue), tails[0]);
             Store<align, mask>(rgb + 1 * A, InterleaveBgr<1>(red, green, blue), tails[1]);
             Store<align, mask>(rgb + 2 * A, InterleaveBgr<2>(red, green, blue), tails[2]);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv420pToRgb(const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v, uint8_t* rgb0, uint8_t* rgb1, const __mmask64* tails)
+        template <class T, bool align, bool mask> SIMD_INLINE void Yuv420pToRgb(const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v, uint8_t* rgb0, uint8_t* rgb1, const __mmask64* tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
             __m512i u0 = UnpackU8<0>(_u, _u);
@@ -212,13 +343,13 @@ namespace Simd
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
             __m512i v0 = UnpackU8<0>(_v, _v);
             __m512i v1 = UnpackU8<1>(_v, _v);
-            YuvToRgb<align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, rgb0 + 0 * A, tails + 3);
-            YuvToRgb<align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, rgb0 + 3 * A, tails + 6);
-            YuvToRgb<align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, rgb1 + 0 * A, tails + 3);
-            YuvToRgb<align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, rgb1 + 3 * A, tails + 6);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, rgb0 + 0 * A, tails + 3);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, rgb0 + 3 * A, tails + 6);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, rgb1 + 0 * A, tails + 3);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, rgb1 + 3 * A, tails + 6);
         }
 
-        template <bool align> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T, bool align> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0));
@@ -241,9 +372,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv420pToRgb<align, false>(y + col * 2, y + yStride + col * 2, u + col, v + col, rgb + col * 6, rgb + rgbStride + col * 6, tailMasks);
+                    Yuv420pToRgb<T, align, false>(y + col * 2, y + yStride + col * 2, u + col, v + col, rgb + col * 6, rgb + rgbStride + col * 6, tailMasks);
                 if (col < width)
-                    Yuv420pToRgb<align, true>(y + col * 2, y + yStride + col * 2, u + col, v + col, rgb + col * 6, rgb + rgbStride + col * 6, tailMasks);
+                    Yuv420pToRgb<T, align, true>(y + col * 2, y + yStride + col * 2, u + col, v + col, rgb + col * 6, rgb + rgbStride + col * 6, tailMasks);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -251,25 +382,112 @@ namespace Simd
             }
         }
 
-        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv420pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv420pToRgb<T, true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv420pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv420pToRgb<T, false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv420pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv420pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv420pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv420pToRgb<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv420pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv420pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool mask, bool swap> SIMD_INLINE void NvToRgb(const uint8_t * y0, const uint8_t * y1, const uint8_t * uv,
+            uint8_t * rgb0, uint8_t * rgb1, const __mmask64 * tails)
+        {
+            __m512i _u, _v;
+            LoadUv<align, mask, swap>(uv, _u, _v, tails + 1);
+            __m512i u0 = UnpackU8<0>(_u, _u);
+            __m512i u1 = UnpackU8<1>(_u, _u);
+            __m512i v0 = UnpackU8<0>(_v, _v);
+            __m512i v1 = UnpackU8<1>(_v, _v);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, rgb0 + 0 * A, tails + 3);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, rgb0 + 3 * A, tails + 6);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, rgb1 + 0 * A, tails + 3);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, rgb1 + 3 * A, tails + 6);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb, const __mmask64* tails)
+        template <class T, bool align, bool swap> void NvToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(rgb) && Aligned(rgbStride));
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[9];
+            tailMasks[0] = TailMask64(tail);
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[1 + i] = TailMask64(tail * 2 - A * i);
+            for (size_t i = 0; i < 6; ++i)
+                tailMasks[3 + i] = TailMask64(tail * 6 - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    NvToRgb<T, align, false, swap>(y + col * 2, y + yStride + col * 2, uv + col * 2, rgb + col * 6, rgb + rgbStride + col * 6, tailMasks);
+                if (col < width)
+                    NvToRgb<T, align, true, swap>(y + col * 2, y + yStride + col * 2, uv + col * 2, rgb + col * 6, rgb + rgbStride + col * 6, tailMasks);
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        template <class T, bool swap> void NvToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(rgb) && Aligned(rgbStride))
+                NvToRgb<T, true, swap>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+            else
+                NvToRgb<T, false, swap>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            NvToRgb<Base::Bt601, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            NvToRgb<Base::Bt601, true>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb, const __mmask64* tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
-            YuvToRgb<align, mask>(Load<align, mask>(y + 0, tails[1]), _mm512_unpacklo_epi8(_u, _u), _mm512_unpacklo_epi8(_v, _v), rgb + 0 * A, tails + 3);
-            YuvToRgb<align, mask>(Load<align, mask>(y + A, tails[2]), _mm512_unpackhi_epi8(_u, _u), _mm512_unpackhi_epi8(_v, _v), rgb + 3 * A, tails + 6);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y + 0, tails[1]), _mm512_unpacklo_epi8(_u, _u), _mm512_unpacklo_epi8(_v, _v), rgb + 0 * A, tails + 3);
+            YuvToRgb<T, align, mask>(Load<align, mask>(y + A, tails[2]), _mm512_unpackhi_epi8(_u, _u), _mm512_unpackhi_epi8(_v, _v), rgb + 3 * A, tails + 6);
         }
 
-        template <bool align> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T, bool align> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0));
@@ -292,9 +510,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv422pToRgb<align, false>(y + col * 2, u + col, v + col, rgb + col * 6, tailMasks);
+                    Yuv422pToRgb<T, align, false>(y + col * 2, u + col, v + col, rgb + col * 6, tailMasks);
                 if (col < width)
-                    Yuv422pToRgb<align, true>(y + col * 2, u + col, v + col, rgb + col * 6, tailMasks);
+                    Yuv422pToRgb<T, align, true>(y + col * 2, u + col, v + col, rgb + col * 6, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -302,22 +520,44 @@ namespace Simd
             }
         }
 
-        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv422pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv422pToRgb<T, true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv422pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv422pToRgb<T, false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv444pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb, const __mmask64* tails)
+        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
-            YuvToRgb<align, mask>(Load<align, mask>(y, tails[0]), Load<align, mask>(u, tails[0]), Load<align, mask>(v, tails[0]), rgb, tails + 1);
+            Yuv422pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv422pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv422pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv422pToRgb<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv422pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv422pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void Yuv444pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb, const __mmask64* tails)
+        {
+            YuvToRgb<T, align, mask>(Load<align, mask>(y, tails[0]), Load<align, mask>(u, tails[0]), Load<align, mask>(v, tails[0]), rgb, tails + 1);
+        }
+
+        template <class T, bool align> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (align)
@@ -336,9 +576,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv444pToRgb<align, false>(y + col, u + col, v + col, rgb + col * 3, tailMasks);
+                    Yuv444pToRgb<T, align, false>(y + col, u + col, v + col, rgb + col * 3, tailMasks);
                 if (col < width)
-                    Yuv444pToRgb<align, true>(y + col, u + col, v + col, rgb + col * 3, tailMasks);
+                    Yuv444pToRgb<T, align, true>(y + col, u + col, v + col, rgb + col * 3, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -346,14 +586,36 @@ namespace Simd
             }
         }
 
-        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv444pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv444pToRgb<T, true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv444pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv444pToRgb<T, false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv444pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv444pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv444pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv444pToRgb<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv444pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv444pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
         }
     }
 #endif// SIMD_AVX2_ENABLE
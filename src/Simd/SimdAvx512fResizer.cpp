@@ -37,11 +37,11 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buffer, buffer + _rowSize / sizeof(float) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx512f::F);
             __mmask16 tail = TailMask16(rs - rsa);
@@ -24,6 +24,9 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdAvx512f.h"
 
 namespace Simd
 {
@@ -79,6 +82,64 @@ namespace Simd
                 _sum = _mm512_fmadd_ps((Load<true, true>(buffer.sums + i, tailMask)), (Load<false, true>(weights + i, tailMask)), _sum);
             *sum = ExtractSum(_sum);
         }
+
+        //---------------------------------------------------------------------
+
+        SvmKernel::SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights)
+            : Base::SvmKernel(param, svs, weights)
+        {
+            _gemm = Avx512f::Gemm32fNN;
+        }
+
+        SIMD_INLINE __m512 SvmKernelValue(const SvmKernelParam & param, const Exp & exp, __m512 dot, __m512 norm, __m512 svNorm)
+        {
+            if (param.type == SimdSvmKernelPolynomial)
+            {
+                __m512 value = _mm512_fmadd_ps(_mm512_set1_ps(param.gamma), dot, _mm512_set1_ps(param.coef0)), kernel = value;
+                for (int i = 1; i < param.degree; ++i)
+                    kernel = _mm512_mul_ps(kernel, value);
+                return kernel;
+            }
+            else if (param.type == SimdSvmKernelRbf)
+            {
+                __m512 distance = _mm512_fnmadd_ps(_mm512_set1_ps(2.0f), dot, _mm512_add_ps(norm, svNorm));
+                return exp.Exponent(_mm512_max_ps(distance, _mm512_setzero_ps()));
+            }
+            else
+                return dot;
+        }
+
+        void SvmKernel::Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const
+        {
+            const SvmKernelParam & p = _param;
+            size_t countF = AlignLo(count, F);
+            __mmask16 tail = TailMask16(count - countF);
+            Exp exp(-p.gamma);
+            for (size_t b = 0; b < batch; ++b, dot += count)
+            {
+                __m512 _sum = _mm512_setzero_ps(), norm = _mm512_set1_ps(norms[b]);
+                size_t c = 0;
+                for (; c < countF; c += F)
+                {
+                    __m512 kernel = SvmKernelValue(p, exp, Load<false>(dot + c), norm, Load<false>(svNorms + c));
+                    _sum = _mm512_fmadd_ps(Load<false>(weights + c), kernel, _sum);
+                }
+                if (c < count)
+                {
+                    __m512 kernel = SvmKernelValue(p, exp, Load<false, true>(dot + c, tail), norm, Load<false, true>(svNorms + c, tail));
+                    _sum = _mm512_fmadd_ps(Load<false, true>(weights + c, tail), kernel, _sum);
+                }
+                sum[b] += ExtractSum(_sum);
+            }
+        }
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree)
+        {
+            SvmKernelParam param(length, count, type, gamma, coef0, degree);
+            if (!param.Valid())
+                return NULL;
+            return new Avx512f::SvmKernel(param, svs, weights);
+        }
     }
 #endif// SIMD_AVX512F_ENABLE
 }
@@ -31,6 +31,7 @@ namespace Simd
 #ifdef SIMD_AVX512VNNI_ENABLE    
     namespace Avx512vnni
     {
+        void SquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride, const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums);
     }
 #endif// SIMD_AVX512VNNI_ENABLE
 }
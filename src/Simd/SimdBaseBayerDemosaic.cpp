@@ -0,0 +1,158 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> void BayerLoadRow(const T * src, size_t width, int32_t even, int32_t odd, int32_t max, int32_t * dst)
+        {
+            for (size_t x = 0; x < width; x += 2)
+            {
+                dst[x + 0] = Min((src[x + 0] * even + BAYER_GAIN_ROUND) >> BAYER_GAIN_SHIFT, max);
+                dst[x + 1] = Min((src[x + 1] * odd + BAYER_GAIN_ROUND) >> BAYER_GAIN_SHIFT, max);
+            }
+        }
+
+        /* All results are scaled by 16: center - C, green at red/blue - Gx, horizontal neighbor color at green - Hn, 
+           vertical neighbor color at green - Vn, diagonal color at red/blue - Dg. */
+        template<SimdBayerDemosaicType demosaic> SIMD_INLINE void BayerDemosaic(const int32_t * const * r, size_t x,
+            int32_t & c, int32_t & gx, int32_t & hn, int32_t & vn, int32_t & dg)
+        {
+            int32_t r2 = r[2][x];
+            int32_t h2 = r[2][x - 1] + r[2][x + 1], v2 = r[1][x] + r[3][x];
+            int32_t d4 = r[1][x - 1] + r[1][x + 1] + r[3][x - 1] + r[3][x + 1];
+            c = r2 * 16;
+            if (demosaic == SimdBayerDemosaicMhc)
+            {
+                int32_t hh = r[2][x - 2] + r[2][x + 2], vv = r[0][x] + r[4][x];
+                gx = r2 * 8 + (h2 + v2) * 4 - (hh + vv) * 2;
+                hn = r2 * 10 + h2 * 8 - (hh + d4) * 2 + vv;
+                vn = r2 * 10 + v2 * 8 - (vv + d4) * 2 + hh;
+                dg = r2 * 12 + d4 * 4 - (hh + vv) * 3;
+            }
+            else
+            {
+                int32_t dh = Simd::Abs(r[2][x - 2] - r[2][x + 2]), dv = Simd::Abs(r[0][x] - r[4][x]);
+                hn = h2 * 8;
+                vn = v2 * 8;
+                dg = d4 * 4;
+                gx = dv < dh ? vn : (dv > dh ? hn : (h2 + v2) * 4);
+            }
+        }
+
+        SIMD_INLINE uint8_t BayerOutput(int32_t value, int32_t round, int shift)
+        {
+            return (uint8_t)RestrictRange((value + round) >> shift, 0, 255);
+        }
+
+        template<SimdBayerDemosaicType demosaic, size_t channels> void BayerDemosaicRow(const int32_t * const * r, size_t width, 
+            bool redRow, bool greenEven, size_t bitDepth, uint8_t alpha, uint8_t * dst)
+        {
+            int shift = int(bitDepth) - 4, round = 1 << (shift - 1);
+            int32_t c, gx, hn, vn, dg;
+            for (size_t x = 0; x < width; ++x, dst += channels)
+            {
+                BayerDemosaic<demosaic>(r, x, c, gx, hn, vn, dg);
+                bool green = ((x & 1) == 0) == greenEven;
+                int32_t blue = green ? (redRow ? vn : hn) : (redRow ? dg : c);
+                int32_t red = green ? (redRow ? hn : vn) : (redRow ? c : dg);
+                dst[0] = BayerOutput(blue, round, shift);
+                dst[1] = BayerOutput(green ? c : gx, round, shift);
+                dst[2] = BayerOutput(red, round, shift);
+                if (channels == 4)
+                    dst[3] = alpha;
+            }
+        }
+
+        template<class T, SimdBayerDemosaicType demosaic, size_t channels> void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride,
+            SimdPixelFormatType bayerFormat, size_t bitDepth, const float * gains, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            BayerRows rows(width, height, bitDepth, gains);
+            const int32_t * r[5];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (ptrdiff_t i = 0; i < 5; ++i)
+                {
+                    size_t index = rows.Index(ptrdiff_t(row) + i - 2);
+                    bool load;
+                    int32_t * p = rows.Row(index, load);
+                    if (load)
+                    {
+                        int32_t even, odd;
+                        rows.Gains(bayerFormat, index, even, odd);
+                        BayerLoadRow((const T*)(bayer + index * bayerStride), width, even, odd, rows.Max(), p);
+                        rows.Pad(p);
+                    }
+                    r[i] = p;
+                }
+                bool redRow, greenEven;
+                BayerRowType(bayerFormat, row, redRow, greenEven);
+                BayerDemosaicRow<demosaic, channels>(r, width, redRow, greenEven, bitDepth, alpha, dst);
+                dst += dstStride;
+            }
+        }
+
+        template<size_t channels> void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride,
+            SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && bitDepth >= 8 && bitDepth <= 16);
+
+            if (bitDepth == 8)
+            {
+                if (demosaic == SimdBayerDemosaicMhc)
+                    BayerToBgrV2<uint8_t, SimdBayerDemosaicMhc, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+                else
+                    BayerToBgrV2<uint8_t, SimdBayerDemosaicBilinear, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+            }
+            else
+            {
+                if (demosaic == SimdBayerDemosaicMhc)
+                    BayerToBgrV2<uint16_t, SimdBayerDemosaicMhc, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+                else
+                    BayerToBgrV2<uint16_t, SimdBayerDemosaicBilinear, channels>(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, dst, dstStride, alpha);
+            }
+        }
+
+        void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, 
+            size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgr, size_t bgrStride)
+        {
+            if (bitDepth == 8 && demosaic == SimdBayerDemosaicBilinear && gains == NULL)
+                BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+            else
+                BayerToBgrV2<3>(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgr, bgrStride, 0xFF);
+        }
+
+        void BayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, 
+            size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if (bitDepth == 8 && demosaic == SimdBayerDemosaicBilinear && gains == NULL)
+                BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+            else
+                BayerToBgrV2<4>(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgra, bgraStride, alpha);
+        }
+    }
+}
@@ -28,25 +28,25 @@ namespace Simd
 {
     namespace Base
     {
-        SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <class T> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
         {
             const uint8_t * bgr1 = bgr0 + bgrStride;
             uint8_t * y1 = y0 + yStride;
 
-            y0[0] = BgrToY(bgr0[0], bgr0[1], bgr0[2]);
-            y0[1] = BgrToY(bgr0[3], bgr0[4], bgr0[5]);
-            y1[0] = BgrToY(bgr1[0], bgr1[1], bgr1[2]);
-            y1[1] = BgrToY(bgr1[3], bgr1[4], bgr1[5]);
+            y0[0] = BgrToY<T>(bgr0[0], bgr0[1], bgr0[2]);
+            y0[1] = BgrToY<T>(bgr0[3], bgr0[4], bgr0[5]);
+            y1[0] = BgrToY<T>(bgr1[0], bgr1[1], bgr1[2]);
+            y1[1] = BgrToY<T>(bgr1[3], bgr1[4], bgr1[5]);
 
             int blue = Average(bgr0[0], bgr0[3], bgr1[0], bgr1[3]);
             int green = Average(bgr0[1], bgr0[4], bgr1[1], bgr1[4]);
             int red = Average(bgr0[2], bgr0[5], bgr1[2], bgr1[5]);
 
-            u[0] = BgrToU(blue, green, red);
-            v[0] = BgrToV(blue, green, red);
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
         }
 
-        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -55,7 +55,7 @@ namespace Simd
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < width; colY += 2, colUV++, colBgr += 6)
                 {
-                    BgrToYuv420p(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgrToYuv420p<T>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -64,20 +64,42 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
-            y[0] = BgrToY(bgr[0], bgr[1], bgr[2]);
-            y[1] = BgrToY(bgr[3], bgr[4], bgr[5]);
+            BgrToYuv420p<Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420p<Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420p<Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420p<Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv420p<Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv420p<Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv420p<Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            y[0] = BgrToY<T>(bgr[0], bgr[1], bgr[2]);
+            y[1] = BgrToY<T>(bgr[3], bgr[4], bgr[5]);
 
             int blue = Average(bgr[0], bgr[3]);
             int green = Average(bgr[1], bgr[4]);
             int red = Average(bgr[2], bgr[5]);
 
-            u[0] = BgrToU(blue, green, red);
-            v[0] = BgrToV(blue, green, red);
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
         }
 
-        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= 2));
@@ -85,7 +107,7 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < width; colY += 2, colUV++, colBgr += 6)
-                    BgrToYuv422p(bgr + colBgr, y + colY, u + colUV, v + colUV);
+                    BgrToYuv422p<T>(bgr + colBgr, y + colY, u + colUV, v + colUV);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -93,26 +115,70 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422p<Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422p<Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422p<Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv422p<Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv422p<Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv422p<Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             const int blue = bgr[0], green = bgr[1], red = bgr[2];
-            y[0] = BgrToY(blue, green, red);
-            u[0] = BgrToU(blue, green, red);
-            v[0] = BgrToV(blue, green, red);
+            y[0] = BgrToY<T>(blue, green, red);
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
         }
 
-        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgr = 0; col < width; ++col, colBgr += 3)
-                    BgrToYuv444p(bgr + colBgr, y + col, u + col, v + col);
+                    BgrToYuv444p<T>(bgr + colBgr, y + col, u + col, v + col);
                 y += yStride;
                 u += uStride;
                 v += vStride;
                 bgr += bgrStride;
             }
         }
+
+        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444p<Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444p<Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444p<Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv444p<Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv444p<Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv444p<Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 }
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdCrc32.h"
 
 namespace Simd
 {
@@ -579,11 +580,15 @@ namespace Simd
 #endif//SIMD_BIG_ENDIAN
         };
 
-        uint32_t Crc32c(const void * src, size_t size)
+        SIMD_INLINE uint32_t Crc32cRaw(uint32_t crc, const uint8_t * p, size_t size)
         {
-            const uint8_t * p = (const uint8_t*)src;
-            uint32_t crc = 0xFFFFFFFF;
-
+#ifdef SIMD_BIG_ENDIAN
+            crc =
+                ((crc << 24) & 0xFF000000) |
+                ((crc << 8) & 0x00FF0000) |
+                ((crc >> 8) & 0x0000FF00) |
+                ((crc >> 24) & 0x000000FF);
+#endif
             for (; ((uintptr_t)p & (sizeof(uint32_t) - 1)) != 0 && size > 0; ++p, --size)
             {
 #ifdef SIMD_BIG_ENDIAN
@@ -634,7 +639,31 @@ namespace Simd
             for (; size > 0; ++p, size--)
                 crc = Crc32cTable[0][(crc ^ *p) & 0xFF] ^ (crc >> 8);
 #endif
-            return (~crc);
+            return crc;
+        }
+
+        uint32_t Crc32c(const void * src, size_t size)
+        {
+            return ~Crc32cRaw(0xFFFFFFFF, (const uint8_t*)src, size);
+        }
+
+        uint32_t Crc32cUpdate(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height)
+        {
+            crc = ~crc;
+            for (size_t row = 0; row < height; ++row, src += stride)
+                crc = Crc32cRaw(crc, src, width);
+            return ~crc;
+        }
+
+        uint32_t Crc32cCombine(uint32_t crc1, uint32_t crc2, size_t size2)
+        {
+            return Crc32cMultModP(Crc32cShiftOperator(size2), crc1) ^ crc2;
+        }
+
+        void Crc32cBatch(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc)
+        {
+            for (size_t i = 0; i < count; ++i)
+                crc[i] = Crc32c(src[i], size[i]);
         }
     }
 }
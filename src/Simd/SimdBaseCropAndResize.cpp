@@ -0,0 +1,229 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCropAndResize.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> SIMD_INLINE void Reserve(Array<T> & array, size_t size)
+        {
+            if (array.size < size)
+                array.Resize(size);
+        }
+
+        SIMD_INLINE void AreaRange(size_t size, float begin, float scale, size_t i, float & b, float & e)
+        {
+            b = begin + i * scale;
+            e = b + scale;
+            if (b > e)
+                Swap(b, e);
+            b = Simd::RestrictRange(b, 0.0f, float(size));
+            e = Simd::RestrictRange(e, 0.0f, float(size));
+        }
+
+        static size_t EstimateTaps(SimdResizeMethodType method, size_t size, float begin, float end, size_t dstSize)
+        {
+            if (method == SimdResizeMethodBilinear)
+                return Simd::Min<size_t>(2, size);
+            float scale = (end - begin) / dstSize, b, e;
+            size_t taps = 1;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                AreaRange(size, begin, scale, i, b, e);
+                taps = Simd::Max(taps, size_t(::ceil(e)) - size_t(b));
+            }
+            return taps;
+        }
+
+        static void EstimateWeights(SimdResizeMethodType method, size_t size, float begin, float end, size_t dstSize, size_t taps, int32_t * index, float * weight)
+        {
+            float scale = (end - begin) / dstSize, b, e;
+            for (size_t i = 0; i < dstSize; ++i, weight += taps)
+            {
+                for (size_t t = 0; t < taps; ++t)
+                    weight[t] = 0.0f;
+                if (method == SimdResizeMethodBilinear)
+                {
+                    float pos = Simd::RestrictRange(begin + (i + 0.5f) * scale - 0.5f, 0.0f, float(size - 1));
+                    size_t lo = size_t(pos), start = Simd::Min(lo, size - taps);
+                    float alpha = pos - lo;
+                    index[i] = int32_t(start);
+                    weight[lo - start] += 1.0f - alpha;
+                    if (lo + 1 < size)
+                        weight[lo + 1 - start] += alpha;
+                }
+                else
+                {
+                    AreaRange(size, begin, scale, i, b, e);
+                    if (e > b)
+                    {
+                        size_t lo = size_t(b), hi = size_t(::ceil(e)), start = Simd::Min(lo, size - taps);
+                        index[i] = int32_t(start);
+                        for (size_t p = lo; p < hi; ++p)
+                            weight[p - start] = (Simd::Min(e, p + 1.0f) - Simd::Max(b, float(p))) / (e - b);
+                    }
+                    else
+                    {
+                        size_t p = Simd::Min(size_t(b), size - 1), start = Simd::Min(p, size - taps);
+                        index[i] = int32_t(start);
+                        weight[p - start] = 1.0f;
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        CropAndResize::CropAndResize(const CropAndResizeParam & param)
+            : _param(param)
+        {
+            const CropAndResizeParam & p = _param;
+            size_t C = p.channels, size = p.dstW * C;
+            _k.Resize(size);
+            _b.Resize(size);
+            SynetSetInputRowScale(p.lower, p.upper, C, p.dstW, _k.data, _b.data);
+        }
+
+        void CropAndResize::Run(const uint8_t * src, size_t srcStride, const float * rois, size_t roiCount, uint8_t * dst) const
+        {
+            const CropAndResizeParam & p = _param;
+            float whole[4] = { 0.0f, 0.0f, float(p.srcW), float(p.srcH) };
+            if (rois == NULL)
+                rois = whole, roiCount = 1;
+            size_t tensorSize = p.TensorSize();
+            Simd::Parallel(0, roiCount, [&](size_t thread, size_t begin, size_t end)
+            {
+                Buffer buf;
+                for (size_t i = begin; i < end; ++i)
+                    RunRoi(src, srcStride, rois + i * 4, buf, dst + i * tensorSize);
+            }, GetThreadNumber());
+        }
+
+        void CropAndResize::RunRoi(const uint8_t * src, size_t srcStride, const float * roi, Buffer & buf, uint8_t * dst) const
+        {
+            const CropAndResizeParam & p = _param;
+            size_t C = p.channels, W = p.dstW, H = p.dstH, size = W * C;
+            size_t tx = EstimateTaps(p.method, p.srcW, roi[0], roi[2], W);
+            size_t ty = EstimateTaps(p.method, p.srcH, roi[1], roi[3], H);
+            Reserve(buf.ix, W);
+            Reserve(buf.wx, W * tx);
+            Reserve(buf.iy, H);
+            Reserve(buf.wy, H * ty);
+            EstimateWeights(p.method, p.srcW, roi[0], roi[2], W, tx, buf.ix.data, buf.wx.data);
+            EstimateWeights(p.method, p.srcH, roi[1], roi[3], H, ty, buf.iy.data, buf.wy.data);
+
+            size_t x0 = p.srcW, x1 = 0;
+            for (size_t x = 0; x < W; ++x)
+            {
+                x0 = Simd::Min<size_t>(x0, buf.ix[x]);
+                x1 = Simd::Max<size_t>(x1, buf.ix[x] + tx);
+            }
+            size_t span = (x1 - x0) * C;
+            Reserve(buf.index, size);
+            Reserve(buf.weight, size * tx);
+            Reserve(buf.rows, span);
+            Reserve(buf.out, size);
+            for (size_t x = 0, i = 0; x < W; ++x)
+            {
+                for (size_t c = 0; c < C; ++c, ++i)
+                {
+                    buf.index[i] = int32_t((buf.ix[x] - x0) * C + c);
+                    for (size_t t = 0; t < tx; ++t)
+                        buf.weight[t * size + i] = buf.wx[x * tx + t];
+                }
+            }
+
+            bool direct = p.tensorType == SimdTensorData32f && p.tensorFormat == SimdTensorFormatNhwc;
+            for (size_t y = 0; y < H; ++y)
+            {
+                const uint8_t * s = src + buf.iy[y] * srcStride + x0 * p.SrcPixelSize();
+                if (p.srcType == SimdResizeChannelFloat)
+                    VerticalRow32f((const float*)s, srcStride / sizeof(float), span, buf.wy.data + y * ty, ty, buf.rows.data);
+                else
+                    VerticalRow8u(s, srcStride, span, buf.wy.data + y * ty, ty, buf.rows.data);
+                float * out = direct ? (float*)dst + y * size : buf.out.data;
+                HorizontalRow(buf.rows.data, buf.index.data, buf.weight.data, tx, size, out);
+                if (!direct)
+                    SynetSetInputRowStore(out, W, H, C, y, p.tensorFormat, p.tensorType, dst);
+            }
+        }
+
+        void CropAndResize::VerticalRow8u(const uint8_t * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = src[i] * weight[0];
+            for (size_t t = 1; t < taps; ++t)
+            {
+                if (weight[t] == 0.0f)
+                    continue;
+                const uint8_t * s = src + t * stride;
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] += s[i] * weight[t];
+            }
+        }
+
+        void CropAndResize::VerticalRow32f(const float * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = src[i] * weight[0];
+            for (size_t t = 1; t < taps; ++t)
+            {
+                if (weight[t] == 0.0f)
+                    continue;
+                const float * s = src + t * stride;
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] += s[i] * weight[t];
+            }
+        }
+
+        void CropAndResize::HorizontalRow(const float * src, const int32_t * index, const float * weight, size_t taps, size_t size, float * dst) const
+        {
+            const float * k = _k.data, * b = _b.data;
+            size_t C = _param.channels;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const float * s = src + index[i];
+                float sum = s[0] * weight[i];
+                for (size_t t = 1; t < taps; ++t)
+                    sum += s[t * C] * weight[t * size + i];
+                dst[i] = sum * k[i] + b[i];
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * CropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+            SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType)
+        {
+            CropAndResizeParam param(srcWidth, srcHeight, channels, srcType, dstWidth, dstHeight, method, lower, upper, tensorFormat, tensorType);
+            if (!param.Valid())
+                return NULL;
+            return new CropAndResize(param);
+        }
+    }
+}
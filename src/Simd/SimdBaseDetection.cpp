@@ -27,8 +27,10 @@
 #include "Simd/SimdXml.hpp"
 
 #include <exception>
+#include <float.h>
 #include <stdexcept>
 #include <iostream>
+#include <fstream>
 #include <sstream>
 
 #define SIMD_EX(message) \
@@ -319,15 +321,184 @@ namespace Simd
             return data;
         }
 
+        namespace Binary
+        {
+            const uint32_t MAGIC = 0x43444D53;
+            const uint32_t VERSION = 1;
+
+            struct Header
+            {
+                uint32_t magic, version;
+                int32_t featureType, stageType, ncategories, width, height;
+                int32_t isStumpBased, hasTilted, canInt16;
+                uint32_t stages, classifiers, nodes, leaves, subsets, haarFeatures, lbpFeatures;
+            };
+
+            struct HaarFeature
+            {
+                int32_t tilted;
+                Data::WeightedRect rect[Data::HaarFeature::RECT_NUM];
+            };
+
+            template<class T> SIMD_INLINE void Write(std::ofstream & ofs, const std::vector<T> & src)
+            {
+                if (src.size())
+                    ofs.write((const char*)src.data(), src.size() * sizeof(T));
+            }
+
+            class Reader
+            {
+                const uint8_t * _data;
+                size_t _size, _pos;
+            public:
+                Reader(const uint8_t * data, size_t size) : _data(data), _size(size), _pos(0) {}
+
+                template<class T> void Check(size_t count) const
+                {
+                    if (count > (_size - _pos) / sizeof(T))
+                        SIMD_EX("Unexpected end of binary cascade!");
+                }
+
+                template<class T> void Read(T * dst, size_t count)
+                {
+                    Check<T>(count);
+                    if (count)
+                        memcpy(dst, _data + _pos, count * sizeof(T));
+                    _pos += count * sizeof(T);
+                }
+
+                template<class T> void Read(std::vector<T> & dst, size_t count)
+                {
+                    Check<T>(count);
+                    dst.resize(count);
+                    Read(dst.data(), count);
+                }
+            };
+
+            SIMD_INLINE bool IsBinary(const uint8_t * data, size_t size)
+            {
+                return size >= sizeof(Header) && ((Header*)data)->magic == MAGIC;
+            }
+        }
+
+        void * DetectionLoadBinary(const uint8_t * src, size_t size)
+        {
+            Data * data = NULL;
+            try
+            {
+                Binary::Reader reader(src, size);
+                Binary::Header header;
+                reader.Read(&header, 1);
+                if (header.magic != Binary::MAGIC || header.version != Binary::VERSION)
+                    SIMD_EX("Invalid binary cascade header!");
+
+                data = new Data();
+                data->featureType = (SimdDetectionInfoFlags)header.featureType;
+                if (data->featureType != SimdDetectionInfoFeatureHaar && data->featureType != SimdDetectionInfoFeatureLbp)
+                    SIMD_EX("Invalid cascade feature type!");
+                if (header.width <= 0 || header.height <= 0 || header.ncategories < 0)
+                    SIMD_EX("Invalid binary cascade header!");
+                data->stageType = header.stageType;
+                data->ncategories = header.ncategories;
+                data->origWinSize = Size(header.width, header.height);
+                data->isStumpBased = header.isStumpBased != 0;
+                data->hasTilted = header.hasTilted != 0;
+                data->canInt16 = header.canInt16 != 0;
+
+                reader.Read(data->stages, header.stages);
+                reader.Read(data->classifiers, header.classifiers);
+                reader.Read(data->nodes, header.nodes);
+                reader.Read(data->leaves, header.leaves);
+                reader.Read(data->subsets, header.subsets);
+                std::vector<Binary::HaarFeature> haarFeatures;
+                reader.Read(haarFeatures, header.haarFeatures);
+                data->haarFeatures.resize(haarFeatures.size());
+                for (size_t i = 0; i < haarFeatures.size(); ++i)
+                {
+                    data->haarFeatures[i].tilted = haarFeatures[i].tilted != 0;
+                    for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                        data->haarFeatures[i].rect[j] = haarFeatures[i].rect[j];
+                }
+                reader.Read(data->lbpFeatures, header.lbpFeatures);
+
+                if (data->leaves.size() < data->nodes.size() * 2 || data->subsets.size() < data->nodes.size() * ((size_t(data->ncategories) + 31) / 32))
+                    SIMD_EX("Invalid binary cascade data!");
+                for (size_t i = 0; i < data->stages.size(); ++i)
+                    if (data->stages[i].first < 0 || data->stages[i].ntrees < 0 || size_t(data->stages[i].first) + size_t(data->stages[i].ntrees) > data->nodes.size())
+                        SIMD_EX("Invalid binary cascade stage!");
+                size_t features = data->featureType == SimdDetectionInfoFeatureHaar ? data->haarFeatures.size() : data->lbpFeatures.size();
+                for (size_t i = 0; i < data->nodes.size(); ++i)
+                    if (data->nodes[i].featureIdx < 0 || size_t(data->nodes[i].featureIdx) >= features)
+                        SIMD_EX("Invalid binary cascade node!");
+            }
+            catch (...)
+            {
+                delete data;
+                data = NULL;
+            }
+            return data;
+        }
+
         void * DetectionLoadA(const char * path)
         {
             Xml::File file;
             if (!file.Open(path))
                 SIMD_EX("Can't load XML file '" << path << "'!");
 
+            size_t size = file.Size() - 1;
+            if (Binary::IsBinary((uint8_t*)file.Data(), size))
+                return DetectionLoadBinary((uint8_t*)file.Data(), size);
+
             return DetectionLoadStringXml(file.Data(), path);
         }
 
+        SimdBool DetectionSaveA(const void * _data, const char * path)
+        {
+            const Data * data = (const Data*)_data;
+            if (data == NULL)
+                return SimdFalse;
+            std::ofstream ofs(path, std::ios::binary);
+            if (!ofs.is_open())
+                return SimdFalse;
+
+            Binary::Header header;
+            header.magic = Binary::MAGIC;
+            header.version = Binary::VERSION;
+            header.featureType = data->featureType;
+            header.stageType = data->stageType;
+            header.ncategories = data->ncategories;
+            header.width = (int32_t)data->origWinSize.x;
+            header.height = (int32_t)data->origWinSize.y;
+            header.isStumpBased = data->isStumpBased ? 1 : 0;
+            header.hasTilted = data->hasTilted ? 1 : 0;
+            header.canInt16 = data->canInt16 ? 1 : 0;
+            header.stages = (uint32_t)data->stages.size();
+            header.classifiers = (uint32_t)data->classifiers.size();
+            header.nodes = (uint32_t)data->nodes.size();
+            header.leaves = (uint32_t)data->leaves.size();
+            header.subsets = (uint32_t)data->subsets.size();
+            header.haarFeatures = (uint32_t)data->haarFeatures.size();
+            header.lbpFeatures = (uint32_t)data->lbpFeatures.size();
+            ofs.write((const char*)&header, sizeof(header));
+
+            Binary::Write(ofs, data->stages);
+            Binary::Write(ofs, data->classifiers);
+            Binary::Write(ofs, data->nodes);
+            Binary::Write(ofs, data->leaves);
+            Binary::Write(ofs, data->subsets);
+            std::vector<Binary::HaarFeature> haarFeatures(data->haarFeatures.size());
+            for (size_t i = 0; i < haarFeatures.size(); ++i)
+            {
+                haarFeatures[i].tilted = data->haarFeatures[i].tilted ? 1 : 0;
+                for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                    haarFeatures[i].rect[j] = data->haarFeatures[i].rect[j];
+            }
+            Binary::Write(ofs, haarFeatures);
+            Binary::Write(ofs, data->lbpFeatures);
+
+            return ofs.good() ? SimdTrue : SimdFalse;
+        }
+
         void DetectionInfo(const void * _data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
         {
             Data * data = (Data*)_data;
@@ -352,8 +523,10 @@ namespace Simd
             HidHaarCascade * hid = new HidHaarCascade();
 
             hid->isThroughColumn = false;
+            hid->isAdaptiveStep = false;
             hid->isStumpBased = data.isStumpBased;
             hid->origWinSize = data.origWinSize;
+            hid->skipThreshold = -FLT_MAX;
 
             hid->trees.resize(data.classifiers.size());
             for (size_t i = 0; i < data.classifiers.size(); ++i)
@@ -536,6 +709,8 @@ namespace Simd
 
             hid->isInt16 = (sizeof(TSum) == 2);
             hid->isThroughColumn = false;
+            hid->isAdaptiveStep = false;
+            hid->skipThreshold = hid->isInt16 ? TWeight(SHRT_MIN) : TWeight(-FLT_MAX);
 
             hid->isStumpBased = data.isStumpBased;
             //hid->stageType = data.stageType;
@@ -646,80 +821,149 @@ namespace Simd
             }
         }
 
-        void PrepareThroughColumn32i(const Image & src, Image & dst)
+        void PrepareThroughColumn32i(const Image & src, const Rect & rect, Image & dst)
         {
             assert(Simd::Compatible(src, dst) && src.format == Image::Int32);
 
-            for (size_t row = 0; row < src.height; ++row)
+            for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
             {
                 const uint32_t * s = &src.At<uint32_t>(0, row);
 
                 uint32_t * evenDst = &dst.At<uint32_t>(0, row);
-                for (size_t col = 0; col < src.width; col += 2)
+                for (ptrdiff_t col = Simd::AlignHi(rect.left, 2); col < rect.right; col += 2)
                     evenDst[col >> 1] = s[col];
 
                 uint32_t * oddDst = &dst.At<uint32_t>((dst.width + 1) >> 1, row);
-                for (size_t col = 1; col < src.width; col += 2)
+                for (ptrdiff_t col = rect.left | 1; col < rect.right; col += 2)
                     oddDst[col >> 1] = s[col];
             }
         }
 
-        void Prepare16i(const Image & src, bool throughColumn, Image & dst)
+        void Prepare16i(const Image & src, bool throughColumn, const Rect & rect, Image & dst)
         {
             assert(Simd::EqualSize(src, dst) && src.format == Image::Int32 && dst.format == Image::Int16);
 
             if (throughColumn)
             {
-                for (size_t row = 0; row < src.height; ++row)
+                for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
                 {
                     const uint32_t * s = &src.At<uint32_t>(0, row);
 
                     uint16_t * evenDst = &dst.At<uint16_t>(0, row);
-                    for (size_t col = 0; col < src.width; col += 2)
+                    for (ptrdiff_t col = Simd::AlignHi(rect.left, 2); col < rect.right; col += 2)
                         evenDst[col >> 1] = (uint16_t)s[col];
 
                     uint16_t * oddDst = &dst.At<uint16_t>((dst.width + 1) >> 1, row);
-                    for (size_t col = 1; col < src.width; col += 2)
+                    for (ptrdiff_t col = rect.left | 1; col < rect.right; col += 2)
                         oddDst[col >> 1] = (uint16_t)s[col];
                 }
             }
             else
             {
-                for (size_t row = 0; row < src.height; ++row)
+                for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
                 {
                     const uint32_t * s = &src.At<uint32_t>(0, row);
                     uint16_t * d = &dst.At<uint16_t>(0, row);
-                    for (size_t col = 0; col < src.width; ++col)
+                    for (ptrdiff_t col = rect.left; col < rect.right; ++col)
                         d[col] = (uint16_t)s[col];
                 }
             }
         }
 
-        void DetectionPrepare(void * _hid)
+        void DetectionPrepareRegion(void * _hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom)
         {
             HidBase * hidBase = (HidBase*)_hid;
+            Rect rect(left, top, right, bottom);
             if (hidBase->featureType == SimdDetectionInfoFeatureHaar && hidBase->isThroughColumn)
             {
                 HidHaarCascade * hid = (HidHaarCascade*)hidBase;
-                PrepareThroughColumn32i(hid->sum, hid->isum);
+                rect &= Rect(hid->sum.Size());
+                PrepareThroughColumn32i(hid->sum, rect, hid->isum);
                 if (hid->hasTilted)
-                    PrepareThroughColumn32i(hid->tilted, hid->itilted);
+                    PrepareThroughColumn32i(hid->tilted, rect, hid->itilted);
             }
             else if (hidBase->featureType == SimdDetectionInfoFeatureLbp)
             {
                 if (hidBase->isInt16)
                 {
                     HidLbpCascade<int, short> * hid = (HidLbpCascade<int, short>*)hidBase;
-                    Prepare16i(hid->sum, hid->isThroughColumn, hid->isum);
+                    rect &= Rect(hid->sum.Size());
+                    Prepare16i(hid->sum, hid->isThroughColumn, rect, hid->isum);
                 }
                 else if (hidBase->isThroughColumn)
                 {
                     HidLbpCascade<float, int> * hid = (HidLbpCascade<float, int>*)hidBase;
-                    PrepareThroughColumn32i(hid->sum, hid->isum);
+                    rect &= Rect(hid->sum.Size());
+                    PrepareThroughColumn32i(hid->sum, rect, hid->isum);
+                }
+            }
+        }
+
+        void DetectionPrepare(void * hid)
+        {
+            DetectionPrepareRegion(hid, 0, 0, INT_MAX, INT_MAX);
+        }
+
+        template<class T> T SkipThreshold(const T * leaves, int first, int ntrees, T threshold, float level)
+        {
+            T min = 0;
+            for (int i = first, n = first + ntrees; i < n; ++i)
+                min += Simd::Min(leaves[2 * i + 0], leaves[2 * i + 1]);
+            return T(min + (threshold - min)*level);
+        }
+
+        void DetectionSetAdaptiveStep(void * _hid, float level)
+        {
+            HidBase * hidBase = (HidBase*)_hid;
+            hidBase->isAdaptiveStep = level > 0.0f;
+            level = Simd::RestrictRange(level, 0.0f, 1.0f);
+            if (hidBase->featureType == SimdDetectionInfoFeatureHaar)
+            {
+                HidHaarCascade * hid = (HidHaarCascade*)hidBase;
+                const HidHaarCascade::Stage & stage = hid->stages[0];
+                hid->skipThreshold = hidBase->isAdaptiveStep ?
+                    SkipThreshold(hid->leaves.data(), stage.first, stage.ntrees, stage.threshold, level) : -FLT_MAX;
+            }
+            else if (hidBase->featureType == SimdDetectionInfoFeatureLbp)
+            {
+                if (hidBase->isInt16)
+                {
+                    HidLbpCascade<int, short> * hid = (HidLbpCascade<int, short>*)hidBase;
+                    const HidLbpCascade<int, short>::Stage & stage = hid->stages[0];
+                    hid->skipThreshold = hidBase->isAdaptiveStep ?
+                        SkipThreshold(hid->leaves.data(), stage.first, stage.ntrees, stage.threshold, level) : SHRT_MIN;
+                }
+                else
+                {
+                    HidLbpCascade<float, int> * hid = (HidLbpCascade<float, int>*)hidBase;
+                    const HidLbpCascade<float, int>::Stage & stage = hid->stages[0];
+                    hid->skipThreshold = hidBase->isAdaptiveStep ?
+                        SkipThreshold(hid->leaves.data(), stage.first, stage.ntrees, stage.threshold, level) : -FLT_MAX;
                 }
             }
         }
 
+        float StageSum32f(const HidHaarCascade & hid, int i_stage, size_t offset, float norm)
+        {
+            typedef HidHaarCascade Hid;
+            const Hid::Stage & stage = hid.stages[i_stage];
+            if (stage.canSkip)
+                return stage.threshold;
+            const Hid::Node * node = hid.nodes.data() + stage.first;
+            const Hid::Node * end = node + stage.ntrees;
+            const float * leaves = hid.leaves.data() + stage.first * 2;
+            float stageSum = 0.0;
+            for (; node < end; ++node, leaves += 2)
+            {
+                const Hid::Feature & feature = hid.features[node->featureIdx];
+                float sum = WeightedSum32f(feature.rect[0], offset) + WeightedSum32f(feature.rect[1], offset);
+                if (feature.rect[2].p0)
+                    sum += WeightedSum32f(feature.rect[2], offset);
+                stageSum += leaves[sum >= node->threshold*norm];
+            }
+            return stageSum;
+        }
+
         int Detect32f(const HidHaarCascade & hid, size_t offset, int startStage, float norm)
         {
             typedef HidHaarCascade Hid;
@@ -790,6 +1034,28 @@ namespace Simd
 
         void DetectionHaarDetect32fi(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            if (hid.isAdaptiveStep)
+            {
+                Buffer<uint8_t> skip(rect.Width());
+                memset(skip.m, 0, rect.Width());
+                for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
+                {
+                    size_t p_offset = row * hid.isum.stride / sizeof(uint32_t);
+                    size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t);
+                    for (ptrdiff_t col = rect.left; col < rect.right; col += 2)
+                    {
+                        uint8_t & next = skip.d[col - rect.left];
+                        next = 0;
+                        if (mask.At<uint8_t>(col, row) == 0 || skip.m[col - rect.left])
+                            continue;
+                        float norm = Norm32f(hid, pq_offset + col);
+                        if (Detect32f(hid, p_offset + col / 2, norm, next) > 0)
+                            dst.At<uint8_t>(col, row) = 1;
+                    }
+                    Swap(skip.m, skip.d);
+                }
+                return;
+            }
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
             {
                 size_t p_offset = row * hid.isum.stride / sizeof(uint32_t);
@@ -892,6 +1158,26 @@ namespace Simd
 
         void DetectionLbpDetect16ii(const HidLbpCascade<int, uint16_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            if (hid.isAdaptiveStep)
+            {
+                Buffer<uint8_t> skip(rect.Width());
+                memset(skip.m, 0, rect.Width());
+                for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
+                {
+                    size_t offset = row * hid.isum.stride / sizeof(uint16_t);
+                    for (ptrdiff_t col = rect.left; col < rect.right; col += 2)
+                    {
+                        uint8_t & next = skip.d[col - rect.left];
+                        next = 0;
+                        if (mask.At<uint8_t>(col, row) == 0 || skip.m[col - rect.left])
+                            continue;
+                        if (Detect(hid, offset + col / 2, next) > 0)
+                            dst.At<uint8_t>(col, row) = 1;
+                    }
+                    Swap(skip.m, skip.d);
+                }
+                return;
+            }
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
             {
                 size_t offset = row * hid.isum.stride / sizeof(uint16_t);
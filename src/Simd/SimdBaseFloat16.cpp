@@ -23,6 +23,11 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <algorithm>
 
 namespace Simd
 {
@@ -167,5 +172,150 @@ namespace Simd
                 for (size_t j = 0; j < N; ++j)
                     CosineDistance16f(A[i], B[j], K, distances + i * N + j);
         }
+
+        static void CosineSquares16f(size_t M, size_t K, const uint16_t * const * A, float * squares)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < K; ++k)
+                    sum += Simd::Square(Float16ToFloat32(A[i][k]));
+                squares[i] = sum;
+            }
+        }
+
+        static void CosineDistances16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, const float * aa, const float * bb, float * distances, size_t stride)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                {
+                    float ab = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        ab += Float16ToFloat32(A[i][k]) * Float16ToFloat32(B[j][k]);
+                    distances[j] = 1.0f - ab / ::sqrt(aa[i] * bb[j]);
+                }
+                distances += stride;
+            }
+        }
+
+        size_t CosineSelect32f(const float * src, size_t size, float threshold, uint32_t * indices)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                if (src[i] <= threshold)
+                    indices[count++] = (uint32_t)i;
+            return count;
+        }
+
+        typedef std::pair<float, uint32_t> CosineCandidate;
+
+        SIMD_INLINE void CosineCandidatePush(CosineCandidate * heap, size_t & size, size_t topK, const CosineCandidate & candidate)
+        {
+            if (size < topK)
+            {
+                heap[size++] = candidate;
+                std::push_heap(heap, heap + size);
+            }
+            else if (candidate < heap[0])
+            {
+                std::pop_heap(heap, heap + size);
+                heap[size - 1] = candidate;
+                std::push_heap(heap, heap + size);
+            }
+        }
+
+        void SquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums, CosineSquares16fPtr squares)
+        {
+            const size_t size = 256;
+            const uint16_t * a[size];
+            for (size_t i = 0; i < N; i += size)
+            {
+                size_t n = Simd::Min(N, i + size) - i;
+                for (size_t j = 0; j < n; ++j)
+                    a[j] = A + (i + j) * K;
+                squares(n, K, a, sums + i);
+            }
+        }
+
+        void SquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums)
+        {
+            SquareSums16f(N, K, A, sums, CosineSquares16f);
+        }
+
+        void CosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances,
+            CosineSquares16fPtr squares, CosineDistances16fPtr macro, CosineSelect32fPtr select)
+        {
+            if (M == 0 || topK == 0)
+                return;
+            const size_t L2 = AlgCacheL2(), PARALLEL_MIN = 0x1000000;
+            const size_t mN = Simd::Max<size_t>(AlignLoAny(L2 / 4 / K, 4), 4);
+            const size_t mM = Simd::Min<size_t>(M, Simd::Max<size_t>(AlignLoAny(L2 / 4 / mN / sizeof(float), 6), 6));
+            const size_t size = Simd::Min(N, topK);
+
+            std::vector<const uint16_t*> a(M);
+            std::vector<float> aa(M);
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A + i * K;
+            squares(M, K, a.data(), aa.data());
+
+            size_t threadNumber = M * N * K >= PARALLEL_MIN ? Simd::Min(GetThreadNumber(), DivHi(N, mN)) : 1;
+            std::vector<CosineCandidate> heaps(threadNumber * M * topK);
+            std::vector<size_t> sizes(threadNumber * M, 0);
+            Simd::Parallel(0, N, [&](size_t thread, size_t begin, size_t end)
+            {
+                CosineCandidate * heap = heaps.data() + thread * M * topK;
+                size_t * heapSizes = sizes.data() + thread * M;
+                std::vector<const uint16_t*> b(mN);
+                std::vector<float> bb(mN), buffer(mM * mN);
+                std::vector<uint32_t> selected(mN);
+                for (size_t j = begin; j < end; j += mN)
+                {
+                    size_t dN = Simd::Min(end, j + mN) - j;
+                    for (size_t n = 0; n < dN; ++n)
+                        b[n] = B + (j + n) * K;
+                    const float * _bb = bSquares ? bSquares + j : bb.data();
+                    if (bSquares == NULL)
+                        squares(dN, K, b.data(), bb.data());
+                    for (size_t i = 0; i < M; i += mM)
+                    {
+                        size_t dM = Simd::Min(M, i + mM) - i;
+                        macro(dM, dN, K, a.data() + i, b.data(), aa.data() + i, _bb, buffer.data(), mN);
+                        for (size_t m = 0; m < dM; ++m)
+                        {
+                            CosineCandidate * h = heap + (i + m) * topK;
+                            size_t & s = heapSizes[i + m];
+                            const float * d = buffer.data() + m * mN;
+                            size_t count = select(d, dN, s < topK ? FLT_MAX : h[0].first, selected.data());
+                            for (size_t c = 0; c < count; ++c)
+                                CosineCandidatePush(h, s, topK, CosineCandidate(d[selected[c]], uint32_t(j + selected[c])));
+                        }
+                    }
+                }
+            }, threadNumber, mN);
+
+            std::vector<CosineCandidate> merged;
+            for (size_t i = 0; i < M; ++i)
+            {
+                merged.clear();
+                for (size_t t = 0; t < threadNumber; ++t)
+                {
+                    const CosineCandidate * h = heaps.data() + (t * M + i) * topK;
+                    merged.insert(merged.end(), h, h + sizes[t * M + i]);
+                }
+                size_t count = Simd::Min(size, merged.size());
+                std::partial_sort(merged.begin(), merged.begin() + count, merged.end());
+                for (size_t k = 0; k < topK; ++k)
+                {
+                    indices[i * topK + k] = k < count ? merged[k].second : UINT32_MAX;
+                    distances[i * topK + k] = k < count ? merged[k].first : FLT_MAX;
+                }
+            }
+        }
+
+        void CosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances)
+        {
+            CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances, CosineSquares16f, CosineDistances16f, CosineSelect32f);
+        }
     }
 }
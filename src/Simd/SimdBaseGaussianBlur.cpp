@@ -22,6 +22,10 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -66,5 +70,246 @@ namespace Simd
                 dst += dstStride;
             }
         }
+
+        //---------------------------------------------------------------------
+
+        namespace
+        {
+            template<class T> void BlurRecursiveRow(const T * src, size_t size, size_t channels, const float * coefs, const float * border, float * dst)
+            {
+                const float b = coefs[0], a1 = coefs[1], a2 = coefs[2], a3 = coefs[3];
+                const size_t last = size - channels;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float p1 = src[c], p2 = p1, p3 = p1;
+                    for (size_t x = c; x < size; x += channels)
+                    {
+                        float w = b * src[x] + a1 * p1 + a2 * p2 + a3 * p3;
+                        p3 = p2, p2 = p1, p1 = w;
+                        dst[x] = w;
+                    }
+                    float plus = src[last + c], u0 = dst[last + c] - plus;
+                    float u1 = dst[(last >= channels ? last - channels : last) + c] - plus;
+                    float u2 = dst[(last >= 2 * channels ? last - 2 * channels : last) + c] - plus;
+                    p1 = border[0] * u0 + border[1] * u1 + border[2] * u2 + plus;
+                    p2 = border[3] * u0 + border[4] * u1 + border[5] * u2 + plus;
+                    p3 = border[6] * u0 + border[7] * u1 + border[8] * u2 + plus;
+                    dst[last + c] = p1;
+                    for (ptrdiff_t x = last + c - channels; x >= 0; x -= channels)
+                    {
+                        float w = b * dst[x] + a1 * p1 + a2 * p2 + a3 * p3;
+                        p3 = p2, p2 = p1, p1 = w;
+                        dst[x] = w;
+                    }
+                }
+            }
+        }
+
+        GaussianBlurFilter::GaussianBlurFilter(const BlurParam & param)
+            : _param(param)
+        {
+            const size_t PARALLEL_MIN = 0x10000;
+            _size = _param.width * _param.channels;
+            _radius = _param.Radius();
+            _threads = _size * _param.height >= PARALLEL_MIN ? Simd::Min(GetThreadNumber(), _param.height) : 1;
+            if (_param.Recursive())
+            {
+                double q = 0.98711 * _param.sigma - 0.96330;
+                double b0 = 1.57825 + 2.44413 * q + 1.4281 * q * q + 0.422205 * q * q * q;
+                double b1 = 2.44413 * q + 2.85619 * q * q + 1.26661 * q * q * q;
+                double b2 = -1.4281 * q * q - 1.26661 * q * q * q;
+                double b3 = 0.422205 * q * q * q;
+                _coefs[0] = float(1.0 - (b1 + b2 + b3) / b0);
+                _coefs[1] = float(b1 / b0);
+                _coefs[2] = float(b2 / b0);
+                _coefs[3] = float(b3 / b0);
+                double a1 = _coefs[1], a2 = _coefs[2], a3 = _coefs[3];
+                double scale = _coefs[0] / ((1.0 + a1 - a2 + a3) * (1.0 - a1 - a2 - a3) * (1.0 + a2 + (a1 - a3) * a3));
+                _border[0] = float(scale * (1.0 - a2 - a1 * a3 - a3 * a3));
+                _border[1] = float(scale * (a3 + a1) * (a2 + a1 * a3));
+                _border[2] = float(scale * a3 * (a1 + a2 * a3));
+                _border[3] = float(scale * (a1 + a2 * a3));
+                _border[4] = float(scale * (1.0 - a2) * (a2 + a1 * a3));
+                _border[5] = float(scale * a3 * (1.0 - a2 - a1 * a3 - a3 * a3));
+                _border[6] = float(scale * (a1 * a3 + a2 + a1 * a1 - a2 * a2));
+                _border[7] = float(scale * (a1 * a2 + a3 * a2 * a2 - a1 * a3 * a3 - a3 * a3 * a3 - a2 * a3 + a3));
+                _border[8] = float(scale * a3 * (a1 + a2 * a3));
+                _buffer.Resize(_size * (_param.height + 3));
+            }
+            else
+            {
+                assert(2 * _radius + 1 <= BLUR_KERNEL_MAX);
+                _kernel.Resize(2 * _radius + 1);
+                float sum = 0;
+                for (size_t k = 0; k < _kernel.size; ++k)
+                {
+                    float x = float(k) - float(_radius);
+                    _kernel[k] = ::expf(-x * x / (2.0f * _param.sigma * _param.sigma));
+                    sum += _kernel[k];
+                }
+                for (size_t k = 0; k < _kernel.size; ++k)
+                    _kernel[k] /= sum;
+                _buffer.Resize(_threads * (_size + 2 * _radius * _param.channels));
+            }
+        }
+
+        void GaussianBlurFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const BlurParam & p = _param;
+            if (p.Recursive())
+            {
+                Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    RecursiveRows(src, srcStride, begin, end);
+                }, _threads);
+                Simd::Parallel(0, _size, [&](size_t thread, size_t begin, size_t end)
+                {
+                    RecursiveColumns(_buffer.data, begin, Simd::Min(end, _size), dst, dstStride);
+                }, _threads, 64);
+            }
+            else
+            {
+                const size_t pad = _radius * p.channels, rowSize = _size + 2 * pad;
+                Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    float * buf = _buffer.data + thread * rowSize;
+                    for (size_t y = begin; y < end; ++y)
+                    {
+                        VerticalSum(src, srcStride, y, buf + pad);
+                        for (size_t x = 0; x < pad; ++x)
+                        {
+                            buf[x] = buf[pad + x % p.channels];
+                            buf[pad + _size + x] = buf[pad + _size - p.channels + x % p.channels];
+                        }
+                        HorizontalSum(buf, dst + y * dstStride);
+                    }
+                }, _threads);
+            }
+        }
+
+        void GaussianBlurFilter::VerticalSum(const uint8_t * src, size_t srcStride, size_t row, float * dst) const
+        {
+            const BlurParam & p = _param;
+            for (size_t x = 0; x < _size; ++x)
+                dst[x] = 0;
+            for (size_t k = 0; k < _kernel.size; ++k)
+            {
+                const uint8_t * s = src + Simd::RestrictRange<ptrdiff_t>(ptrdiff_t(row + k) - ptrdiff_t(_radius), 0, p.height - 1) * srcStride;
+                const float w = _kernel[k];
+                if (p.typeSize == 1)
+                {
+                    for (size_t x = 0; x < _size; ++x)
+                        dst[x] += w * s[x];
+                }
+                else
+                {
+                    for (size_t x = 0; x < _size; ++x)
+                        dst[x] += w * ((const float*)s)[x];
+                }
+            }
+        }
+
+        void GaussianBlurFilter::HorizontalSum(const float * src, uint8_t * dst) const
+        {
+            const size_t channels = _param.channels;
+            for (size_t x = 0; x < _size; ++x)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < _kernel.size; ++k)
+                    sum += _kernel[k] * src[x + k * channels];
+                if (_param.typeSize == 1)
+                    dst[x] = (uint8_t)RestrictRange(Round(sum), 0, 255);
+                else
+                    ((float*)dst)[x] = sum;
+            }
+        }
+
+        void GaussianBlurFilter::RecursiveRow(const uint8_t * src, float * dst) const
+        {
+            if (_param.typeSize == 1)
+                BlurRecursiveRow(src, _size, _param.channels, _coefs, _border, dst);
+            else
+                BlurRecursiveRow((const float*)src, _size, _param.channels, _coefs, _border, dst);
+        }
+
+        void GaussianBlurFilter::RecursiveRows(const uint8_t * src, size_t srcStride, size_t begin, size_t end) const
+        {
+            for (size_t y = begin; y < end; ++y)
+                RecursiveRow(src + y * srcStride, _buffer.data + y * _size);
+        }
+
+        void GaussianBlurFilter::RecursiveBorder(float * buf, size_t begin, size_t end, uint8_t * dst, size_t dstStride) const
+        {
+            const size_t height = _param.height;
+            const float * plus = buf + (height + 2) * _size;
+            float * v0 = buf + (height - 1) * _size, * v1 = buf + height * _size, * v2 = buf + (height + 1) * _size;
+            const float * w1 = buf + (height > 1 ? height - 2 : 0) * _size;
+            const float * w2 = buf + (height > 2 ? height - 3 : 0) * _size;
+            for (size_t x = begin; x < end; ++x)
+            {
+                float u0 = v0[x] - plus[x], u1 = w1[x] - plus[x], u2 = w2[x] - plus[x];
+                v1[x] = _border[3] * u0 + _border[4] * u1 + _border[5] * u2 + plus[x];
+                v2[x] = _border[6] * u0 + _border[7] * u1 + _border[8] * u2 + plus[x];
+                v0[x] = _border[0] * u0 + _border[1] * u1 + _border[2] * u2 + plus[x];
+            }
+            if (_param.typeSize == 1)
+            {
+                uint8_t * d = dst + (height - 1) * dstStride;
+                for (size_t x = begin; x < end; ++x)
+                    d[x] = (uint8_t)Simd::RestrictRange(Round(v0[x]), 0, 255);
+            }
+            else
+                memcpy(dst + (height - 1) * dstStride + begin * 4, v0 + begin, (end - begin) * 4);
+        }
+
+        void GaussianBlurFilter::RecursiveColumns(float * buf, size_t begin, size_t end, uint8_t * dst, size_t dstStride) const
+        {
+            const size_t height = _param.height;
+            const float b = _coefs[0], a1 = _coefs[1], a2 = _coefs[2], a3 = _coefs[3];
+            memcpy(buf + (height + 2) * _size + begin, buf + (height - 1) * _size + begin, (end - begin) * 4);
+            for (size_t y = 0; y < height; ++y)
+            {
+                float * c = buf + y * _size;
+                const float * p1 = buf + (y > 0 ? y - 1 : 0) * _size;
+                const float * p2 = buf + (y > 1 ? y - 2 : 0) * _size;
+                const float * p3 = buf + (y > 2 ? y - 3 : 0) * _size;
+                for (size_t x = begin; x < end; ++x)
+                    c[x] = b * c[x] + a1 * p1[x] + a2 * p2[x] + a3 * p3[x];
+            }
+            RecursiveBorder(buf, begin, end, dst, dstStride);
+            for (ptrdiff_t y = height - 2; y >= 0; --y)
+            {
+                float * c = buf + y * _size;
+                const float * n1 = c + _size, * n2 = n1 + _size, * n3 = n2 + _size;
+                for (size_t x = begin; x < end; ++x)
+                    c[x] = b * c[x] + a1 * n1[x] + a2 * n2[x] + a3 * n3[x];
+                if (_param.typeSize == 1)
+                {
+                    uint8_t * d = dst + y * dstStride;
+                    for (size_t x = begin; x < end; ++x)
+                        d[x] = (uint8_t)RestrictRange(Round(c[x]), 0, 255);
+                }
+                else
+                    memcpy(dst + y * dstStride + begin * 4, c + begin, (end - begin) * 4);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float * radius)
+        {
+            BlurParam param(width, height, channels, 1, radius);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianBlurFilter(param);
+        }
+
+        void * GaussianBlurInit32f(size_t width, size_t height, size_t channels, const float * radius)
+        {
+            BlurParam param(width, height, channels, 4, radius);
+            if (!param.Valid())
+                return NULL;
+            return new GaussianBlurFilter(param);
+        }
     }
 }
@@ -24,6 +24,11 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
 
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 namespace Simd
 {
     namespace Base
@@ -67,19 +72,22 @@ namespace Simd
             }
         }        
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::EstimateParams()
+        {
+            if (_ax.data)
+                return;
+            size_t rs = _param.dstW * _param.channels;
+            _ax.Resize(rs);
+            _ix.Resize(rs);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            SetBuffer(rs * sizeof(int32_t), 2);
+        }
+
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t cn =  _param.channels;
             size_t rs = _param.dstW * cn;
-            if (_ax.data == 0)
-            {
-                _ax.Resize(rs);
-                _ix.Resize(rs);
-                EstimateIndexAlpha(_param.srcW, _param.dstW, cn, _ix.data, _ax.data);
-                _bx[0].Resize(rs);
-                _bx[1].Resize(rs);
-            }
-            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t * pbx[2] = { (int32_t*)buffer, (int32_t*)(buffer + _rowSize) };
             int32_t prev = -2;
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
             {
@@ -189,7 +197,7 @@ namespace Simd
                 dst[c] = uint8_t((src[c] + Base::AREA_ROUND) >> Base::AREA_SHIFT);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) const
         {
             int32_t ts[N], rs[N];
             int32_t ayb = _ay.data[0], axb = _ax.data[0];
@@ -217,7 +225,7 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             switch (_param.channels)
             {
@@ -242,8 +250,7 @@ namespace Simd
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
             EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
-            _bx[0].Resize(rs, false, _param.align);
-            _bx[1].Resize(rs, false, _param.align);
+            SetBuffer(rs * sizeof(float), 2);
         }
 
         void ResizerFloatBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas)
@@ -326,16 +333,16 @@ namespace Simd
 
         }
 
-        void ResizerFloatBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
-            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float));
+            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float), (float*)buffer);
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buffer, buffer + _rowSize / sizeof(float) };
             int32_t prev = -2;
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
             {
@@ -377,7 +384,11 @@ namespace Simd
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
             if (param.IsByteBilinear())
-                return new ResizerByteBilinear(param);
+            {
+                ResizerByteBilinear * resizer = new ResizerByteBilinear(param);
+                resizer->EstimateParams();
+                return resizer;
+            }
             else  if (param.IsByteArea())
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
@@ -385,6 +396,53 @@ namespace Simd
             else
                 return NULL;
         }
+
+        //---------------------------------------------------------------------
+
+        class ResizerCache
+        {
+            typedef std::tuple<size_t, size_t, size_t, size_t, size_t, int, int> Key;
+            typedef std::list<std::pair<Key, ResizerPtr>> List;
+            typedef std::map<Key, List::iterator> Map;
+
+            static const size_t CAPACITY = 16;
+
+            std::mutex _mutex;
+            List _list;
+            Map _map;
+
+        public:
+            ResizerPtr Get(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, ResizerInitPtr init)
+            {
+                Key key(srcX, srcY, dstX, dstY, channels, type, method);
+                std::lock_guard<std::mutex> lock(_mutex);
+                Map::iterator it = _map.find(key);
+                if (it != _map.end())
+                {
+                    _list.splice(_list.begin(), _list, it->second);
+                    return it->second->second;
+                }
+                ResizerPtr resizer((Resizer*)init(srcX, srcY, dstX, dstY, channels, type, method));
+                if (resizer)
+                {
+                    if (_list.size() == CAPACITY)
+                    {
+                        _map.erase(_list.back().first);
+                        _list.pop_back();
+                    }
+                    _list.push_front(std::make_pair(key, resizer));
+                    _map[key] = _list.begin();
+                }
+                return resizer;
+            }
+        };
+
+        void * ResizerInitShared(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, ResizerInitPtr init)
+        {
+            static ResizerCache s_cache;
+            ResizerPtr resizer = s_cache.Get(srcX, srcY, dstX, dstY, channels, type, method, init);
+            return resizer ? new ResizerShared(resizer) : NULL;
+        }
     }
 }
 
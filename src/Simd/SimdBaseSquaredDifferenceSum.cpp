@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -68,6 +70,56 @@ namespace Simd
             }
         }
 
+        static void SquaredDifferenceSumsMxN(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums, size_t sumsStride)
+        {
+            const size_t KB = 256;
+            for (size_t i = 0; i < M; ++i)
+            {
+                const uint8_t * a = A + i*aStride;
+                for (size_t j = 0; j < N; ++j)
+                {
+                    const uint8_t * b = B + j*bStride;
+                    uint32_t sum = 0;
+                    for (size_t kb = 0; kb < K && sum <= threshold; kb += KB)
+                    {
+                        for (size_t k = kb, ke = Simd::Min(kb + KB, K); k < ke; ++k)
+                            sum += SquaredDifference(a[k], b[k]);
+                    }
+                    sums[i*sumsStride + j] = sum > threshold ? UINT32_MAX : sum;
+                }
+            }
+        }
+
+        void SquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums, SquaredDifferenceSumsMxN8uPtr kernel)
+        {
+            assert(K <= 0x10000);
+
+            const size_t PARALLEL_MIN = 0x400000;
+            size_t threadNumber = M*N*K >= PARALLEL_MIN ? GetThreadNumber() : 1;
+            if (M >= N)
+            {
+                Simd::Parallel(0, M, [&](size_t thread, size_t begin, size_t end)
+                {
+                    kernel(end - begin, N, K, A + begin*aStride, aStride, B, bStride, threshold, sums + begin*N, N);
+                }, threadNumber);
+            }
+            else
+            {
+                Simd::Parallel(0, N, [&](size_t thread, size_t begin, size_t end)
+                {
+                    kernel(M, end - begin, K, A, aStride, B + begin*bStride, bStride, threshold, sums + begin, N);
+                }, threadNumber);
+            }
+        }
+
+        void SquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums)
+        {
+            SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums, SquaredDifferenceSumsMxN);
+        }
+
         void SquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
         {
             size_t alignedSize = Simd::AlignLo(size, 4);
@@ -22,6 +22,9 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -64,5 +67,72 @@ namespace Simd
             for (size_t i = 0; i < count; ++i)
                 *sum += buffer.sums[i] * weights[i];
         }
+
+        //---------------------------------------------------------------------
+
+        SvmKernel::SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights)
+            : _param(param)
+            , _gemm(Base::Gemm32fNN)
+        {
+            _svs.Assign(svs, param.length * param.count);
+            _weights.Assign(weights, param.count);
+            _svNorms.Resize(param.count, true);
+            for (size_t j = 0; j < param.length; ++j, svs += param.count)
+                for (size_t i = 0; i < param.count; ++i)
+                    _svNorms[i] += svs[i] * svs[i];
+            size_t L2 = Base::AlgCacheL2() / sizeof(float);
+            _microC = Simd::Min(param.count, Simd::Max<size_t>(AlignLoAny(L2 / 2 / param.length, 16), 16));
+            _microB = Simd::Max<size_t>(AlignLoAny(L2 / 4 / _microC, 4), 4);
+        }
+
+        void SvmKernel::Sum(const float * x, size_t batch, float * sum) const
+        {
+            const SvmKernelParam & p = _param;
+            const float _0 = 0.0f, _1 = 1.0f;
+            // Base::Gemm32fNN multiplies C by beta, so uninitialized NaN would survive beta = 0.
+            Array32f dot(Simd::Min(batch, _microB) * _microC, true), norms(Simd::Min(batch, _microB), true);
+            for (size_t b = 0; b < batch; b += _microB)
+            {
+                size_t bn = Simd::Min(batch, b + _microB) - b;
+                const float * xb = x + b * p.length;
+                for (size_t i = 0; i < bn; ++i)
+                {
+                    sum[b + i] = 0.0f;
+                    if (p.type == SimdSvmKernelRbf)
+                    {
+                        const float * xi = xb + i * p.length;
+                        float norm = 0.0f;
+                        for (size_t j = 0; j < p.length; ++j)
+                            norm += xi[j] * xi[j];
+                        norms[i] = norm;
+                    }
+                }
+                for (size_t c = 0; c < p.count; c += _microC)
+                {
+                    size_t cn = Simd::Min(p.count, c + _microC) - c;
+                    _gemm(bn, cn, p.length, &_1, xb, p.length, _svs.data + c, p.count, &_0, dot.data, cn);
+                    Accumulate(dot.data, bn, cn, norms.data, _weights.data + c, _svNorms.data + c, sum + b);
+                }
+            }
+        }
+
+        void SvmKernel::Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const
+        {
+            for (size_t b = 0; b < batch; ++b, dot += count)
+            {
+                float s = 0.0f;
+                for (size_t c = 0; c < count; ++c)
+                    s += weights[c] * SvmKernelValue(_param, dot[c], norms[b], svNorms[c]);
+                sum[b] += s;
+            }
+        }
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree)
+        {
+            SvmKernelParam param(length, count, type, gamma, coef0, degree);
+            if (!param.Valid())
+                return NULL;
+            return new SvmKernel(param, svs, weights);
+        }
     }
 }
@@ -230,6 +230,57 @@ namespace Simd
             }
         }
 
+        void SynetSetInputRowScale(const float * lower, const float * upper, size_t channels, size_t width, float * scale, float * shift)
+        {
+            for (size_t x = 0, i = 0; x < width; ++x)
+            {
+                for (size_t c = 0; c < channels; ++c, ++i)
+                {
+                    scale[i] = (upper[c] - lower[c]) / 255.0f;
+                    shift[i] = lower[c];
+                }
+            }
+        }
+
+        void SynetSetInputRowStore(const float * src, size_t width, size_t height, size_t channels, size_t row,
+            SimdTensorFormatType format, SimdTensorDataType type, uint8_t * dst)
+        {
+            size_t C = channels, W = width, H = height;
+            if (type == SimdTensorData32f)
+            {
+                float * d = (float*)dst;
+                if (format == SimdTensorFormatNhwc)
+                    memcpy(d + row * W * C, src, W * C * sizeof(float));
+                else
+                {
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        float * dc = d + (c * H + row) * W;
+                        for (size_t x = 0; x < W; ++x)
+                            dc[x] = src[x * C + c];
+                    }
+                }
+            }
+            else
+            {
+                if (format == SimdTensorFormatNhwc)
+                {
+                    uint8_t * d = dst + row * W * C;
+                    for (size_t i = 0, n = W * C; i < n; ++i)
+                        d[i] = (uint8_t)RestrictRange(Round(src[i]), 0, 255);
+                }
+                else
+                {
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        uint8_t * dc = dst + (c * H + row) * W;
+                        for (size_t x = 0; x < W; ++x)
+                            dc[x] = (uint8_t)RestrictRange(Round(src[x * C + c]), 0, 255);
+                    }
+                }
+            }
+        }
+
         //---------------------------------------------------------------------
 
         template<size_t N> SIMD_INLINE void Copy(const float * src, float * dst)
@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void SwapRgb(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            BgrToRgb(src, srcStride, width, height, dst, dstStride);
+        }
+
+        static void SetConverter(const PreprocessParam & p, PreprocessConverter & c)
+        {
+            bool gray = p.dstFormat == SimdPixelFormatGray8, rgb = p.dstFormat == SimdPixelFormatRgb24;
+            c.packed = NULL;
+            c.gray = NULL;
+            c.yuv = NULL;
+            c.minWidth = 0;
+            switch (p.srcFormat)
+            {
+            case SimdSynetSourceGray8:
+                if (!gray) c.packed = GrayToBgr;
+                break;
+            case SimdSynetSourceBgr24:
+                if (gray) c.packed = BgrToGray;
+                else if (rgb) c.packed = SwapRgb;
+                break;
+            case SimdSynetSourceBgra32:
+                if (gray) c.packed = BgraToGray;
+                else if (rgb) c.packed = BgraToRgb;
+                else c.packed = BgraToBgr;
+                break;
+            case SimdSynetSourceRgb24:
+                if (gray) c.packed = RgbToGray;
+                else if (!rgb) c.packed = SwapRgb;
+                break;
+            case SimdSynetSourceNv12:
+            case SimdSynetSourceYuv420p:
+                if (rgb) c.yuv = Yuv444pToRgbV2;
+                else c.yuv = Yuv444pToBgrV2;
+                if (gray) c.gray = BgrToGray;
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        SynetPreprocess::SynetPreprocess(const PreprocessParam & param)
+            : _param(param)
+        {
+            const PreprocessParam & p = _param;
+            SetConverter(p, _base);
+            _fast = _base;
+            size_t C = p.channels, dstSize = p.dstW * C;
+            _ix.Resize(dstSize);
+            _fx.Resize(dstSize);
+            _rows.Resize(2 * dstSize);
+            _norm.Resize(dstSize);
+            _pad.Resize(dstSize);
+            _k.Resize(dstSize);
+            _b.Resize(dstSize);
+            SynetSetInputRowScale(p.lower, p.upper, C, p.dstW, _k.data, _b.data);
+            for (size_t i = 0; i < dstSize; ++i)
+                _pad[i] = p.padding * _k[i] + _b[i];
+            _conv.Resize((p.srcW + 1) * C + SIMD_ALIGN);
+            if (p.Yuv())
+            {
+                _u.Resize(p.srcW);
+                _v.Resize(p.srcW);
+                if (C == 1)
+                    _bgr.Resize(p.srcW * 3 + SIMD_ALIGN);
+            }
+        }
+
+        void SynetPreprocess::Run(const uint8_t * const * src, const size_t * srcStride, const ptrdiff_t * rois, size_t roiCount, uint8_t * dst)
+        {
+            const PreprocessParam & p = _param;
+            if (rois == NULL)
+                RunRoi(src, srcStride, 0, 0, p.srcW, p.srcH, dst);
+            else
+            {
+                for (size_t i = 0; i < roiCount; ++i, rois += 4, dst += p.TensorSize())
+                {
+                    size_t left = Simd::RestrictRange<ptrdiff_t>(rois[0], 0, p.srcW);
+                    size_t top = Simd::RestrictRange<ptrdiff_t>(rois[1], 0, p.srcH);
+                    size_t right = Simd::RestrictRange<ptrdiff_t>(rois[2], left, p.srcW);
+                    size_t bottom = Simd::RestrictRange<ptrdiff_t>(rois[3], top, p.srcH);
+                    RunRoi(src, srcStride, left, top, right, bottom, dst);
+                }
+            }
+        }
+
+        void SynetPreprocess::RunRoi(const uint8_t * const * src, const size_t * srcStride, size_t left, size_t top, size_t right, size_t bottom, uint8_t * dst)
+        {
+            const PreprocessParam & p = _param;
+            size_t C = p.channels, roiW = right - left, roiH = bottom - top;
+            if (roiW == 0 || roiH == 0)
+            {
+                for (size_t row = 0; row < p.dstH; ++row)
+                    StoreRow(_pad.data, row, dst);
+                return;
+            }
+
+            size_t dstW = p.dstW, dstH = p.dstH, offX = 0, offY = 0;
+            if (p.letterbox)
+            {
+                float scale = Simd::Min(float(p.dstW) / roiW, float(p.dstH) / roiH);
+                dstW = Simd::RestrictRange<size_t>(Round(roiW * scale), 1, p.dstW);
+                dstH = Simd::RestrictRange<size_t>(Round(roiH * scale), 1, p.dstH);
+                offX = (p.dstW - dstW) / 2;
+                offY = (p.dstH - dstH) / 2;
+            }
+
+            float scaleX = float(roiW) / dstW, scaleY = float(roiH) / dstH;
+            for (size_t dx = 0; dx < dstW; ++dx)
+            {
+                float sx = Simd::RestrictRange((dx + 0.5f) * scaleX - 0.5f, 0.0f, float(roiW - 1));
+                int ix = (int)sx;
+                for (size_t c = 0; c < C; ++c)
+                {
+                    _ix[dx * C + c] = int(ix * C + c);
+                    _fx[dx * C + c] = sx - ix;
+                }
+            }
+
+            size_t dstSize = dstW * C, fullSize = p.dstW * C, tail = (offX + dstW) * C;
+            bool direct = p.tensorFormat == SimdTensorFormatNhwc && p.tensorType == SimdTensorData32f;
+            _rowIndex[0] = -1;
+            _rowIndex[1] = -1;
+            for (size_t row = 0; row < p.dstH; ++row)
+            {
+                if (row < offY || row >= offY + dstH)
+                {
+                    StoreRow(_pad.data, row, dst);
+                    continue;
+                }
+                float sy = Simd::RestrictRange((row - offY + 0.5f) * scaleY - 0.5f, 0.0f, float(roiH - 1));
+                size_t iy = (size_t)sy;
+                float fy = sy - iy;
+                const float * row0 = SourceRow(src, srcStride, left, right, top + iy, dstSize);
+                const float * row1 = fy > 0.0f ? SourceRow(src, srcStride, left, right, top + iy + 1, dstSize) : row0;
+                float * out = direct ? (float*)dst + row * fullSize : _norm.data;
+                VerticalRow(row0, row1, fy, dstSize, out + offX * C);
+                for (size_t i = 0; i < offX * C; ++i)
+                    out[i] = _pad[i];
+                for (size_t i = tail; i < fullSize; ++i)
+                    out[i] = _pad[i];
+                if (!direct)
+                    StoreRow(out, row, dst);
+            }
+        }
+
+        const float * SynetPreprocess::SourceRow(const uint8_t * const * src, const size_t * srcStride, size_t left, size_t right, size_t row, size_t dstSize)
+        {
+            if (_rowIndex[0] == (ptrdiff_t)row)
+                return _rows.data;
+            if (_rowIndex[1] == (ptrdiff_t)row)
+                return _rows.data + _ix.size;
+            size_t slot = _rowIndex[0] < _rowIndex[1] ? 0 : 1;
+
+            const PreprocessParam & p = _param;
+            size_t width = right - left, C = p.channels;
+            const PreprocessConverter & cvt = width >= _fast.minWidth ? _fast : _base;
+            uint8_t * conv = _conv.data;
+            if (p.Yuv())
+            {
+                const uint8_t * y = src[0] + row * srcStride[0] + left;
+                if (p.srcFormat == SimdSynetSourceNv12)
+                {
+                    const uint8_t * uv = src[1] + (row / 2) * srcStride[1];
+                    for (size_t i = 0, x = left; i < width; ++i, ++x)
+                    {
+                        _u[i] = uv[(x & ~1) + 0];
+                        _v[i] = uv[(x & ~1) + 1];
+                    }
+                }
+                else
+                {
+                    const uint8_t * u = src[1] + (row / 2) * srcStride[1];
+                    const uint8_t * v = src[2] + (row / 2) * srcStride[2];
+                    for (size_t i = 0, x = left; i < width; ++i, ++x)
+                    {
+                        _u[i] = u[x / 2];
+                        _v[i] = v[x / 2];
+                    }
+                }
+                if (cvt.gray)
+                {
+                    cvt.yuv(y, width, _u.data, width, _v.data, width, width, 1, _bgr.data, width * 3, p.yuvType);
+                    cvt.gray(_bgr.data, width, 1, width * 3, conv, width);
+                }
+                else
+                    cvt.yuv(y, width, _u.data, width, _v.data, width, width, 1, conv, width * C, p.yuvType);
+            }
+            else
+            {
+                const uint8_t * s = src[0] + row * srcStride[0] + left * p.SrcPixelSize();
+                if (cvt.packed)
+                    cvt.packed(s, width, 1, srcStride[0], conv, width * C);
+                else
+                    memcpy(conv, s, width * C);
+            }
+            for (size_t c = 0; c < C; ++c)
+                conv[width * C + c] = conv[(width - 1) * C + c];
+
+            float * dst = _rows.data + slot * _ix.size;
+            HorizontalRow(conv, dstSize, dst);
+            _rowIndex[slot] = row;
+            return dst;
+        }
+
+        void SynetPreprocess::HorizontalRow(const uint8_t * src, size_t dstSize, float * dst)
+        {
+            const int32_t * ix = _ix.data;
+            const float * fx = _fx.data;
+            size_t C = _param.channels;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float s0 = src[ix[i]], s1 = src[ix[i] + C];
+                dst[i] = s0 + (s1 - s0) * fx[i];
+            }
+        }
+
+        void SynetPreprocess::VerticalRow(const float * src0, const float * src1, float fy, size_t size, float * dst)
+        {
+            const float * k = _k.data, * b = _b.data;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (src0[i] + (src1[i] - src0[i]) * fy) * k[i] + b[i];
+        }
+
+        void SynetPreprocess::StoreRow(const float * src, size_t row, uint8_t * dst) const
+        {
+            const PreprocessParam & p = _param;
+            SynetSetInputRowStore(src, p.dstW, p.dstH, p.channels, row, p.tensorFormat, p.tensorType, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+            SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding)
+        {
+            PreprocessParam param(srcWidth, srcHeight, srcFormat, yuvType, dstWidth, dstHeight, dstFormat, lower, upper, tensorFormat, tensorType, letterbox, padding);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocess(param);
+        }
+    }
+}
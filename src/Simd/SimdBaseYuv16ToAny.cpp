@@ -0,0 +1,135 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void ReduceDepth(const uint16_t * src, size_t size, const uint16_t * offsets, int shift, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = ReduceDepth(src[i], offsets[i & 3], shift);
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride, size_t bitDepth, SimdDepthReductionType reduction)
+        {
+            int shift = int(bitDepth - 8);
+            uint16_t offsets[4];
+            for (size_t row = 0; row < height; ++row)
+            {
+                DepthReductionOffsets(bitDepth, reduction, row, offsets);
+                ReduceDepth((const uint16_t*)src, width, offsets, shift, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Yuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+            uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, size_t bitDepth, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            Uint16ToGray(y, width, height, yStride, dy, dyStride, bitDepth, reduction);
+            Uint16ToGray(u, width / 2, height / 2, uStride, du, duStride, bitDepth, reduction);
+            Uint16ToGray(v, width / 2, height / 2, vStride, dv, dvStride, bitDepth, reduction);
+        }
+
+        void P010ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            Uint16ToGray(y, width, height, yStride, dy, dyStride, 16, reduction);
+            uint16_t offsets[4];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                DepthReductionOffsets(16, reduction, row / 2, offsets);
+                const uint16_t * ps = (const uint16_t*)uv;
+                for (size_t col = 0, i = 0; i < width; col += 1, i += 2)
+                {
+                    du[col] = ReduceDepth(ps[i + 0], offsets[(i + 0) & 3], 8);
+                    dv[col] = ReduceDepth(ps[i + 1], offsets[(i + 1) & 3], 8);
+                }
+                uv += uvStride;
+                du += duStride;
+                dv += dvStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, size_t bitDepth, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            int shift = int(bitDepth - 8);
+            size_t widthUv = width / 2;
+            Array8u buffer(width * 2 + widthUv * 2);
+            uint8_t * by = buffer.data, * bu = by + width * 2, * bv = bu + widthUv;
+            uint16_t offsets[4];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                DepthReductionOffsets(bitDepth, reduction, row + 0, offsets);
+                ReduceDepth((const uint16_t*)y, width, offsets, shift, by);
+                DepthReductionOffsets(bitDepth, reduction, row + 1, offsets);
+                ReduceDepth((const uint16_t*)(y + yStride), width, offsets, shift, by + width);
+                DepthReductionOffsets(bitDepth, reduction, row / 2, offsets);
+                ReduceDepth((const uint16_t*)u, widthUv, offsets, shift, bu);
+                ReduceDepth((const uint16_t*)v, widthUv, offsets, shift, bv);
+                Yuv420pToBgraV2(by, width, bu, widthUv, bv, widthUv, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void P010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            size_t widthUv = width / 2;
+            Array8u buffer(width * 4);
+            uint8_t * by = buffer.data, * buv = by + width * 2, * bu = buv + width, * bv = bu + widthUv;
+            uint16_t offsets[4];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                DepthReductionOffsets(16, reduction, row + 0, offsets);
+                ReduceDepth((const uint16_t*)y, width, offsets, 8, by);
+                DepthReductionOffsets(16, reduction, row + 1, offsets);
+                ReduceDepth((const uint16_t*)(y + yStride), width, offsets, 8, by + width);
+                DepthReductionOffsets(16, reduction, row / 2, offsets);
+                ReduceDepth((const uint16_t*)uv, width, offsets, 8, buv);
+                DeinterleaveUv(buv, width, widthUv, 1, bu, widthUv, bv, widthUv);
+                Yuv420pToBgraV2(by, width, bu, widthUv, bv, widthUv, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+    }
+}
@@ -27,13 +27,13 @@ namespace Simd
 {
     namespace Base
     {
-        SIMD_INLINE void Yuv422pToBgr(const uint8_t *y, int u, int v, uint8_t * bgr)
+        template <class T> SIMD_INLINE void Yuv422pToBgr(const uint8_t *y, int u, int v, uint8_t * bgr)
         {
-            YuvToBgr(y[0], u, v, bgr);
-            YuvToBgr(y[1], u, v, bgr + 3);
+            YuvToBgr<T>(y[0], u, v, bgr);
+            YuvToBgr<T>(y[1], u, v, bgr + 3);
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -44,8 +44,8 @@ namespace Simd
                 {
                     int u_ = u[colUV];
                     int v_ = v[colUV];
-                    Yuv422pToBgr(y + colY, u_, v_, bgr + colBgr);
-                    Yuv422pToBgr(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
+                    Yuv422pToBgr<T>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<T>(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -54,7 +54,62 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool swap> void NvToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t U = swap ? 1 : 0, V = swap ? 0 : 1;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colBgr = 0; colY < width; colY += 2, colUV += 2, colBgr += 6)
+                {
+                    int u_ = uv[colUV + U];
+                    int v_ = uv[colUV + V];
+                    Yuv422pToBgr<T>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<T>(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            NvToBgr<Bt601, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            NvToBgr<Bt601, true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (width >= 2));
@@ -62,7 +117,7 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < width; colY += 2, colUV++, colBgr += 6)
-                    Yuv422pToBgr(y + colY, u[colUV], v[colUV], bgr + colBgr);
+                    Yuv422pToBgr<T>(y + colY, u[colUV], v[colUV], bgr + colBgr);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -70,13 +125,35 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgr = 0; col < width; col++, colBgr += 3)
-                    YuvToBgr(y[col], u[col], v[col], bgr + colBgr);
+                    YuvToBgr<T>(y[col], u[col], v[col], bgr + colBgr);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -84,15 +161,37 @@ namespace Simd
             }
         }
 
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
         //---------------------------------------------------------------------
 
-        SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, int u, int v, uint8_t* rgb)
+        template <class T> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, int u, int v, uint8_t* rgb)
         {
-            YuvToRgb(y[0], u, v, rgb);
-            YuvToRgb(y[1], u, v, rgb + 3);
+            YuvToRgb<T>(y[0], u, v, rgb);
+            YuvToRgb<T>(y[1], u, v, rgb + 3);
         }
 
-        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -103,8 +202,8 @@ namespace Simd
                 {
                     int u_ = u[colUV];
                     int v_ = v[colUV];
-                    Yuv422pToRgb(y + colY, u_, v_, rgb + colRgb);
-                    Yuv422pToRgb(y + yStride + colY, u_, v_, rgb + rgbStride + colRgb);
+                    Yuv422pToRgb<T>(y + colY, u_, v_, rgb + colRgb);
+                    Yuv422pToRgb<T>(y + yStride + colY, u_, v_, rgb + rgbStride + colRgb);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -113,7 +212,62 @@ namespace Simd
             }
         }
 
-        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv420pToRgb<Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToRgb<Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv420pToRgb<Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv420pToRgb<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv420pToRgb<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv420pToRgb<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv420pToRgb<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool swap> void NvToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t U = swap ? 1 : 0, V = swap ? 0 : 1;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colRgb = 0; colY < width; colY += 2, colUV += 2, colRgb += 6)
+                {
+                    int u_ = uv[colUV + U];
+                    int v_ = uv[colUV + V];
+                    Yuv422pToRgb<T>(y + colY, u_, v_, rgb + colRgb);
+                    Yuv422pToRgb<T>(y + yStride + colY, u_, v_, rgb + rgbStride + colRgb);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            NvToRgb<Bt601, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            NvToRgb<Bt601, true>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        template <class T> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (width >= 2));
@@ -121,7 +275,7 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colRgb = 0; colY < width; colY += 2, colUV++, colRgb += 6)
-                    Yuv422pToRgb(y + colY, u[colUV], v[colUV], rgb + colRgb);
+                    Yuv422pToRgb<T>(y + colY, u[colUV], v[colUV], rgb + colRgb);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -129,18 +283,62 @@ namespace Simd
             }
         }
 
-        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv422pToRgb<Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToRgb<Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv422pToRgb<Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv422pToRgb<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv422pToRgb<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv422pToRgb<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv422pToRgb<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colRgb = 0; col < width; col++, colRgb += 3)
-                    YuvToRgb(y[col], u[col], v[col], rgb + colRgb);
+                    YuvToRgb<T>(y[col], u[col], v[col], rgb + colRgb);
                 y += yStride;
                 u += uStride;
                 v += vStride;
                 rgb += rgbStride;
             }
         }
+
+        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv444pToRgb<Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToRgb<Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv444pToRgb<Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv444pToRgb<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv444pToRgb<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv444pToRgb<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv444pToRgb<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 }
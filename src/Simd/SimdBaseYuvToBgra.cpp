@@ -27,13 +27,13 @@ namespace Simd
 {
     namespace Base
     {
-        SIMD_INLINE void Yuva422pToBgra(const uint8_t * y, int u, int v, const uint8_t * a, uint8_t * bgra)
+        template <class T> SIMD_INLINE void Yuva422pToBgra(const uint8_t * y, int u, int v, const uint8_t * a, uint8_t * bgra)
         {
-            YuvToBgra(y[0], u, v, a[0], bgra + 0);
-            YuvToBgra(y[1], u, v, a[1], bgra + 4);
+            YuvToBgra<T>(y[0], u, v, a[0], bgra + 0);
+            YuvToBgra<T>(y[1], u, v, a[1], bgra + 4);
         }
 
-        void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -44,8 +44,8 @@ namespace Simd
                 {
                     int u_ = u[colUV];
                     int v_ = v[colUV];
-                    Yuva422pToBgra(y + colY, u_, v_, a + colY, bgra + colBgra);
-                    Yuva422pToBgra(y + yStride + colY, u_, v_, a + aStride + colY, bgra + bgraStride + colBgra);
+                    Yuva422pToBgra<T>(y + colY, u_, v_, a + colY, bgra + colBgra);
+                    Yuva422pToBgra<T>(y + yStride + colY, u_, v_, a + aStride + colY, bgra + bgraStride + colBgra);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -55,13 +55,19 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void Yuv422pToBgra(const uint8_t *y, int u, int v, int alpha, uint8_t * bgra)
+        void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
         {
-            YuvToBgra(y[0], u, v, alpha, bgra + 0);
-            YuvToBgra(y[1], u, v, alpha, bgra + 4);
+            Yuva420pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
         }
 
-        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> SIMD_INLINE void Yuv422pToBgra(const uint8_t *y, int u, int v, int alpha, uint8_t * bgra)
+        {
+            YuvToBgra<T>(y[0], u, v, alpha, bgra + 0);
+            YuvToBgra<T>(y[1], u, v, alpha, bgra + 4);
+        }
+
+        template <class T> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -72,8 +78,8 @@ namespace Simd
                 {
                     int u_ = u[colUV];
                     int v_ = v[colUV];
-                    Yuv422pToBgra(y + colY, u_, v_, alpha, bgra + colBgra);
-                    Yuv422pToBgra(y + yStride + colY, u_, v_, alpha, bgra + bgraStride + colBgra);
+                    Yuv422pToBgra<T>(y + colY, u_, v_, alpha, bgra + colBgra);
+                    Yuv422pToBgra<T>(y + yStride + colY, u_, v_, alpha, bgra + bgraStride + colBgra);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -82,7 +88,62 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv420pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420pToBgra<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv420pToBgra<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420pToBgra<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420pToBgra<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv420pToBgra<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool swap> void NvToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t U = swap ? 1 : 0, V = swap ? 0 : 1;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colBgra = 0; colY < width; colY += 2, colUV += 2, colBgra += 8)
+                {
+                    int u_ = uv[colUV + U];
+                    int v_ = uv[colUV + V];
+                    Yuv422pToBgra<T>(y + colY, u_, v_, alpha, bgra + colBgra);
+                    Yuv422pToBgra<T>(y + yStride + colY, u_, v_, alpha, bgra + bgraStride + colBgra);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            NvToBgra<Bt601, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            NvToBgra<Bt601, true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        template <class T> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (width >= 2));
@@ -90,7 +151,7 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < width; colY += 2, colUV++, colBgra += 8)
-                    Yuv422pToBgra(y + colY, u[colUV], v[colUV], alpha, bgra + colBgra);
+                    Yuv422pToBgra<T>(y + colY, u[colUV], v[colUV], alpha, bgra + colBgra);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -98,18 +159,62 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv422pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv422pToBgra<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv422pToBgra<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv422pToBgra<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv422pToBgra<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv422pToBgra<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgra = 0; col < width; col++, colBgra += 4)
-                    YuvToBgra(y[col], u[col], v[col], alpha, bgra + colBgra);
+                    YuvToBgra<T>(y[col], u[col], v[col], alpha, bgra + colBgra);
                 y += yStride;
                 u += uStride;
                 v += vStride;
                 bgra += bgraStride;
             }
         }
+
+        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv444pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgra<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv444pToBgra<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv444pToBgra<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv444pToBgra<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv444pToBgra<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv444pToBgra<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
     }
 }
@@ -28,6 +28,7 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdLoad.h"
+#include "Simd/SimdArray.h"
 
 namespace Simd
 {
@@ -133,6 +134,86 @@ namespace Simd
             dst11[1] = BayerToGreen(src[3][col2], src[2][col3], src[3][col4], src[4][col3], src[3][col1], src[1][col3], src[3][col5], src[5][col3]);
             dst11[2] = src[3][col3];
         }
+
+        //-----------------------------------------------------------------------
+
+        const int BAYER_GAIN_SHIFT = 12;
+        const int BAYER_GAIN_ROUND = 1 << (BAYER_GAIN_SHIFT - 1);
+
+        SIMD_INLINE void BayerGains(const float * gains, int32_t dst[3])
+        {
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = gains ? RestrictRange(Round(gains[c] * (1 << BAYER_GAIN_SHIFT)), 0, 0x7FFF) : 1 << BAYER_GAIN_SHIFT;
+        }
+
+        SIMD_INLINE void BayerRowType(SimdPixelFormatType bayerFormat, size_t row, bool & redRow, bool & greenEven)
+        {
+            bool odd = (row & 1) != 0;
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg: redRow = !odd; greenEven = !odd; break;
+            case SimdPixelFormatBayerGbrg: redRow = odd; greenEven = !odd; break;
+            case SimdPixelFormatBayerRggb: redRow = !odd; greenEven = odd; break;
+            case SimdPixelFormatBayerBggr: redRow = odd; greenEven = odd; break;
+            default: assert(0); redRow = false; greenEven = false;
+            }
+        }
+
+        /* Cache of 5 source rows (converted to 32-bit integers with white balance gains) used by 5x5 demosaic kernels.
+           Each row has 2 extra pixels on every side. Missing rows and columns are replicated with step 2 in order to keep Bayer pattern. */
+        class BayerRows
+        {
+        public:
+            BayerRows(size_t width, size_t height, size_t bitDepth, const float * gains)
+                : _width(width), _height(height), _stride(width + 4), _max((1 << bitDepth) - 1)
+            {
+                BayerGains(gains, _gains);
+                _buffer.Resize(_stride * 5);
+                for (size_t i = 0; i < 5; ++i)
+                    _index[i] = -1;
+            }
+
+            SIMD_INLINE int32_t * Row(ptrdiff_t row, bool & load)
+            {
+                size_t slot = row % 5;
+                load = _index[slot] != row;
+                _index[slot] = row;
+                return _buffer.data + slot * _stride + 2;
+            }
+
+            SIMD_INLINE size_t Index(ptrdiff_t row) const
+            {
+                return row < 0 ? row + 2 : (row >= (ptrdiff_t)_height ? row - 2 : row);
+            }
+
+            SIMD_INLINE void Gains(SimdPixelFormatType bayerFormat, size_t row, int32_t & even, int32_t & odd) const
+            {
+                bool redRow, greenEven;
+                BayerRowType(bayerFormat, row, redRow, greenEven);
+                int32_t color = redRow ? _gains[2] : _gains[0];
+                even = greenEven ? _gains[1] : color;
+                odd = greenEven ? color : _gains[1];
+            }
+
+            SIMD_INLINE void Pad(int32_t * row) const
+            {
+                row[-2] = row[0];
+                row[-1] = row[1];
+                row[_width + 0] = row[_width - 2];
+                row[_width + 1] = row[_width - 1];
+            }
+
+            SIMD_INLINE int32_t Max() const
+            {
+                return _max;
+            }
+
+        private:
+            size_t _width, _height, _stride;
+            int32_t _max, _gains[3];
+            ptrdiff_t _index[5];
+            Array32i _buffer;
+        };
     }
 
 #ifdef SIMD_SSE2_ENABLE
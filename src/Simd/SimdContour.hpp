@@ -26,6 +26,7 @@
 #define __SimdContour_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
 
@@ -77,16 +78,30 @@ namespace Simd
         typedef std::vector<Point> Contour; /*!< A contour type definition. */
         typedef std::vector<Contour> Contours; /*!< A vector of contours type definition. */
 
+        /*!
+            Creates a new ContourDetector structure.
+        */
+        ContourDetector()
+            : _threadNumber(1)
+        {
+        }
+
         /*!
             Prepares ContourDetector structure to work with image of given size.
 
             \param [in] size - a size of input image.
+            \param [in] threadNumber - a number of work threads. The routing steps are estimated in parallel over horizontal stripes of the image,
+                and the contours are traced with them sequentially, so the result does not depend on the number of threads.
+                Use value -1 to auto choose of thread number. By default is equal to 1 (steps are estimated during the tracing).
         */
-        void Init(Size size)
+        void Init(Size size, ptrdiff_t threadNumber = 1)
         {
             _m.Recreate(size, View::Int16);
             _a.Recreate(size, View::Gray8);
             _e.Recreate(size, View::Gray8);
+            _threadNumber = threadNumber > 0 ? threadNumber : std::max<ptrdiff_t>(std::thread::hardware_concurrency(), 1);
+            if (_threadNumber > 1)
+                _s.Recreate(size, View::Gray8);
         }
 
         /*!
@@ -121,7 +136,11 @@ namespace Simd
 
             ContourAnchors(anchorThreshold, anchorScanInterval);
 
-            PerformSmartRouting(contours, minSegmentLength, gradientThreshold * 2);
+            const Arena & arena = PerformSmartRouting(minSegmentLength, gradientThreshold * 2);
+
+            contours.reserve(contours.size() + arena.Size());
+            for (size_t i = 0; i < arena.Size(); ++i)
+                contours.push_back(Contour(arena.points.begin() + arena.offsets[i], arena.points.begin() + arena.offsets[i + 1]));
 
             return true;
         }
@@ -145,19 +164,57 @@ namespace Simd
                 : p(p_)
                 , val(val_)
             {}
+        };
+        typedef std::vector<Anchor> Anchors;
+
+        struct Arena
+        {
+            std::vector<Point> points;
+            std::vector<size_t> offsets;
+
+            void Clear()
+            {
+                points.clear();
+                offsets.assign(1, 0);
+            }
+
+            size_t Size() const
+            {
+                return offsets.size() - 1;
+            }
 
-            static SIMD_INLINE bool Compare(const Anchor & a, const Anchor & b)
+            void Close(size_t minSegmentLength)
             {
-                return a.val > b.val;
+                if (points.size() - offsets.back() > minSegmentLength)
+                    offsets.push_back(points.size());
+                else
+                    points.resize(offsets.back());
             }
         };
-        typedef std::vector<Anchor> Anchors;
+
+        struct Task
+        {
+            ptrdiff_t x, y;
+            Direction direction;
+            Task(ptrdiff_t x_, ptrdiff_t y_, Direction direction_)
+                : x(x_)
+                , y(y_)
+                , direction(direction_)
+            {}
+        };
+        typedef std::vector<Task> Tasks;
 
         Rect _roi;
         View _m;
         View _a;
         View _e;
-        Anchors _anchors;
+        View _s;
+        Anchors _anchors, _buffer;
+        std::vector<uint32_t> _histogram;
+        ptrdiff_t _threadNumber;
+        bool _steps;
+        Tasks _tasks;
+        Arena _arena;
 
         void ContourMetrics(const View & src, const View & mask, uint8_t indexMin)
         {
@@ -172,182 +229,177 @@ namespace Simd
             Simd::ContourAnchors(_m.Region(_roi), anchorScanInterval, anchorThreshold, _a.Region(_roi).Ref());
 
             _anchors.clear();
+            uint16_t valMax = 0;
             for (ptrdiff_t row = _roi.Top() + 1; row < _roi.Bottom() - 1; row += anchorScanInterval)
             {
                 const uint8_t * a = &At<A, uint8_t>(_a, 0, row);
+                const uint16_t * m = &At<A, uint16_t>(_m, 0, row);
                 for (ptrdiff_t col = _roi.Left() + 1; col < _roi.Right() - 1; col += anchorScanInterval)
                 {
                     if (a[col])
-                        _anchors.push_back(Anchor(Point(col, row), At<A, uint16_t>(_m, col, row) / 2));
+                    {
+                        uint16_t val = m[col] / 2;
+                        _anchors.push_back(Anchor(Point(col, row), val));
+                        valMax = std::max(valMax, val);
+                    }
                 }
             }
 
-            std::stable_sort(_anchors.begin(), _anchors.end(), Anchor::Compare);
+            SortAnchors(valMax);
+        }
+
+        void SortAnchors(uint16_t valMax)
+        {
+            _histogram.assign(valMax + 2, 0);
+            for (size_t i = 0; i < _anchors.size(); ++i)
+                _histogram[valMax - _anchors[i].val + 1]++;
+            for (size_t i = 1; i < _histogram.size(); ++i)
+                _histogram[i] += _histogram[i - 1];
+            _buffer.assign(_anchors.begin(), _anchors.end());
+            for (size_t i = 0; i < _buffer.size(); ++i)
+                _anchors[_histogram[valMax - _buffer[i].val]++] = _buffer[i];
         }
 
-        void PerformSmartRouting(Contours & contours, size_t minSegmentLength, uint16_t gradientThreshold)
+        size_t StripeNumber() const
+        {
+            const ptrdiff_t STRIPE_HEIGHT_MIN = 64;
+            return (size_t)std::max<ptrdiff_t>(std::min<ptrdiff_t>(_threadNumber, _roi.Height() / STRIPE_HEIGHT_MIN), 1);
+        }
+
+        const Arena & PerformSmartRouting(size_t minSegmentLength, uint16_t gradientThreshold)
         {
             View e = _e.Region(_roi);
             Rect frame(1, 1, e.width - 1, e.height - 1);
             Simd::Fill(e.Region(frame).Ref(), 0);
             Simd::FillFrame(e, frame, 255);
 
-            for (size_t i = 0; i < _anchors.size(); i++)
+            size_t stripeNumber = StripeNumber();
+            _steps = stripeNumber > 1;
+            if (_steps)
             {
-                const Anchor & anchor = _anchors[i];
-                if (anchor.val > 0)
+                Simd::Parallel(0, stripeNumber, [&](size_t thread, size_t begin, size_t end)
                 {
-                    Contour contour;
-                    contour.reserve(200);
-                    SmartRoute(contours, contour, anchor.p.x, anchor.p.y, minSegmentLength, gradientThreshold, Unknown);
-                    if (contour.size() > minSegmentLength)
-                        contours.push_back(contour);
-                }
+                    const ptrdiff_t top = _roi.Top() + 1, height = _roi.Height() - 2;
+                    EstimateSteps(top + height * begin / stripeNumber, top + height * end / stripeNumber, gradientThreshold);
+                }, _threadNumber);
             }
+
+            _arena.Clear();
+            for (size_t i = 0; i < _anchors.size(); ++i)
+            {
+                const Anchor & anchor = _anchors[i];
+                if (anchor.val == 0)
+                    continue;
+                SmartRoute(anchor.p.x, anchor.p.y, minSegmentLength, gradientThreshold);
+                _arena.Close(minSegmentLength);
+            }
+            return _arena;
         }
 
-        void SmartRoute(Contours & contours, Contour & contour, ptrdiff_t x, ptrdiff_t y, size_t minSegmentLength, uint16_t gradientThreshold, Direction direction)
+        // A step of the walk from a point depends only on the metrics around it, so all steps can be estimated in parallel before the tracing.
+        // Each point keeps two steps (for both directions of its orientation): 0 - a side (-sx, -sy), 1 - a main direction, 2 - a side (sx, sy).
+        void EstimateSteps(ptrdiff_t begin, ptrdiff_t end, uint16_t gradientThreshold)
         {
-            switch (direction)
+            for (ptrdiff_t y = begin; y < end; ++y)
             {
-            case Unknown:
-                break;
-            case Left:
-                while (CheckMetricsForMagnitudeAndDirection(x, y, gradientThreshold, 1))
+                const uint16_t * m = &At<A, uint16_t>(_m, 0, y);
+                uint8_t * s = &At<A, uint8_t>(_s, 0, y);
+                for (ptrdiff_t x = _roi.Left() + 1; x < _roi.Right() - 1; ++x)
                 {
-                    if (At<A, uint8_t>(_e, x, y) == 0)
-                    {
-                        At<A, uint8_t>(_e, x, y) = 255;
-                        if (!contour.empty() && (std::abs(contour.back().x - x) > 1 || std::abs(contour.back().y - y) > 1))
-                        {
-                            if (contour.size() > minSegmentLength)
-                                contours.push_back(contour);
-                            contour.clear();
-                        }
-                        contour.push_back(Point(x, y));
-                    }
-                    if (CheckMetricsForMagnitudeMaximum(x - 1, y - 1, x - 1, y, x - 1, y + 1))
-                    {
-                        x--;
-                        y--;
-                    }
-                    else if (CheckMetricsForMagnitudeMaximum(x - 1, y + 1, x - 1, y, x - 1, y - 1))
-                    {
-                        x--;
-                        y++;
-                    }
-                    else
-                        x--;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
-                        break;
+                    if (m[x] < gradientThreshold)
+                        continue;
+                    Direction direction = (m[x] & 1) ? Right : Up;
+                    s[x] = uint8_t(EstimateStep(x, y, direction) | (EstimateStep(x, y, Direction(direction + 1)) << 2));
                 }
-                break;
-            case Right:
-                while (CheckMetricsForMagnitudeAndDirection(x, y, gradientThreshold, 1))
+            }
+        }
+
+        struct Offset
+        {
+            ptrdiff_t mx, my, sx, sy;
+        };
+
+        static SIMD_INLINE const Offset & Offsets(Direction direction)
+        {
+            static const Offset offsets[4] = { { 0, -1, -1, 0 }, { 0, 1, 1, 0 }, { 1, 0, 0, -1 }, { -1, 0, 0, -1 } };
+            return offsets[direction];
+        }
+
+        SIMD_INLINE int EstimateStep(ptrdiff_t x, ptrdiff_t y, Direction direction) const
+        {
+            const Offset & o = Offsets(direction);
+            const ptrdiff_t mx = o.mx, my = o.my, sx = o.sx, sy = o.sy;
+            ptrdiff_t x0 = x + mx + sx, y0 = y + my + sy, x1 = x + mx, y1 = y + my, x2 = x + mx - sx, y2 = y + my - sy;
+            if (CheckMetricsForMagnitudeMaximum(x0, y0, x1, y1, x2, y2))
+                return 2;
+            else if (CheckMetricsForMagnitudeMaximum(x2, y2, x1, y1, x0, y0))
+                return 0;
+            else
+                return 1;
+        }
+
+        void SmartRoute(ptrdiff_t x, ptrdiff_t y, size_t minSegmentLength, uint16_t gradientThreshold)
+        {
+            Tasks & tasks = _tasks;
+            tasks.clear();
+            tasks.push_back(Task(x, y, Unknown));
+            while (!tasks.empty())
+            {
+                Task task = tasks.back();
+                tasks.pop_back();
+                x = task.x;
+                y = task.y;
+                if (task.direction != Unknown)
+                    Walk(x, y, minSegmentLength, gradientThreshold, task.direction);
+
+                if (Visited(x, y) || At<A, uint16_t>(_m, x, y) < gradientThreshold)
+                    continue;
+
+                if ((At<A, uint16_t>(_m, x, y) & 1) == 0)
                 {
-                    if (At<A, uint8_t>(_e, x, y) == 0)
-                    {
-                        At<A, uint8_t>(_e, x, y) = 255;
-                        if (!contour.empty() && (std::abs(contour.back().x - x) > 1 || std::abs(contour.back().y - y) > 1))
-                        {
-                            if (contour.size() > minSegmentLength)
-                                contours.push_back(contour);
-                            contour.clear();
-                        }
-                        contour.push_back(Point(x, y));
-                    }
-                    if (CheckMetricsForMagnitudeMaximum(x + 1, y - 1, x + 1, y, x + 1, y + 1))
-                    {
-                        x++;
-                        y--;
-                    }
-                    else if (CheckMetricsForMagnitudeMaximum(x + 1, y + 1, x + 1, y, x + 1, y - 1))
-                    {
-                        x++;
-                        y++;
-                    }
-                    else
-                        x++;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
-                        break;
+                    tasks.push_back(Task(x, y, Down));
+                    tasks.push_back(Task(x, y, Up));
                 }
-                break;
-            case Up:
-                while (CheckMetricsForMagnitudeAndDirection(x, y, gradientThreshold, 0))
+                else
                 {
-                    if (At<A, uint8_t>(_e, x, y) == 0)
-                    {
-                        At<A, uint8_t>(_e, x, y) = 255;
-                        if (!contour.empty() && (std::abs(contour.back().x - x) > 1 || std::abs(contour.back().y - y) > 1))
-                        {
-                            if (contour.size() > minSegmentLength)
-                                contours.push_back(contour);
-                            contour.clear();
-                        }
-                        contour.push_back(Point(x, y));
-                    }
-                    if (CheckMetricsForMagnitudeMaximum(x - 1, y - 1, x, y - 1, x + 1, y - 1))
-                    {
-                        x--;
-                        y--;
-                    }
-                    else if (CheckMetricsForMagnitudeMaximum(x + 1, y - 1, x, y - 1, x - 1, y - 1))
-                    {
-                        x++;
-                        y--;
-                    }
-                    else
-                        y--;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
-                        break;
+                    tasks.push_back(Task(x, y, Left));
+                    tasks.push_back(Task(x, y, Right));
                 }
-                break;
-            case Down:
-                while (CheckMetricsForMagnitudeAndDirection(x, y, gradientThreshold, 0))
+            }
+        }
+
+        void Walk(ptrdiff_t & x, ptrdiff_t & y, size_t minSegmentLength, uint16_t gradientThreshold, Direction direction)
+        {
+            const Offset & o = Offsets(direction);
+            const ptrdiff_t mx = o.mx, my = o.my, sx = o.sx, sy = o.sy;
+            const int16_t orientation = direction == Right || direction == Left ? 1 : 0;
+            const int shift = (direction & 1) * 2;
+            Arena & arena = _arena;
+            while (CheckMetricsForMagnitudeAndDirection(x, y, gradientThreshold, orientation))
+            {
+                uint8_t & e = At<A, uint8_t>(_e, x, y);
+                if (e == 0)
                 {
-                    if (At<A, uint8_t>(_e, x, y) == 0)
+                    e = 255;
+                    if (arena.points.size() > arena.offsets.back())
                     {
-                        At<A, uint8_t>(_e, x, y) = 255;
-                        if (!contour.empty() && (std::abs(contour.back().x - x) > 1 || std::abs(contour.back().y - y) > 1))
-                        {
-                            if (contour.size() > minSegmentLength)
-                                contours.push_back(contour);
-                            contour.clear();
-                        }
-                        contour.push_back(Point(x, y));
+                        const Point & last = arena.points.back();
+                        if (std::abs(last.x - x) > 1 || std::abs(last.y - y) > 1)
+                            arena.Close(minSegmentLength);
                     }
-                    if (CheckMetricsForMagnitudeMaximum(x + 1, y + 1, x, y + 1, x - 1, y + 1))
-                    {
-                        x++;
-                        y++;
-                    }
-                    else if (CheckMetricsForMagnitudeMaximum(x - 1, y + 1, x, y + 1, x + 1, y + 1))
-                    {
-                        x--;
-                        y++;
-                    }
-                    else
-                        y++;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
-                        break;
+                    arena.points.push_back(Point(x, y));
                 }
-                break;
+                ptrdiff_t side = (_steps ? (At<A, uint8_t>(_s, x, y) >> shift) & 3 : EstimateStep(x, y, direction)) - 1;
+                x += mx + side * sx;
+                y += my + side * sy;
+                if (Visited(x, y))
+                    break;
             }
+        }
 
-            if (At<A, uint8_t>(_e, x, y) != 0 || At<A, uint16_t>(_m, x, y) < gradientThreshold)
-                return;
-
-            uint16_t d = At<A, uint16_t>(_m, x, y) & 1;
-            if (d == 0)
-            {
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Up);
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Down);
-            }
-            else if (d == 1)
-            {
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Right);
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Left);
-            }
+        SIMD_INLINE bool Visited(ptrdiff_t x, ptrdiff_t y) const
+        {
+            return At<A, uint8_t>(_e, x, y) != 0;
         }
 
         bool CheckMetricsForMagnitudeAndDirection(ptrdiff_t x, ptrdiff_t y, int16_t gradientThreshold, int16_t direction) const
@@ -28,6 +28,7 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdLoad.h"
+#include "Simd/SimdSet.h"
 
 namespace Simd
 {
@@ -39,62 +40,113 @@ namespace Simd
                 RED_TO_GRAY_WEIGHT * red + BGR_TO_GRAY_ROUND_TERM) >> BGR_TO_GRAY_AVERAGING_SHIFT;
         }
 
-        SIMD_INLINE int BgrToY(int blue, int green, int red)
+        struct Bt601
         {
-            return RestrictRange(((BLUE_TO_Y_WEIGHT*blue + GREEN_TO_Y_WEIGHT * green + RED_TO_Y_WEIGHT * red +
-                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + Y_ADJUST);
+            static const int Y_ADJUST = Base::Y_ADJUST;
+            static const int UV_ADJUST = Base::UV_ADJUST;
+
+            static const int Y_TO_RGB_WEIGHT = Base::Y_TO_RGB_WEIGHT;
+            static const int U_TO_BLUE_WEIGHT = Base::U_TO_BLUE_WEIGHT;
+            static const int U_TO_GREEN_WEIGHT = Base::U_TO_GREEN_WEIGHT;
+            static const int V_TO_GREEN_WEIGHT = Base::V_TO_GREEN_WEIGHT;
+            static const int V_TO_RED_WEIGHT = Base::V_TO_RED_WEIGHT;
+
+            static const int BLUE_TO_Y_WEIGHT = Base::BLUE_TO_Y_WEIGHT;
+            static const int GREEN_TO_Y_WEIGHT = Base::GREEN_TO_Y_WEIGHT;
+            static const int RED_TO_Y_WEIGHT = Base::RED_TO_Y_WEIGHT;
+            static const int BLUE_TO_U_WEIGHT = Base::BLUE_TO_U_WEIGHT;
+            static const int GREEN_TO_U_WEIGHT = Base::GREEN_TO_U_WEIGHT;
+            static const int RED_TO_U_WEIGHT = Base::RED_TO_U_WEIGHT;
+            static const int BLUE_TO_V_WEIGHT = Base::BLUE_TO_V_WEIGHT;
+            static const int GREEN_TO_V_WEIGHT = Base::GREEN_TO_V_WEIGHT;
+            static const int RED_TO_V_WEIGHT = Base::RED_TO_V_WEIGHT;
+        };
+
+        //KR and KB are red and blue luma coefficients multiplied by 10000.
+        template<int KR, int KB, bool full> struct YuvParam
+        {
+            static const int Y_ADJUST = full ? 0 : Base::Y_ADJUST;
+            static const int UV_ADJUST = Base::UV_ADJUST;
+
+            static const int Y_TO_RGB_WEIGHT = int((full ? 1.0 : 255.0 / 219.0) * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int((full ? 1.0 : 255.0 / 224.0) * 2.0 * (10000 - KB) / 10000.0 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int((full ? 1.0 : 255.0 / 224.0) * 2.0 * (10000 - KB) * KB / (10000.0 * (10000 - KR - KB)) * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int((full ? 1.0 : 255.0 / 224.0) * 2.0 * (10000 - KR) * KR / (10000.0 * (10000 - KR - KB)) * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int((full ? 1.0 : 255.0 / 224.0) * 2.0 * (10000 - KR) / 10000.0 * (1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+
+            static const int BLUE_TO_Y_WEIGHT = int((full ? 1.0 : 219.0 / 255.0) * KB / 10000.0 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int((full ? 1.0 : 219.0 / 255.0) * (10000 - KR - KB) / 10000.0 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int((full ? 1.0 : 219.0 / 255.0) * KR / 10000.0 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int((full ? 1.0 : 224.0 / 255.0) * 0.5 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int((full ? 1.0 : 224.0 / 255.0) * 0.5 * (10000 - KR - KB) / (10000 - KB) * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int((full ? 1.0 : 224.0 / 255.0) * 0.5 * KR / (10000 - KB) * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int((full ? 1.0 : 224.0 / 255.0) * 0.5 * KB / (10000 - KR) * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int((full ? 1.0 : 224.0 / 255.0) * 0.5 * (10000 - KR - KB) / (10000 - KR) * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int((full ? 1.0 : 224.0 / 255.0) * 0.5 * (1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        typedef YuvParam<2126, 722, false> Bt709;
+        typedef YuvParam<2627, 593, false> Bt2020;
+        typedef YuvParam<2990, 1140, true> Bt601Full;
+        typedef YuvParam<2126, 722, true> Bt709Full;
+        typedef YuvParam<2627, 593, true> Bt2020Full;
+
+        template<class T = Bt601> SIMD_INLINE int BgrToY(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_Y_WEIGHT*blue + T::GREEN_TO_Y_WEIGHT * green + T::RED_TO_Y_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::Y_ADJUST);
         }
 
-        SIMD_INLINE int BgrToU(int blue, int green, int red)
+        template<class T = Bt601> SIMD_INLINE int BgrToU(int blue, int green, int red)
         {
-            return RestrictRange(((BLUE_TO_U_WEIGHT*blue + GREEN_TO_U_WEIGHT * green + RED_TO_U_WEIGHT * red +
-                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + UV_ADJUST);
+            return RestrictRange(((T::BLUE_TO_U_WEIGHT*blue + T::GREEN_TO_U_WEIGHT * green + T::RED_TO_U_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::UV_ADJUST);
         }
 
-        SIMD_INLINE int BgrToV(int blue, int green, int red)
+        template<class T = Bt601> SIMD_INLINE int BgrToV(int blue, int green, int red)
         {
-            return RestrictRange(((BLUE_TO_V_WEIGHT*blue + GREEN_TO_V_WEIGHT * green + RED_TO_V_WEIGHT * red +
-                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + UV_ADJUST);
+            return RestrictRange(((T::BLUE_TO_V_WEIGHT*blue + T::GREEN_TO_V_WEIGHT * green + T::RED_TO_V_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::UV_ADJUST);
         }
 
-        SIMD_INLINE int YuvToBlue(int y, int u)
+        template<class T = Bt601> SIMD_INLINE int YuvToBlue(int y, int u)
         {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_BLUE_WEIGHT * (u - UV_ADJUST) +
+            return RestrictRange((T::Y_TO_RGB_WEIGHT*(y - T::Y_ADJUST) + T::U_TO_BLUE_WEIGHT * (u - T::UV_ADJUST) +
                 YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int YuvToGreen(int y, int u, int v)
+        template<class T = Bt601> SIMD_INLINE int YuvToGreen(int y, int u, int v)
         {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_GREEN_WEIGHT * (u - UV_ADJUST) +
-                V_TO_GREEN_WEIGHT * (v - UV_ADJUST) + YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
+            return RestrictRange((T::Y_TO_RGB_WEIGHT*(y - T::Y_ADJUST) + T::U_TO_GREEN_WEIGHT * (u - T::UV_ADJUST) +
+                T::V_TO_GREEN_WEIGHT * (v - T::UV_ADJUST) + YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int YuvToRed(int y, int v)
+        template<class T = Bt601> SIMD_INLINE int YuvToRed(int y, int v)
         {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + V_TO_RED_WEIGHT * (v - UV_ADJUST) +
+            return RestrictRange((T::Y_TO_RGB_WEIGHT*(y - T::Y_ADJUST) + T::V_TO_RED_WEIGHT * (v - T::UV_ADJUST) +
                 YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
+        template<class T = Bt601> SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
         {
-            bgr[0] = YuvToBlue(y, u);
-            bgr[1] = YuvToGreen(y, u, v);
-            bgr[2] = YuvToRed(y, v);
+            bgr[0] = YuvToBlue<T>(y, u);
+            bgr[1] = YuvToGreen<T>(y, u, v);
+            bgr[2] = YuvToRed<T>(y, v);
         }
 
-        SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
+        template<class T = Bt601> SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
         {
-            bgra[0] = YuvToBlue(y, u);
-            bgra[1] = YuvToGreen(y, u, v);
-            bgra[2] = YuvToRed(y, v);
+            bgra[0] = YuvToBlue<T>(y, u);
+            bgra[1] = YuvToGreen<T>(y, u, v);
+            bgra[2] = YuvToRed<T>(y, v);
             bgra[3] = alpha;
         }
 
-        SIMD_INLINE void YuvToRgb(int y, int u, int v, uint8_t* rgb)
+        template<class T = Bt601> SIMD_INLINE void YuvToRgb(int y, int u, int v, uint8_t* rgb)
         {
-            rgb[0] = YuvToRed(y, v);
-            rgb[1] = YuvToGreen(y, u, v);
-            rgb[2] = YuvToBlue(y, u);
+            rgb[0] = YuvToRed<T>(y, v);
+            rgb[1] = YuvToGreen<T>(y, u, v);
+            rgb[2] = YuvToBlue<T>(y, u);
         }
 
         SIMD_INLINE void BgrToHsv(int blue, int green, int red, uint8_t * hsv)
@@ -281,153 +333,183 @@ namespace Simd
                 bgr[2] = lightness;
             }
         }
+
+        const uint8_t DEPTH_REDUCTION_DITHER[4][4] = { { 0, 8, 2, 10 }, { 12, 4, 14, 6 }, { 3, 11, 1, 9 }, { 15, 7, 13, 5 } };
+
+        SIMD_INLINE void DepthReductionOffsets(size_t bitDepth, SimdDepthReductionType reduction, size_t row, uint16_t * offsets, size_t size = 4)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+            int shift = int(bitDepth - 8);
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (reduction == SimdDepthReductionDither)
+                    offsets[i] = uint16_t(((DEPTH_REDUCTION_DITHER[row & 3][i & 3] << shift) + (1 << (shift - 1))) >> 4);
+                else
+                    offsets[i] = uint16_t(1 << (shift - 1));
+            }
+        }
+
+        SIMD_INLINE uint8_t ReduceDepth(int value, int offset, int shift)
+        {
+            return (uint8_t)Min((Min(value + offset, 0xFFFF)) >> shift, 0xFF);
+        }
     }
 
 #ifdef SIMD_SSE2_ENABLE    
     namespace Sse2
     {
-        SIMD_INLINE __m128i AdjustY16(__m128i y16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustY16(__m128i y16)
         {
-            return _mm_subs_epi16(y16, K16_Y_ADJUST);
+            return _mm_subs_epi16(y16, _mm_set1_epi16(T::Y_ADJUST));
         }
 
-        SIMD_INLINE __m128i AdjustUV16(__m128i uv16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustUV16(__m128i uv16)
         {
-            return _mm_subs_epi16(uv16, K16_UV_ADJUST);
+            return _mm_subs_epi16(uv16, _mm_set1_epi16(T::UV_ADJUST));
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm_madd_epi16(v16_0, SetInt16<T::V_TO_RED_WEIGHT, 0>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
         {
             return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToRed32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
+                AdjustedYuvToRed32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm_madd_epi16(u16_v16, SetInt16<T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
         {
             return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToGreen32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
+                AdjustedYuvToGreen32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm_madd_epi16(u16_0, SetInt16<T::U_TO_BLUE_WEIGHT, 0>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
         {
             return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToBlue32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
+                AdjustedYuvToBlue32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
         }
 
-        SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
         {
-            __m128i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(v, K_ZERO)));
-            __m128i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(v, K_ZERO)));
+            __m128i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(v, K_ZERO)));
+            __m128i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(v, K_ZERO)));
             return _mm_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
         {
-            __m128i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(u, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(v, K_ZERO)));
-            __m128i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(u, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(v, K_ZERO)));
+            __m128i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(v, K_ZERO)));
+            __m128i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(v, K_ZERO)));
             return _mm_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
         {
-            __m128i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(u, K_ZERO)));
-            __m128i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(u, K_ZERO)));
+            __m128i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(u, K_ZERO)));
+            __m128i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(u, K_ZERO)));
             return _mm_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BY_RY),
-                _mm_madd_epi16(g16_1, K16_GY_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT>()),
+                _mm_madd_epi16(g16_1, SetInt16<T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
         {
-            return SaturateI16ToU8(_mm_add_epi16(K16_Y_ADJUST, _mm_packs_epi32(
-                BgrToY32(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
-                BgrToY32(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_ADJUST), _mm_packs_epi32(
+                BgrToY32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToY32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m128i BgrToY8(__m128i b8, __m128i g8, __m128i r8)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToY8(__m128i b8, __m128i g8, __m128i r8)
         {
             return _mm_packus_epi16(
-                BgrToY16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
-                BgrToY16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+                BgrToY16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m128i BgrToU32(__m128i b16_r16, __m128i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToU32(__m128i b16_r16, __m128i g16_1)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BU_RU),
-                _mm_madd_epi16(g16_1, K16_GU_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT>()),
+                _mm_madd_epi16(g16_1, SetInt16<T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
         {
-            return SaturateI16ToU8(_mm_add_epi16(K16_UV_ADJUST, _mm_packs_epi32(
-                BgrToU32(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
-                BgrToU32(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_ADJUST), _mm_packs_epi32(
+                BgrToU32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToU32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m128i BgrToU8(__m128i b8, __m128i g8, __m128i r8)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToU8(__m128i b8, __m128i g8, __m128i r8)
         {
             return _mm_packus_epi16(
-                BgrToU16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
-                BgrToU16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+                BgrToU16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m128i BgrToV32(__m128i b16_r16, __m128i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToV32(__m128i b16_r16, __m128i g16_1)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BV_RV),
-                _mm_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT>()),
+                _mm_madd_epi16(g16_1, SetInt16<T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
         {
-            return SaturateI16ToU8(_mm_add_epi16(K16_UV_ADJUST, _mm_packs_epi32(
-                BgrToV32(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
-                BgrToV32(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_ADJUST), _mm_packs_epi32(
+                BgrToV32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToV32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m128i BgrToV8(__m128i b8, __m128i g8, __m128i r8)
+        template<class T = Base::Bt601> SIMD_INLINE __m128i BgrToV8(__m128i b8, __m128i g8, __m128i r8)
         {
             return _mm_packus_epi16(
-                BgrToV16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
-                BgrToV16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+                BgrToV16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template <bool align, bool swap> SIMD_INLINE void LoadUv(const uint8_t * uv, __m128i & u, __m128i & v)
+        {
+            __m128i uv0 = Load<align>((__m128i*)uv + 0);
+            __m128i uv1 = Load<align>((__m128i*)uv + 1);
+            __m128i even = _mm_packus_epi16(_mm_and_si128(uv0, K16_00FF), _mm_and_si128(uv1, K16_00FF));
+            __m128i odd = _mm_packus_epi16(_mm_srli_epi16(uv0, 8), _mm_srli_epi16(uv1, 8));
+            u = swap ? odd : even;
+            v = swap ? even : odd;
         }
     }
 #endif// SIMD_SSE2_ENABLE
@@ -490,148 +572,148 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
-        SIMD_INLINE __m256i AdjustY16(__m256i y16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustY16(__m256i y16)
         {
-            return _mm256_subs_epi16(y16, K16_Y_ADJUST);
+            return _mm256_subs_epi16(y16, _mm256_set1_epi16(T::Y_ADJUST));
         }
 
-        SIMD_INLINE __m256i AdjustUV16(__m256i uv16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustUV16(__m256i uv16)
         {
-            return _mm256_subs_epi16(uv16, K16_UV_ADJUST);
+            return _mm256_subs_epi16(uv16, _mm256_set1_epi16(T::UV_ADJUST));
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm256_madd_epi16(v16_0, SetInt16<T::V_TO_RED_WEIGHT, 0>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
         {
             return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToRed32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
+                AdjustedYuvToRed32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm256_madd_epi16(u16_v16, SetInt16<T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
         {
             return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToGreen32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
+                AdjustedYuvToGreen32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm256_madd_epi16(u16_0, SetInt16<T::U_TO_BLUE_WEIGHT, 0>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
         {
             return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToBlue32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
+                AdjustedYuvToBlue32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
         }
 
-        SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
         {
-            __m256i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(v, K_ZERO)));
-            __m256i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(v, K_ZERO)));
+            __m256i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(v, K_ZERO)));
+            __m256i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(v, K_ZERO)));
             return _mm256_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
         {
-            __m256i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(u, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(v, K_ZERO)));
-            __m256i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(u, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(v, K_ZERO)));
+            __m256i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(v, K_ZERO)));
+            __m256i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(v, K_ZERO)));
             return _mm256_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
         {
-            __m256i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(u, K_ZERO)));
-            __m256i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(u, K_ZERO)));
+            __m256i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(u, K_ZERO)));
+            __m256i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(u, K_ZERO)));
             return _mm256_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BY_RY),
-                _mm256_madd_epi16(g16_1, K16_GY_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT>()),
+                _mm256_madd_epi16(g16_1, SetInt16<T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgrToY16(__m256i b16, __m256i g16, __m256i r16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToY16(__m256i b16, __m256i g16, __m256i r16)
         {
-            return SaturateI16ToU8(_mm256_add_epi16(K16_Y_ADJUST, _mm256_packs_epi32(
-                BgrToY32(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
-                BgrToY32(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::Y_ADJUST), _mm256_packs_epi32(
+                BgrToY32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToY32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m256i BgrToY8(__m256i b8, __m256i g8, __m256i r8)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToY8(__m256i b8, __m256i g8, __m256i r8)
         {
             return _mm256_packus_epi16(
-                BgrToY16(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
-                BgrToY16(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+                BgrToY16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m256i BgrToU32(__m256i b16_r16, __m256i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToU32(__m256i b16_r16, __m256i g16_1)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BU_RU),
-                _mm256_madd_epi16(g16_1, K16_GU_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT>()),
+                _mm256_madd_epi16(g16_1, SetInt16<T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgrToU16(__m256i b16, __m256i g16, __m256i r16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToU16(__m256i b16, __m256i g16, __m256i r16)
         {
-            return SaturateI16ToU8(_mm256_add_epi16(K16_UV_ADJUST, _mm256_packs_epi32(
-                BgrToU32(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
-                BgrToU32(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::UV_ADJUST), _mm256_packs_epi32(
+                BgrToU32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToU32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m256i BgrToU8(__m256i b8, __m256i g8, __m256i r8)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToU8(__m256i b8, __m256i g8, __m256i r8)
         {
             return _mm256_packus_epi16(
-                BgrToU16(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
-                BgrToU16(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+                BgrToU16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m256i BgrToV32(__m256i b16_r16, __m256i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToV32(__m256i b16_r16, __m256i g16_1)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BV_RV),
-                _mm256_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT>()),
+                _mm256_madd_epi16(g16_1, SetInt16<T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgrToV16(__m256i b16, __m256i g16, __m256i r16)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToV16(__m256i b16, __m256i g16, __m256i r16)
         {
-            return SaturateI16ToU8(_mm256_add_epi16(K16_UV_ADJUST, _mm256_packs_epi32(
-                BgrToV32(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
-                BgrToV32(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::UV_ADJUST), _mm256_packs_epi32(
+                BgrToV32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToV32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m256i BgrToV8(__m256i b8, __m256i g8, __m256i r8)
+        template<class T = Base::Bt601> SIMD_INLINE __m256i BgrToV8(__m256i b8, __m256i g8, __m256i r8)
         {
             return _mm256_packus_epi16(
-                BgrToV16(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
-                BgrToV16(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+                BgrToV16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
         }
 
         template <int index> __m256i GrayToBgr(__m256i gray);
@@ -730,93 +812,104 @@ namespace Simd
         {
             return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(rgb, 0xE9), K8_RGB_TO_BGRA_SHUFFLE), alpha);
         }
+
+        //Output u and v have the same lane order as LoadPermuted() of planar data.
+        template <bool align, bool swap> SIMD_INLINE void LoadUv(const uint8_t * uv, __m256i & u, __m256i & v)
+        {
+            __m256i uv0 = Load<align>((__m256i*)uv + 0);
+            __m256i uv1 = Load<align>((__m256i*)uv + 1);
+            __m256i even = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            __m256i odd = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+            u = swap ? odd : even;
+            v = swap ? even : odd;
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
-        SIMD_INLINE __m512i AdjustY16(__m512i y16)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustY16(__m512i y16)
         {
-            return _mm512_subs_epi16(y16, K16_Y_ADJUST);
+            return _mm512_subs_epi16(y16, _mm512_set1_epi16(T::Y_ADJUST));
         }
 
-        SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
         {
-            return _mm512_subs_epi16(uv16, K16_UV_ADJUST);
+            return _mm512_subs_epi16(uv16, _mm512_set1_epi16(T::UV_ADJUST));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm512_madd_epi16(v16_0, SetInt16<T::V_TO_RED_WEIGHT, 0>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
         {
             return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToRed32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
+                AdjustedYuvToRed32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm512_madd_epi16(u16_v16, SetInt16<T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
         {
             return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToGreen32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
+                AdjustedYuvToGreen32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16<T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM>()),
+                _mm512_madd_epi16(u16_0, SetInt16<T::U_TO_BLUE_WEIGHT, 0>())), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
         {
             return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToBlue32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
+                AdjustedYuvToBlue32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
         }
 
-        SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
         {
-            __m512i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(v, K_ZERO)));
-            __m512i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(v, K_ZERO)));
+            __m512i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(v, K_ZERO)));
+            __m512i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(v, K_ZERO)));
             return _mm512_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
         {
-            __m512i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(u, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(v, K_ZERO)));
-            __m512i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(u, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(v, K_ZERO)));
+            __m512i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(v, K_ZERO)));
+            __m512i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(v, K_ZERO)));
             return _mm512_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
         {
-            __m512i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(u, K_ZERO)));
-            __m512i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(u, K_ZERO)));
+            __m512i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(u, K_ZERO)));
+            __m512i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(u, K_ZERO)));
             return _mm512_packus_epi16(lo, hi);
         }
 
@@ -837,22 +930,22 @@ namespace Simd
             return _mm512_shuffle_epi8(_mm512_shuffle_i64x2(gray, gray, 0xFE), K8_SHUFFLE_GRAY_TO_BGR2);
         }
 
-        SIMD_INLINE __m512i BgrToY32(__m512i b16_r16, __m512i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i BgrToY32(__m512i b16_r16, __m512i g16_1)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, K16_BY_RY),
-                _mm512_madd_epi16(g16_1, K16_GY_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT>()),
+                _mm512_madd_epi16(g16_1, SetInt16<T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i BgrToU32(__m512i b16_r16, __m512i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i BgrToU32(__m512i b16_r16, __m512i g16_1)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, K16_BU_RU),
-                _mm512_madd_epi16(g16_1, K16_GU_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT>()),
+                _mm512_madd_epi16(g16_1, SetInt16<T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i BgrToV32(__m512i b16_r16, __m512i g16_1)
+        template<class T = Base::Bt601> SIMD_INLINE __m512i BgrToV32(__m512i b16_r16, __m512i g16_1)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, K16_BV_RV),
-                _mm512_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16<T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT>()),
+                _mm512_madd_epi16(g16_1, SetInt16<T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM>())), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
         template <int index> __m512i InterleaveBgr(__m512i blue, __m512i green, __m512i red);
@@ -880,6 +973,17 @@ namespace Simd
                     _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, green), K8_SHUFFLE_GREEN_TO_BGR2),
                         _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, red), K8_SHUFFLE_RED_TO_BGR2)));
         }
+
+        //Output u and v have the same lane order as planar data permuted with K64_PERMUTE_FOR_UNPACK.
+        template <bool align, bool mask, bool swap> SIMD_INLINE void LoadUv(const uint8_t * uv, __m512i & u, __m512i & v, const __mmask64 * tails)
+        {
+            __m512i uv0 = Load<align, mask>(uv + 0, tails[0]);
+            __m512i uv1 = Load<align, mask>(uv + A, tails[1]);
+            __m512i even = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+            __m512i odd = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+            u = swap ? odd : even;
+            v = swap ? even : odd;
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE 
 
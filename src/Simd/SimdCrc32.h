@@ -0,0 +1,90 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCrc32_h__
+#define __SimdCrc32_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint32_t CRC32C_POLY = 0x82F63B78;
+
+        // Multiplies two polynomials modulo reflected CRC32c polynomial.
+        SIMD_INLINE uint32_t Crc32cMultModP(uint32_t a, uint32_t b)
+        {
+            uint32_t m = uint32_t(1) << 31, p = 0;
+            for (;;)
+            {
+                if (a & m)
+                {
+                    p ^= b;
+                    if ((a & (m - 1)) == 0)
+                        break;
+                }
+                m >>= 1;
+                b = b & 1 ? (b >> 1) ^ CRC32C_POLY : b >> 1;
+            }
+            return p;
+        }
+
+        // Gets x^(8*size) modulo reflected CRC32c polynomial (operator which appends size zero bytes to CRC register).
+        SIMD_INLINE uint32_t Crc32cShiftOperator(size_t size)
+        {
+            uint32_t p = uint32_t(1) << 31, x2n = uint32_t(1) << 30;
+            for (size_t n = 0; n < 3; ++n)
+                x2n = Crc32cMultModP(x2n, x2n);
+            for (; size; size >>= 1)
+            {
+                if (size & 1)
+                    p = Crc32cMultModP(x2n, p);
+                x2n = Crc32cMultModP(x2n, x2n);
+            }
+            return p;
+        }
+
+        // Appends fixed number of zero bytes to CRC register with using of 4 lookup tables.
+        struct Crc32cShift
+        {
+            Crc32cShift(size_t size)
+            {
+                uint32_t op = Crc32cShiftOperator(size);
+                for (size_t i = 0; i < 4; ++i)
+                    for (size_t j = 0; j < 256; ++j)
+                        _table[i][j] = Crc32cMultModP(op, uint32_t(j) << (8 * i));
+            }
+
+            SIMD_INLINE uint32_t operator()(uint32_t crc) const
+            {
+                return _table[0][crc & 0xFF] ^ _table[1][(crc >> 8) & 0xFF] ^ _table[2][(crc >> 16) & 0xFF] ^ _table[3][crc >> 24];
+            }
+
+        private:
+            uint32_t _table[4][256];
+        };
+    }
+}
+
+#endif//__SimdCrc32_h__
@@ -0,0 +1,128 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCropAndResize_h__
+#define __SimdCropAndResize_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct CropAndResizeParam
+    {
+        size_t srcW, srcH, channels, dstW, dstH;
+        SimdResizeChannelType srcType;
+        SimdResizeMethodType method;
+        SimdTensorFormatType tensorFormat;
+        SimdTensorDataType tensorType;
+        float lower[4], upper[4];
+
+        CropAndResizeParam(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+            SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType)
+        {
+            this->srcW = srcWidth;
+            this->srcH = srcHeight;
+            this->channels = channels;
+            this->srcType = srcType;
+            this->dstW = dstWidth;
+            this->dstH = dstHeight;
+            this->method = method;
+            this->tensorFormat = tensorFormat;
+            this->tensorType = tensorType;
+            for (size_t c = 0; c < 4; ++c)
+            {
+                this->lower[c] = lower && c < channels ? lower[c] : 0.0f;
+                this->upper[c] = upper && c < channels ? upper[c] : 255.0f;
+            }
+        }
+
+        bool Valid() const
+        {
+            return srcW > 0 && srcH > 0 && dstW > 0 && dstH > 0 && channels >= 1 && channels <= 4 &&
+                (srcType == SimdResizeChannelByte || srcType == SimdResizeChannelFloat) &&
+                (method == SimdResizeMethodBilinear || method == SimdResizeMethodArea) &&
+                (tensorFormat == SimdTensorFormatNchw || tensorFormat == SimdTensorFormatNhwc) &&
+                (tensorType == SimdTensorData32f || tensorType == SimdTensorData8u);
+        }
+
+        size_t SrcPixelSize() const
+        {
+            return channels * (srcType == SimdResizeChannelFloat ? 4 : 1);
+        }
+
+        size_t TensorSize() const
+        {
+            return dstW * dstH * channels * (tensorType == SimdTensorData32f ? 4 : 1);
+        }
+    };
+
+    namespace Base
+    {
+        class CropAndResize : public Deletable
+        {
+        public:
+            CropAndResize(const CropAndResizeParam & param);
+
+            void Run(const uint8_t * src, size_t srcStride, const float * rois, size_t roiCount, uint8_t * dst) const;
+
+        protected:
+            struct Buffer
+            {
+                Array32i ix, iy, index;
+                Array32f wx, wy, weight, rows, out;
+            };
+
+            virtual void VerticalRow8u(const uint8_t * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const;
+            virtual void VerticalRow32f(const float * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const;
+            virtual void HorizontalRow(const float * src, const int32_t * index, const float * weight, size_t taps, size_t size, float * dst) const;
+
+            void RunRoi(const uint8_t * src, size_t srcStride, const float * roi, Buffer & buf, uint8_t * dst) const;
+
+            CropAndResizeParam _param;
+            Array32f _k, _b;
+        };
+
+        void * CropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+            SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class CropAndResize : public Base::CropAndResize
+        {
+        public:
+            CropAndResize(const CropAndResizeParam & param);
+
+        protected:
+            virtual void VerticalRow8u(const uint8_t * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const;
+            virtual void VerticalRow32f(const float * src, size_t stride, size_t size, const float * weight, size_t taps, float * dst) const;
+            virtual void HorizontalRow(const float * src, const int32_t * index, const float * weight, size_t taps, size_t size, float * dst) const;
+        };
+
+        void * CropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+            SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+#endif//__SimdCropAndResize_h__
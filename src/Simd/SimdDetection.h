@@ -116,6 +116,7 @@ namespace Simd
             bool isThroughColumn;
             bool hasTilted;
             bool isInt16;
+            bool isAdaptiveStep;
             int ncategories;
 
             virtual ~HidBase() {}
@@ -180,6 +181,7 @@ namespace Simd
 
             float windowArea;
             float invWinArea;
+            float skipThreshold;
             uint32_t *pq[4];
             uint32_t *p[4];
 
@@ -239,6 +241,8 @@ namespace Simd
             Subsets subsets;
             Features features;
 
+            TWeight skipThreshold;
+
             Image sum;
             Image isum;
 
@@ -295,6 +299,17 @@ namespace Simd
 
         int Detect32f(const struct HidHaarCascade & hid, size_t offset, int startStage, float norm);
 
+        float StageSum32f(const struct HidHaarCascade & hid, int i_stage, size_t offset, float norm);
+
+        SIMD_INLINE int Detect32f(const HidHaarCascade & hid, size_t offset, float norm, uint8_t & skip)
+        {
+            float sum = StageSum32f(hid, 0, offset, norm);
+            skip = sum < hid.skipThreshold ? 1 : 0;
+            if (sum < hid.stages[0].threshold)
+                return 0;
+            return Detect32f(hid, offset, 1, norm) > 0 ? 1 : 0;
+        }
+
         template< class T> SIMD_INLINE T IntegralSum(const T * p0, const T * p1, const T * p2, const T * p3, ptrdiff_t offset)
         {
             return p0[offset] - p1[offset] - p2[offset] + p3[offset];
@@ -315,6 +330,22 @@ namespace Simd
                 (IntegralSum(feature.p[4], feature.p[5], feature.p[8], feature.p[9], offset) >= central ? 1 : 0);
         }
 
+        template<class TWeight, class TSum> SIMD_INLINE TWeight StageSum(const HidLbpCascade<TWeight, TSum> & hid, int i_stage, size_t offset)
+        {
+            typedef HidLbpCascade<TWeight, TSum> Hid;
+
+            size_t subsetSize = (hid.ncategories + 31) / 32;
+            const typename Hid::Stage & stage = hid.stages[i_stage];
+            TWeight sum = 0;
+            for (int nodeOffset = stage.first, end = stage.first + stage.ntrees; nodeOffset < end; nodeOffset++)
+            {
+                int c = Calculate(hid.features[hid.nodes[nodeOffset].featureIdx], offset);
+                const int * subset = hid.subsets.data() + nodeOffset*subsetSize;
+                sum += hid.leaves[subset[c >> 5] & (1 << (c & 31)) ? 2 * nodeOffset : 2 * nodeOffset + 1];
+            }
+            return sum;
+        }
+
         template<class TWeight, class TSum> inline int Detect(const HidLbpCascade<TWeight, TSum> & hid, size_t offset, int startStage)
         {
             typedef HidLbpCascade<TWeight, TSum> Hid;
@@ -346,6 +377,15 @@ namespace Simd
             }
             return 1;
         }
+
+        template<class TWeight, class TSum> SIMD_INLINE int Detect(const HidLbpCascade<TWeight, TSum> & hid, size_t offset, uint8_t & skip)
+        {
+            TWeight sum = StageSum(hid, 0, offset);
+            skip = sum < hid.skipThreshold ? 1 : 0;
+            if (sum < hid.stages[0].threshold)
+                return 0;
+            return Detect(hid, offset, 1) > 0 ? 1 : 0;
+        }
     }
 }
 
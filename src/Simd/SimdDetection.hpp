@@ -31,8 +31,12 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 #include <limits.h>
+#include <math.h>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -40,6 +44,67 @@
 
 namespace Simd
 {
+    /*! \cond PRIVATE */
+    // Estimates the source indexes and alphas of destination points [begin, end) exactly as ::SimdResizeBilinear does for the whole image.
+    SIMD_INLINE void ResizeBilinearAlphaIndex(size_t srcSize, size_t dstSize, ptrdiff_t begin, ptrdiff_t end, size_t channels, int * indexes, int * alphas)
+    {
+        const int FRACTION_RANGE = 1 << 4;
+        float scale = (float)srcSize / dstSize;
+        for (ptrdiff_t i = begin; i < end; ++i)
+        {
+            float alpha = (float)((i + 0.5)*scale - 0.5);
+            ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+            alpha -= index;
+            if (index < 0)
+            {
+                index = 0;
+                alpha = 0;
+            }
+            if (index > (ptrdiff_t)srcSize - 2)
+            {
+                index = srcSize - 2;
+                alpha = 1;
+            }
+            for (size_t c = 0; c < channels; c++)
+            {
+                size_t offset = (i - begin)*channels + c;
+                indexes[offset] = (int)(channels*index + c);
+                alphas[offset] = (int)(alpha * FRACTION_RANGE + 0.5);
+            }
+        }
+    }
+
+    // Resizes the image with bilinear interpolation only inside the given region of the output image.
+    // The region pixels are equal to the ones of Simd::ResizeBilinear for the whole output image.
+    template<template<class> class A> SIMD_INLINE void ResizeBilinear(const View<A> & src, View<A> & dst, const Rectangle<ptrdiff_t> & region)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1 && Rectangle<ptrdiff_t>(dst.Size()).Contains(region));
+
+        const int LINEAR_SHIFT = 4, BILINEAR_SHIFT = LINEAR_SHIFT * 2, BILINEAR_ROUND_TERM = 1 << (BILINEAR_SHIFT - 1);
+        const size_t channels = src.ChannelCount(), size = region.Width() * channels;
+        std::vector<int> ix(size), ax(size), iy(region.Height()), ay(region.Height()), rows(2 * size);
+        ResizeBilinearAlphaIndex(src.width, dst.width, region.left, region.right, channels, ix.data(), ax.data());
+        ResizeBilinearAlphaIndex(src.height, dst.height, region.top, region.bottom, 1, iy.data(), ay.data());
+        for (ptrdiff_t y = 0; y < region.Height(); ++y)
+        {
+            for (int k = 0; k < 2; ++k)
+            {
+                const uint8_t * ps = src.data + (iy[y] + k)*src.stride;
+                int * pb = rows.data() + k * size;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    int t = ps[ix[x]];
+                    pb[x] = (t << LINEAR_SHIFT) + (ps[ix[x] + channels] - t)*ax[x];
+                }
+            }
+            const int * pb0 = rows.data(), * pb1 = pb0 + size, fy = ay[y];
+            uint8_t * pd = dst.data + (region.top + y)*dst.stride + region.left*channels;
+            for (size_t x = 0; x < size; ++x)
+                pd[x] = (uint8_t)(((pb0[x] << LINEAR_SHIFT) + (pb1[x] - pb0[x])*fy + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT);
+        }
+    }
+    /*! \endcond */
+
     /*! @ingroup cpp_detection
 
         \short The Detection structure provides object detection with using of HAAR and LBP cascade classifiers.
@@ -198,6 +263,7 @@ namespace Simd
             Creates a new empty Detection structure.
         */
         Detection()
+            : _adaptiveStep(0.0f)
         {
         }
 
@@ -211,7 +277,7 @@ namespace Simd
         }
 
         /*!
-            Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type.
+            Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type and binary cascades saved with Detection::Save.
             You can call this function more than once if you want to use several object detectors at the same time.
 
             \note Tree based cascades and old cascade formats are not supported!
@@ -263,6 +329,20 @@ namespace Simd
             return handle != NULL;
         }
 
+        /*!
+            Saves loaded classifier cascade to file in binary format. The binary cascade is loaded much faster than XML one.
+
+            \param [in] path - a path to output file.
+            \param [in] index - an index of loaded cascade.
+            \return a result of this operation.
+        */
+        bool Save(const std::string & path, size_t index = 0) const
+        {
+            if (index >= _data.size())
+                return false;
+            return ::SimdDetectionSaveA(_data[index].handle, path.c_str()) == ::SimdTrue;
+        }
+
         /*!
             Prepares Detection structure to work with image of given size.
 
@@ -287,6 +367,20 @@ namespace Simd
             return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
         }
 
+        /*!
+            Sets adaptive step mode for all cascades (see ::SimdDetectionSetAdaptiveStep).
+            In this mode neighbours of strongly rejected windows are skipped. It increases performance on mostly empty scenes.
+
+            \param [in] level - a level of skipping in range [0, 1]. Zero value disables adaptive step mode.
+        */
+        void SetAdaptiveStep(float level)
+        {
+            _adaptiveStep = level;
+            for (size_t i = 0; i < _levels.size(); ++i)
+                for (size_t j = 0; j < _levels[i]->hids.size(); ++j)
+                    ::SimdDetectionSetAdaptiveStep(_levels[i]->hids[j].handle, _adaptiveStep);
+        }
+
         /*!
             Detects objects at given image.
 
@@ -307,7 +401,7 @@ namespace Simd
             if (_levels.empty() || src.Size() != _imageSize)
                 return false;
 
-            FillLevels(src);
+            FillLevels(src, motionMask, motionRegions);
 
             typedef std::map<Tag, Objects> Candidates;
             Candidates candidates;
@@ -315,22 +409,12 @@ namespace Simd
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
+                if (level.current.Empty())
                     continue;
                 for (size_t j = 0; j < level.hids.size(); ++j)
                 {
                     Hid & hid = level.hids[j];
-
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
-
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
+                    AddObjects(candidates[hid.data->tag], hid.dst, level.current, hid.data->size, level.scale,
                         level.throughColumn ? 2 : 1, hid.data->tag);
                 }
             }
@@ -370,21 +454,25 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
+            View dst;
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
+            void Prepare(const Rect & fill, const Rect & rect)
             {
-                SIMD_CHECK_PERFORMANCE();
+                Simd::Fill(dst.Region(Area(rect)).Ref(), 0);
+                ::SimdDetectionPrepareRegion(handle, fill.left, fill.top, fill.right + 1, fill.bottom + 1);
+            }
 
+            void Detect(const View & mask, const Rect & rect, ptrdiff_t begin, ptrdiff_t end)
+            {
                 Size s = dst.Size() - data->size;
                 View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
-                Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
+                Rect a = Area(rect);
+                detect(handle, m.data, m.stride, a.left, begin, a.right, end, dst.data, dst.stride);
+            }
 
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
+            Rect Area(const Rect & rect) const
+            {
+                return rect.Shifted(-data->size / 2).Intersection(Rect(dst.Size() - data->size));
             }
         };
         typedef std::vector<Hid> Hids;
@@ -399,6 +487,8 @@ namespace Simd
             View mask;
 
             Rect rect;
+            Rect current;
+            Rect fill;
 
             View sum;
             View sqsum;
@@ -423,6 +513,7 @@ namespace Simd
         Size _imageSize;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
+        float _adaptiveStep;
         LevelPtrs _levels;
 
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
@@ -466,8 +557,6 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
@@ -477,6 +566,7 @@ namespace Simd
                             level.sqsum.data, level.sqsum.stride, level.tilted.data, level.tilted.stride, level.throughColumn, _data[i].Int16());
                         if (handle)
                         {
+                            ::SimdDetectionSetAdaptiveStep(handle, _adaptiveStep);
                             Hid hid;
                             hid.handle = handle;
                             hid.data = &_data[i];
@@ -498,6 +588,10 @@ namespace Simd
                         _needNormalization = _needNormalization | _data[i].Haar();
                     }
 
+                    level.dst.Recreate(scaledSize.x, scaledSize.y * level.hids.size(), View::Gray8);
+                    for (size_t i = 0; i < level.hids.size(); ++i)
+                        level.hids[i].dst = level.dst.Region(0, scaledSize.y * i, scaledSize.x, scaledSize.y * (i + 1));
+
                     level.rect = Rect(level.roi.Size());
                     if (roi.format == View::None)
                         Simd::Fill(level.roi, 255);
@@ -513,7 +607,22 @@ namespace Simd
             return !_levels.empty();
         }
 
-        void FillLevels(View src)
+        struct Task
+        {
+            size_t level;
+            Hid * hid;
+            ptrdiff_t begin, end;
+
+            Task(size_t l, Hid * h = NULL, ptrdiff_t b = 0, ptrdiff_t e = 0) : level(l), hid(h), begin(b), end(e) {}
+        };
+        typedef std::vector<Task> Tasks;
+
+        Tasks _tasks;
+        std::vector<size_t> _ready;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+
+        void FillLevels(View src, bool motionMask, const Rects & motionRegions)
         {
             View gray;
             if (src.format != View::Gray8)
@@ -526,39 +635,176 @@ namespace Simd
             Simd::ResizeBilinear(src, _levels[0]->src);
             if (_needNormalization)
                 Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+
+            _tasks.clear();
+            for (size_t i = 0; i < _levels.size(); ++i)
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
-                EstimateIntegral(*_levels[i]);
+                Level & level = *_levels[i];
+                level.current = level.rect;
+                if (motionMask)
+                    level.current = MotionRect(motionRegions, level);
+                level.fill = FillRect(level);
+                _tasks.push_back(Task(i));
             }
+
+            size_t windows = 0;
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                for (size_t j = 0; j < level.hids.size() && !level.current.Empty(); ++j)
+                    windows += Windows(level, level.hids[j].Area(level.current));
+            }
+            size_t threadNumber = ThreadNumber(windows);
+            size_t chunk = std::max<size_t>(windows / (threadNumber * 8), 1);
+
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                ptrdiff_t step = level.throughColumn ? 2 : 1;
+                for (size_t j = 0; j < level.hids.size() && !level.current.Empty(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    Rect area = hid.Area(level.current);
+                    if (area.Empty())
+                        continue;
+                    size_t rowWindows = (area.Width() + step - 1) / step;
+                    ptrdiff_t rows = std::max<ptrdiff_t>(chunk / rowWindows, 1) * step;
+                    for (ptrdiff_t row = area.top; row < area.bottom; row += rows)
+                        _tasks.push_back(Task(i, &hid, row, std::min(row + rows, area.bottom)));
+                }
+            }
+
+            _ready.assign(_levels.size(), 0);
+            Execute(threadNumber, motionMask, motionRegions);
+        }
+
+        size_t Windows(const Level & level, const Rect & area) const
+        {
+            if (area.Empty())
+                return 0;
+            size_t step = level.throughColumn ? 2 : 1;
+            return ((area.Width() + step - 1) / step) * ((area.Height() + step - 1) / step);
+        }
+
+        size_t ThreadNumber(size_t windows) const
+        {
+#ifdef SIMD_FUTURE_DISABLE
+            return 1;
+#else
+            return windows >= 10000 ? std::max<size_t>(_threadNumber, 1) : 1;
+#endif
+        }
+
+        void Execute(size_t threadNumber, bool motionMask, const Rects & motionRegions)
+        {
+            std::atomic<size_t> next(0);
+            auto worker = [&]()
+            {
+                for (size_t i = next++; i < _tasks.size(); i = next++)
+                    Run(_tasks[i], motionMask, motionRegions);
+            };
+#ifndef SIMD_FUTURE_DISABLE
+            std::vector<std::future<void>> futures;
+            for (size_t thread = 1; thread < threadNumber; ++thread)
+                futures.push_back(std::async(std::launch::async, worker));
+            worker();
+            for (size_t i = 0; i < futures.size(); ++i)
+                futures[i].wait();
+#else
+            worker();
+#endif
+        }
+
+        void Run(const Task & task, bool motionMask, const Rects & motionRegions)
+        {
+            Level & level = *_levels[task.level];
+            if (task.hid == NULL)
+            {
+                if (!level.fill.Empty())
+                {
+                    if (task.level)
+                        Resize(level);
+                    EstimateIntegral(level);
+                    if (motionMask)
+                        FillMotionMask(motionRegions, level);
+                    for (size_t j = 0; j < level.hids.size(); ++j)
+                        level.hids[j].Prepare(level.fill, level.current);
+                }
+                std::lock_guard<std::mutex> lock(_mutex);
+                _ready[task.level] = 1;
+                _condition.notify_all();
+            }
+            else
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _condition.wait(lock, [&] { return _ready[task.level] != 0; });
+                }
+                task.hid->Detect(motionMask ? level.mask : level.roi, level.current, task.begin, task.end);
+            }
+        }
+
+        Rect FillRect(const Level & level) const
+        {
+            Rect fill;
+            for (size_t i = 0; i < level.hids.size() && !level.current.Empty(); ++i)
+            {
+                Rect area = level.hids[i].Area(level.current);
+                // Through column cascades evaluate a window at odd column from the previous even column of the prepared sum.
+                if (level.throughColumn)
+                    area.left = area.left & ~ptrdiff_t(1);
+                if (!area.Empty())
+                    fill |= Rect(area.left, area.top, area.right + level.hids[i].data->size.x, area.bottom + level.hids[i].data->size.y);
+            }
+            fill &= Rect(level.src.Size());
+            return fill;
+        }
+
+        void Resize(Level & level)
+        {
+            const View & src = _levels[0]->src;
+            if (level.fill == Rect(level.src.Size()))
+                Simd::ResizeBilinear(src, level.src);
+            else
+                Simd::ResizeBilinear(src, level.src, level.fill);
         }
 
         void EstimateIntegral(Level & level)
         {
+            const Rect & f = level.fill;
+            Rect r(f.left, f.top, f.right + 1, f.bottom + 1);
+            View src = level.src.Region(f), sum = level.sum.Region(r), sqsum = level.sqsum.Region(r), tilted = level.tilted.Region(r);
             if (level.needSqsum)
             {
                 if (level.needTilted)
-                    Simd::Integral(level.src, level.sum, level.sqsum, level.tilted);
+                    Simd::Integral(src, sum, sqsum, tilted);
                 else
-                    Simd::Integral(level.src, level.sum, level.sqsum);
+                    Simd::Integral(src, sum, sqsum);
             }
             else
-                Simd::Integral(level.src, level.sum);
+                Simd::Integral(src, sum);
         }
 
-        void FillMotionMask(const Rects & rects, Level & level, Rect & rect) const
+        Rect MotionRect(const Rects & rects, const Level & level) const
         {
-            Simd::Fill(level.mask, 0);
-            rect = Rect();
+            Rect rect;
+            for (size_t i = 0; i < rects.size(); i++)
+                rect |= rects[i] / level.scale;
+            rect &= level.rect;
+            return rect;
+        }
+
+        void FillMotionMask(const Rects & rects, Level & level) const
+        {
+            View mask = level.mask.Region(level.current);
+            Simd::Fill(mask, 0);
             for (size_t i = 0; i < rects.size(); i++)
             {
                 Rect r = rects[i] / level.scale;
-                rect |= r;
+                r &= level.current;
                 Simd::Fill(level.mask.Region(r).Ref(), 0xFF);
             }
-            rect &= level.rect;
-            Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
+            Simd::OperationBinary8u(mask, level.roi.Region(level.current), mask, SimdOperationBinary8uAnd);
         }
 
         void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
@@ -64,6 +64,12 @@ namespace Simd
             Gray8,
             /*! One plane 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
             Rgb24,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P010 pixel format. Significant 10 bits are stored in high bits. */
+            P010,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P 10-bit (I010) pixel format. Significant 10 bits are stored in low bits. */
+            Yuv420p10,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P 16-bit pixel format. */
+            Yuv420p16,
         };
 
         const size_t width; /*!< \brief A width of the frame. */
@@ -337,6 +343,8 @@ namespace Simd
         \short Converts one frame to another frame.
 
         The frames must have the same width and height.
+        10-bit and 16-bit formats (Frame::P010, Frame::Yuv420p10, Frame::Yuv420p16) are supported only as input formats.
+        They are converted with BT.601 color matrix and rounding (see ::SimdDepthReductionRound).
 
         \param [in] src - an input frame.
         \param [out] dst - an output frame.
@@ -441,6 +449,18 @@ namespace Simd
         case Rgb24:
             planes[0] = View<A>(width, height, stride0, View<A>::Rgb24, data0);
             break;
+        case P010:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int32, data1);
+            break;
+        case Yuv420p10:
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width / 2, height / 2, stride2, View<A>::Int16, data2);
+            break;
         default:
             assert(0);
         }
@@ -531,6 +551,18 @@ namespace Simd
         case Rgb24:
             planes[0].Recreate(width, height, View<A>::Rgb24);
             break;
+        case P010:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int32);
+            break;
+        case Yuv420p10:
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int16);
+            planes[2].Recreate(width / 2, height / 2, View<A>::Int16);
+            break;
         default:
             assert(0);
         }
@@ -556,7 +588,7 @@ namespace Simd
             right = std::min<ptrdiff_t>(std::max<ptrdiff_t>(right, 0), width);
             bottom = std::min<ptrdiff_t>(std::max<ptrdiff_t>(bottom, 0), height);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (PlaneCount() > 1)
             {
                 left = left & ~1;
                 top = top & ~1;
@@ -573,10 +605,10 @@ namespace Simd
 
             frame.planes[0] = planes[0].Region(left, top, right, bottom);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (PlaneCount() > 1)
                 frame.planes[1] = planes[1].Region(left / 2, top / 2, right / 2, bottom / 2);
 
-            if (format == Yuv420p)
+            if (PlaneCount() > 2)
                 frame.planes[2] = planes[2].Region(left / 2, top / 2, right / 2, bottom / 2);
 
             return frame;
@@ -647,6 +679,9 @@ namespace Simd
         case Bgr24:   return 1;
         case Gray8:   return 1;
         case Rgb24:   return 1;
+        case P010:    return 2;
+        case Yuv420p10: return 3;
+        case Yuv420p16: return 3;
         default: assert(0); return 0;
         }
     }
@@ -683,6 +718,40 @@ namespace Simd
         }
     }
 
+    /*! \cond PRIVATE */
+    // Converts P010, Yuv420p10 and Yuv420p16 frames to Nv12, Bgr24 or Rgb24 through small 8-bit Yuv420p strips,
+    // so that no temporary full size image is allocated.
+    template <template<class> class A> SIMD_INLINE void ConvertYuv16ByStrips(const Frame<A> & src, Frame<A> & dst)
+    {
+        const size_t bitDepth = src.format == Frame<A>::Yuv420p10 ? 10 : 16, strip = std::min<size_t>(src.height, 16);
+        Frame<A> buffer(src.width, strip, Frame<A>::Yuv420p);
+        for (size_t row = 0; row < src.height; row += strip)
+        {
+            const ptrdiff_t top = row, bottom = std::min(row + strip, src.height), width = src.width;
+            Frame<A> s = src.Region(0, top, width, bottom), d = dst.Region(0, top, width, bottom), b = buffer.Region(0, 0, width, bottom - top);
+            View<A> & y = dst.format == Frame<A>::Nv12 ? d.planes[0] : b.planes[0];
+            if (src.format == Frame<A>::P010)
+                P010ToYuv420p(s.planes[0], s.planes[1], y, b.planes[1], b.planes[2]);
+            else
+                Yuv420p16ToYuv420p(s.planes[0], s.planes[1], s.planes[2], y, b.planes[1], b.planes[2], bitDepth);
+            switch (dst.format)
+            {
+            case Frame<A>::Nv12:
+                InterleaveUv(b.planes[1], b.planes[2], d.planes[1]);
+                break;
+            case Frame<A>::Bgr24:
+                Yuv420pToBgr(b.planes[0], b.planes[1], b.planes[2], d.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+                Yuv420pToRgb(b.planes[0], b.planes[1], b.planes[2], d.planes[0]);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+    /*! \endcond */
+
     template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
     {
         assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
@@ -703,31 +772,17 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr);
-                BgrToRgb(bgr, dst.planes[0]);
+                Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             default:
                 assert(0);
             }
@@ -750,12 +805,8 @@ namespace Simd
                 Copy(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], bgr);
-                BgrToRgb(bgr, dst.planes[0]);
+                Yuv420pToRgb(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
                 break;
-            }
             default:
                 assert(0);
             }
@@ -872,6 +923,62 @@ namespace Simd
             default:
                 assert(0);
             }
+            break;
+
+        case Frame<A>::P010:
+            switch (dst.format)
+            {
+            case Frame<A>::Yuv420p:
+                P010ToYuv420p(src.planes[0], src.planes[1], dst.planes[0], dst.planes[1], dst.planes[2]);
+                break;
+            case Frame<A>::Bgra32:
+                P010ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
+                break;
+            case Frame<A>::Gray8:
+                Uint16ToGray(src.planes[0], dst.planes[0], 16);
+                break;
+            case Frame<A>::Nv12:
+            {
+                const View<A> & uv = src.planes[1];
+                Uint16ToGray(src.planes[0], dst.planes[0], 16);
+                Uint16ToGray(View<A>(src.width, uv.height, uv.stride, View<A>::Int16, uv.data),
+                    View<A>(src.width, dst.planes[1].height, dst.planes[1].stride, View<A>::Gray8, dst.planes[1].data).Ref(), 16);
+                break;
+            }
+            case Frame<A>::Bgr24:
+            case Frame<A>::Rgb24:
+                ConvertYuv16ByStrips(src, dst);
+                break;
+            default:
+                assert(0);
+            }
+            break;
+
+        case Frame<A>::Yuv420p10:
+        case Frame<A>::Yuv420p16:
+        {
+            size_t bitDepth = src.format == Frame<A>::Yuv420p10 ? 10 : 16;
+            switch (dst.format)
+            {
+            case Frame<A>::Yuv420p:
+                Yuv420p16ToYuv420p(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], dst.planes[1], dst.planes[2], bitDepth);
+                break;
+            case Frame<A>::Bgra32:
+                Yuv420p16ToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], bitDepth);
+                break;
+            case Frame<A>::Gray8:
+                Uint16ToGray(src.planes[0], dst.planes[0], bitDepth);
+                break;
+            case Frame<A>::Nv12:
+            case Frame<A>::Bgr24:
+            case Frame<A>::Rgb24:
+                ConvertYuv16ByStrips(src, dst);
+                break;
+            default:
+                assert(0);
+            }
+            break;
+        }
 
         default:
             assert(0);
@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGaussianBlur_h__
+#define __SimdGaussianBlur_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct BlurParam
+    {
+        size_t width, height, channels, typeSize;
+        float sigma;
+
+        BlurParam(size_t width, size_t height, size_t channels, size_t typeSize, const float * sigma)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = channels;
+            this->typeSize = typeSize;
+            this->sigma = sigma ? *sigma : 0.0f;
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && channels >= 1 && channels <= 4 && sigma > 0.0f && sigma < 1000.0f;
+        }
+
+        bool Recursive() const
+        {
+            return sigma > 3.0f;
+        }
+
+        size_t Radius() const
+        {
+            return Recursive() ? 0 : (size_t)::ceil(3.0f * sigma);
+        }
+    };
+
+    namespace Base
+    {
+        const size_t BLUR_KERNEL_MAX = 19;
+
+        class GaussianBlurFilter : public Deletable
+        {
+        public:
+            GaussianBlurFilter(const BlurParam & param);
+
+            void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            virtual void VerticalSum(const uint8_t * src, size_t srcStride, size_t row, float * dst) const;
+            virtual void HorizontalSum(const float * src, uint8_t * dst) const;
+            virtual void RecursiveRows(const uint8_t * src, size_t srcStride, size_t begin, size_t end) const;
+            virtual void RecursiveColumns(float * buf, size_t begin, size_t end, uint8_t * dst, size_t dstStride) const;
+
+            void RecursiveRow(const uint8_t * src, float * dst) const;
+            void RecursiveBorder(float * buf, size_t begin, size_t end, uint8_t * dst, size_t dstStride) const;
+
+            BlurParam _param;
+            size_t _size, _radius, _threads;
+            Array32f _kernel, _buffer;
+            float _coefs[4], _border[9];
+        };
+
+        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float * radius);
+
+        void * GaussianBlurInit32f(size_t width, size_t height, size_t channels, const float * radius);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class GaussianBlurFilter : public Base::GaussianBlurFilter
+        {
+        public:
+            GaussianBlurFilter(const BlurParam & param);
+
+        protected:
+            virtual void VerticalSum(const uint8_t * src, size_t srcStride, size_t row, float * dst) const;
+            virtual void HorizontalSum(const float * src, uint8_t * dst) const;
+            virtual void RecursiveRows(const uint8_t * src, size_t srcStride, size_t begin, size_t end) const;
+            virtual void RecursiveColumns(float * buf, size_t begin, size_t end, uint8_t * dst, size_t dstStride) const;
+        };
+
+        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float * radius);
+
+        void * GaussianBlurInit32f(size_t width, size_t height, size_t channels, const float * radius);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+#endif//__SimdGaussianBlur_h__
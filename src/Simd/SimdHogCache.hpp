@@ -0,0 +1,310 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar, 
+*               2014-2019 Antonenka Mikhail.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHogCache_hpp__
+#define __SimdHogCache_hpp__
+
+#include "Simd/SimdLib.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <math.h>
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog_cache
+
+        \short HogCache structure caches HOG direction histograms of whole frame and serves features of arbitrary regions from them.
+
+        Direction histograms of all cells are calculated once per frame with ::SimdHogDirectionHistograms.
+        If a motion mask is given, only horizontal bands of cells touched by motion are recalculated.
+        Histograms and block normalized features of any region (in cells) are gathered from the cache without recalculation of gradients.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHogCache.hpp"
+
+        int main()
+        {
+            typedef Simd::HogCache<Simd::Allocator> HogCache;
+
+            HogCache::View image;
+            image.Load("../../data/image/face/lena.pgm");
+
+            HogCache cache;
+            cache.Init(image.Size());
+            cache.Update(image);
+
+            HogCache::Rect cells = cache.ToCells(HogCache::Rect(64, 64, 128, 160));
+            std::vector<float> features(cache.BlocksSize(cells));
+            cache.Blocks(cells, features.data());
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct HogCache
+    {
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+        typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
+
+        /*!
+            Creates a new empty HogCache structure.
+        */
+        HogCache()
+            : _quantization(0)
+            , _valid(false)
+        {
+        }
+
+        /*!
+            Prepares HogCache structure to work with frames of given size.
+
+            \param [in] frameSize - a size of input frames. Only the part of the frame which is a multiple of the cell size is used.
+            \param [in] cell - a size of cell. By default it is equal to 8x8.
+            \param [in] quantization - a direction quantization. It must be even. By default it is equal to 18.
+            \return a result of this operation.
+        */
+        bool Init(const Size & frameSize, const Size & cell = Size(8, 8), size_t quantization = 18)
+        {
+            _valid = false;
+            if (cell.x <= 0 || cell.y <= 0 || quantization == 0 || quantization % 2 != 0)
+                return false;
+            if (frameSize.x < cell.x * 2 || frameSize.y < cell.y * 2)
+                return false;
+            _frameSize = frameSize;
+            _cell = cell;
+            _cells = Size(frameSize.x / cell.x, frameSize.y / cell.y);
+            _quantization = quantization;
+            _histograms.resize(_cells.x * _cells.y * _quantization);
+            _band.resize(_histograms.size());
+            _sums.resize(frameSize.y);
+            _dirty.resize(_cells.y);
+            _gray.Recreate(frameSize, View::Gray8);
+            return true;
+        }
+
+        /*!
+            Updates cached histograms with new frame.
+
+            \param [in] frame - a new frame. It must have the size passed to HogCache::Init. Non gray images are converted to gray.
+            \param [in] mask - an optional 8-bit gray motion mask of the frame size. Nonzero pixels mark changed areas of the frame.
+                If it is given only bands of cells which are affected by changed pixels are recalculated.
+                The mask is ignored for the first frame after HogCache::Init.
+            \return a result of this operation.
+        */
+        bool Update(const View & frame, const View & mask = View())
+        {
+            if (_quantization == 0 || frame.Size() != _frameSize)
+                return false;
+            if (mask.format != View::None && (mask.format != View::Gray8 || mask.Size() != _frameSize))
+                return false;
+            View gray = frame;
+            if (frame.format != View::Gray8)
+            {
+                Simd::Convert(frame, _gray);
+                gray = _gray;
+            }
+            gray = gray.Region(Rect(0, 0, _cells.x * _cell.x, _cells.y * _cell.y));
+            if (!_valid || mask.format == View::None)
+            {
+                SimdHogDirectionHistograms(gray.data, gray.stride, gray.width, gray.height, _cell.x, _cell.y, _quantization, _histograms.data());
+                _valid = true;
+                return true;
+            }
+            MarkDirty(mask);
+            for (ptrdiff_t begin = 0; begin < _cells.y;)
+            {
+                if (!_dirty[begin])
+                {
+                    begin++;
+                    continue;
+                }
+                ptrdiff_t end = begin + 1;
+                while (end < _cells.y && _dirty[end])
+                    end++;
+                UpdateBand(gray, begin, end);
+                begin = end;
+            }
+            return true;
+        }
+
+        /*!
+            Gets size of cell grid.
+
+            \return a size of cell grid (number of cells in horizontal and vertical direction).
+        */
+        Size Cells() const
+        {
+            return _cells;
+        }
+
+        /*!
+            Converts a rectangle in pixels to the smallest covering rectangle in cells clipped by the cell grid.
+
+            \param [in] roi - a rectangle in pixels.
+            \return a rectangle in cells.
+        */
+        Rect ToCells(const Rect & roi) const
+        {
+            Rect cells(roi.left / _cell.x, roi.top / _cell.y, (roi.right + _cell.x - 1) / _cell.x, (roi.bottom + _cell.y - 1) / _cell.y);
+            return cells.Intersection(Rect(_cells));
+        }
+
+        /*!
+            Gets pointer to the cached histogram of given cell.
+
+            \param [in] x - a column of the cell.
+            \param [in] y - a row of the cell.
+            \return a pointer to direction histogram of the cell (it has Quantization() elements).
+        */
+        const float * Histogram(ptrdiff_t x, ptrdiff_t y) const
+        {
+            return _histograms.data() + (y * _cells.x + x) * _quantization;
+        }
+
+        /*!
+            Gets direction quantization.
+
+            \return a number of bins in every cell histogram.
+        */
+        size_t Quantization() const
+        {
+            return _quantization;
+        }
+
+        /*!
+            Gathers cached histograms of given region of cells.
+
+            \param [in] cells - a region in cells. It must be inside of the cell grid.
+            \param [out] dst - a pointer to output buffer. Its size must be equal to cells.Area()*Quantization().
+            \return a result of this operation.
+        */
+        bool Histograms(const Rect & cells, float * dst) const
+        {
+            if (!_valid || cells.Empty() || !Rect(_cells).Contains(cells))
+                return false;
+            size_t size = cells.Width() * _quantization * sizeof(float);
+            for (ptrdiff_t y = cells.top; y < cells.bottom; ++y, dst += cells.Width() * _quantization)
+                memcpy(dst, Histogram(cells.left, y), size);
+            return true;
+        }
+
+        /*!
+            Gets size of buffer for block normalized features of given region.
+
+            \param [in] cells - a region in cells.
+            \return a size of output buffer for function HogCache::Blocks.
+        */
+        size_t BlocksSize(const Rect & cells) const
+        {
+            return cells.Width() > 1 && cells.Height() > 1 ? (cells.Width() - 1) * (cells.Height() - 1) * 4 * _quantization : 0;
+        }
+
+        /*!
+            Gathers block normalized features of given region of cells.
+            Blocks have 2x2 cells size and 1 cell step. Every block is normalized with using of L2-Hys norm.
+
+            \param [in] cells - a region in cells. It must be inside of the cell grid and be at least 2x2 cells.
+            \param [out] dst - a pointer to output buffer. Its size must be equal to HogCache::BlocksSize.
+            \param [in] clip - a clipping threshold of L2-Hys normalization. By default it is equal to 0.2.
+            \return a result of this operation.
+        */
+        bool Blocks(const Rect & cells, float * dst, float clip = 0.2f) const
+        {
+            if (!_valid || cells.Width() < 2 || cells.Height() < 2 || !Rect(_cells).Contains(cells))
+                return false;
+            size_t q = _quantization, size = 4 * q;
+            for (ptrdiff_t y = cells.top; y < cells.bottom - 1; ++y)
+            {
+                for (ptrdiff_t x = cells.left; x < cells.right - 1; ++x, dst += size)
+                {
+                    memcpy(dst + 0 * q, Histogram(x + 0, y + 0), q * sizeof(float));
+                    memcpy(dst + 1 * q, Histogram(x + 1, y + 0), q * sizeof(float));
+                    memcpy(dst + 2 * q, Histogram(x + 0, y + 1), q * sizeof(float));
+                    memcpy(dst + 3 * q, Histogram(x + 1, y + 1), q * sizeof(float));
+                    Normalize(dst, size, clip);
+                }
+            }
+            return true;
+        }
+
+    private:
+        typedef std::vector<float, A<float>> Buffer;
+
+        Size _frameSize, _cell, _cells;
+        size_t _quantization;
+        bool _valid;
+        Buffer _histograms, _band;
+        std::vector<uint32_t> _sums;
+        std::vector<uint8_t> _dirty;
+        View _gray;
+
+        void MarkDirty(const View & mask)
+        {
+            SimdGetRowSums(mask.data, mask.stride, mask.width, mask.height, _sums.data());
+            std::fill(_dirty.begin(), _dirty.end(), 0);
+            for (ptrdiff_t y = 0; y < _frameSize.y; ++y)
+            {
+                if (_sums[y] == 0)
+                    continue;
+                ptrdiff_t begin = std::max<ptrdiff_t>((y - 1) / _cell.y - 1, 0);
+                ptrdiff_t end = std::min<ptrdiff_t>((y + 1) / _cell.y + 2, _cells.y);
+                for (ptrdiff_t cy = begin; cy < end; ++cy)
+                    _dirty[cy] = 1;
+            }
+        }
+
+        void UpdateBand(const View & gray, ptrdiff_t begin, ptrdiff_t end)
+        {
+            ptrdiff_t top = std::max<ptrdiff_t>(begin - 1, 0), bottom = std::min<ptrdiff_t>(end + 1, _cells.y);
+            View band = gray.Region(Rect(0, top * _cell.y, gray.width, bottom * _cell.y));
+            SimdHogDirectionHistograms(band.data, band.stride, band.width, band.height, _cell.x, _cell.y, _quantization, _band.data());
+            size_t stride = _cells.x * _quantization;
+            memcpy(_histograms.data() + begin * stride, _band.data() + (begin - top) * stride, (end - begin) * stride * sizeof(float));
+        }
+
+        static void Normalize(float * dst, size_t size, float clip)
+        {
+            float sum = 0;
+            for (size_t i = 0; i < size; ++i)
+                sum += dst[i] * dst[i];
+            float norm = 1.0f / ::sqrt(sum + 0.0001f);
+            sum = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                dst[i] = std::min(dst[i] * norm, clip);
+                sum += dst[i] * dst[i];
+            }
+            norm = 1.0f / ::sqrt(sum + 0.0001f);
+            for (size_t i = 0; i < size; ++i)
+                dst[i] *= norm;
+        }
+    };
+}
+
+#endif//__SimdHogCache_hpp__
@@ -0,0 +1,309 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar, 
+*               2014-2019 Antonenka Mikhail.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHogDetector_hpp__
+#define __SimdHogDetector_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <float.h>
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog_detector
+
+        \short HogDetector structure provides sliding window object detection with using of lite HOG features and linear SVM filter.
+
+        Features of the input image are extracted once per frame with ::SimdHogLiteExtractFeatures. 
+        A pyramid of features is built from them with ::SimdHogLiteResizeFeatures and every window of every level is scored by ::SimdHogLiteFilterFeatures.
+        Levels of the pyramid are processed in parallel. All internal buffers are allocated in HogDetector::Init and reused for following frames.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHogDetector.hpp"
+        #include "Simd/SimdDrawing.hpp"
+
+        int main()
+        {
+            typedef Simd::HogDetector<Simd::Allocator> HogDetector;
+
+            HogDetector::View image;
+            image.Load("../../data/image/face/lena.pgm");
+
+            std::vector<float> weights(8 * 8 * 16);
+            float bias = 0;
+            // Load trained SVM weights and bias here.
+
+            HogDetector detector;
+            detector.SetFilter(weights.data(), 8, 8, bias);
+            detector.Init(image.Size());
+
+            HogDetector::Objects objects;
+            detector.Detect(image, objects);
+
+            for (size_t i = 0; i < objects.size(); ++i)
+                Simd::DrawRectangle(image, objects[i].rect, uint8_t(255));
+            image.Save("result.pgm");
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct HogDetector
+    {
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+        typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
+
+        static const size_t FEATURE_SIZE = 16; /*!< A number of lite HOG features per cell. */
+
+        /*!
+            \short The Object structure describes detected object.
+        */
+        struct Object
+        {
+            Rect rect; /*!< \brief A bounding box around of detected object. */
+            float score; /*!< \brief A maximal SVM score of grouped detections. */
+            int weight; /*!< \brief An object weight (number of grouped elementary detections). */
+
+            /*!
+                Creates a new Object structure.
+
+                \param [in] r - initial bounding box.
+                \param [in] s - initial score.
+                \param [in] w - initial weight.
+            */
+            Object(const Rect & r = Rect(), float s = 0, int w = 1)
+                : rect(r), score(s), weight(w)
+            {
+            }
+        };
+        typedef std::vector<Object> Objects; /*!< A vector of objects type definition. */
+
+        /*!
+            Creates a new empty HogDetector structure.
+        */
+        HogDetector()
+            : _filterWidth(0)
+            , _filterHeight(0)
+            , _bias(0)
+            , _cell(0)
+            , _threadNumber(1)
+        {
+        }
+
+        /*!
+            Sets linear SVM filter which is applied to every window of the pyramid.
+
+            \param [in] weights - a pointer to filter weights. Its size must be equal to width*height*16. 
+                Weights are stored in row-major order of cells, 16 lite HOG features per cell.
+            \param [in] width - a width of the filter (window) in cells.
+            \param [in] height - a height of the filter (window) in cells.
+            \param [in] bias - a bias of the SVM. It is added to every window score.
+            \return a result of this operation.
+        */
+        bool SetFilter(const float * weights, size_t width, size_t height, float bias = 0)
+        {
+            if (weights == NULL || width == 0 || height == 0)
+                return false;
+            _filter.assign(weights, weights + width * height * FEATURE_SIZE);
+            _filterWidth = width;
+            _filterHeight = height;
+            _bias = bias;
+            _levels.clear();
+            return true;
+        }
+
+        /*!
+            Prepares HogDetector structure to work with image of given size.
+
+            \note The filter must be set (see HogDetector::SetFilter) before calling of this method.
+
+            \param [in] imageSize - a size of input image.
+            \param [in] cell - a size of HOG cell in pixels. It must be 4 or 8. By default it is equal to 8.
+            \param [in] scaleFactor - a scale factor between neighbour levels of the pyramid. By default it is equal to 1.2.
+            \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number. By default it is equal to -1.
+            \return a result of this operation.
+        */
+        bool Init(const Size & imageSize, size_t cell = 8, double scaleFactor = 1.2, ptrdiff_t threadNumber = -1)
+        {
+            _levels.clear();
+            if (_filter.empty() || (cell != 4 && cell != 8) || scaleFactor <= 1.0)
+                return false;
+            if (imageSize.x < ptrdiff_t(cell * 3) || imageSize.y < ptrdiff_t(cell * 3))
+                return false;
+            _imageSize = imageSize;
+            _cell = cell;
+            ptrdiff_t threadNumberMax = std::max<ptrdiff_t>(std::thread::hardware_concurrency(), 1);
+            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            _gray.Recreate(imageSize, View::Gray8);
+
+            size_t width = imageSize.x / cell - 2, height = imageSize.y / cell - 2;
+            for (double scale = 1.0;; scale *= scaleFactor)
+            {
+                size_t w = size_t(width / scale + 0.5), h = size_t(height / scale + 0.5);
+                if (w < _filterWidth || h < _filterHeight)
+                    break;
+                if (_levels.size() && w == _levels.back().width && h == _levels.back().height)
+                    continue;
+                Level level;
+                level.width = w;
+                level.height = h;
+                level.scaleX = double(width) / w;
+                level.scaleY = double(height) / h;
+                level.features.resize(w * h * FEATURE_SIZE);
+                level.response.resize((w - _filterWidth + 1) * (h - _filterHeight + 1));
+                _levels.push_back(level);
+            }
+            return !_levels.empty();
+        }
+
+        /*!
+            Detects objects at given image.
+
+            \param [in] src - an input image. It must have the size passed to HogDetector::Init. Non gray images are converted to gray.
+            \param [out] objects - detected objects sorted by descending score.
+            \param [in] threshold - a minimal SVM score (including bias) of window to be detected. By default it is equal to 0.
+            \param [in] overlapMax - a maximal ratio of intersection to union of two detections which are not grouped together. By default it is equal to 0.3.
+            \return a result of this operation.
+        */
+        bool Detect(const View & src, Objects & objects, float threshold = 0, double overlapMax = 0.3)
+        {
+            objects.clear();
+            if (_levels.empty() || src.Size() != _imageSize)
+                return false;
+
+            const View * gray = &src;
+            if (src.format != View::Gray8)
+            {
+                Simd::Convert(src, _gray);
+                gray = &_gray;
+            }
+            Level & base = _levels[0];
+            SimdHogLiteExtractFeatures(gray->data, gray->stride, gray->width, gray->height, _cell, base.features.data(), base.width * FEATURE_SIZE);
+
+            size_t levelNumber = _levels.size(), threadNumber = std::min<size_t>(_threadNumber, levelNumber);
+            Simd::Parallel(0, threadNumber, [&](size_t, size_t begin, size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                    for (size_t i = t; i < levelNumber; i += threadNumber)
+                        DetectLevel(_levels[i], threshold);
+            }, threadNumber);
+
+            _candidates.clear();
+            for (size_t i = 0; i < levelNumber; ++i)
+                _candidates.insert(_candidates.end(), _levels[i].candidates.begin(), _levels[i].candidates.end());
+            GroupObjects(_candidates, overlapMax, objects);
+            return true;
+        }
+
+    private:
+        typedef std::vector<float, A<float>> Buffer;
+
+        struct Level
+        {
+            size_t width, height;
+            double scaleX, scaleY;
+            Buffer features, response;
+            Objects candidates;
+        };
+        typedef std::vector<Level> Levels;
+
+        Buffer _filter;
+        size_t _filterWidth, _filterHeight;
+        float _bias;
+        size_t _cell;
+        Size _imageSize;
+        ptrdiff_t _threadNumber;
+        View _gray;
+        Levels _levels;
+        Objects _candidates;
+
+        void DetectLevel(Level & level, float threshold)
+        {
+            const Level & base = _levels[0];
+            if (&level != &base)
+                SimdHogLiteResizeFeatures(base.features.data(), base.width * FEATURE_SIZE, base.width, base.height, FEATURE_SIZE,
+                    level.features.data(), level.width * FEATURE_SIZE, level.width, level.height);
+
+            size_t width = level.width - _filterWidth + 1, height = level.height - _filterHeight + 1;
+            SimdHogLiteFilterFeatures(level.features.data(), level.width * FEATURE_SIZE, level.width, level.height, FEATURE_SIZE,
+                _filter.data(), _filterWidth, _filterHeight, NULL, 0, level.response.data(), width);
+
+            level.candidates.clear();
+            ptrdiff_t w = ptrdiff_t(_filterWidth * _cell * level.scaleX + 0.5), h = ptrdiff_t(_filterHeight * _cell * level.scaleY + 0.5);
+            for (size_t y = 0; y < height; ++y)
+            {
+                const float * response = level.response.data() + y * width;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    float score = response[x] + _bias;
+                    if (score > threshold)
+                    {
+                        ptrdiff_t left = ptrdiff_t((x * level.scaleX + 1.0) * _cell + 0.5);
+                        ptrdiff_t top = ptrdiff_t((y * level.scaleY + 1.0) * _cell + 0.5);
+                        level.candidates.push_back(Object(Rect(left, top, left + w, top + h), score));
+                    }
+                }
+            }
+        }
+
+        static bool Overlapped(const Rect & a, const Rect & b, double overlapMax)
+        {
+            double intersection = double(a.Intersection(b).Area());
+            return intersection > overlapMax * (double(a.Area()) + double(b.Area()) - intersection);
+        }
+
+        static bool Greater(const Object & a, const Object & b)
+        {
+            return a.score > b.score;
+        }
+
+        static void GroupObjects(Objects & candidates, double overlapMax, Objects & objects)
+        {
+            std::sort(candidates.begin(), candidates.end(), Greater);
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                bool grouped = false;
+                for (size_t j = 0; j < objects.size() && !grouped; ++j)
+                {
+                    if (Overlapped(candidates[i].rect, objects[j].rect, overlapMax))
+                    {
+                        objects[j].weight++;
+                        grouped = true;
+                    }
+                }
+                if (!grouped)
+                    objects.push_back(candidates[i]);
+            }
+        }
+    };
+}
+
+#endif//__SimdHogDetector_hpp__
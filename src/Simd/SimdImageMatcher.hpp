@@ -151,7 +151,8 @@ namespace Simd
 
             \param [in] threshold - a maximal mean squared difference for similar images. By default it is equal to 0.05.
             \param [in] type - a type of Hash used for matching. By default it is equal to ImageMatcher::Hash16x16.
-            \param [in] number - an estimated total number of images used for matching. By default it is equal to 0.
+            \param [in] number - an estimated total number of images used for matching. By default it is equal to 0. 
+                For 100000 and more images an index with contiguous hash storage and exact pruning is used.
             \param [in] normalized - a flag signalized that images have normalized histogram. By default it is false.
             \return the result of the operation.
         */
@@ -160,7 +161,9 @@ namespace Simd
             static const size_t sizes[] = { 16, 32, 64 };
             size_t size = sizes[type];
 
-            if (number >= 10000 && threshold < 0.10)
+            if (number >= 100000)
+                _matcher.reset(new Matcher_Index(threshold, size));
+            else if (number >= 10000 && threshold < 0.10)
                 _matcher.reset(new Matcher_3D(threshold, size, number, normalized));
             else if (number > 1000 && !normalized)
                 _matcher.reset(new Matcher_1D(threshold, size, number));
@@ -308,6 +311,11 @@ namespace Simd
                 if (fastSum > _fastMax)
                     return false;
 
+                return CompareMain(a.get(), b.get(), difference);
+            }
+
+            bool CompareMain(const Hash * a, const Hash * b, double & difference)
+            {
                 uint64_t mainSum = 0;
                 ::SimdSquaredDifferenceSum(a->main, _mainSize, b->main, _mainSize, _mainSize, 1, &mainSum);
                 if (mainSum > _mainMax)
@@ -456,6 +464,151 @@ namespace Simd
                 index.z = std::max(0, std::min(_range.z - 1, index.z - _shift.z));
             }
         };
+
+        struct Matcher_Index : public Matcher
+        {
+            Matcher_Index(double threshold, size_t size)
+                : Matcher(threshold, size)
+            {
+                // Projections are dot products of fast hash with orthogonal +-1 vectors, 
+                // so a distance between projections is not greater than a distance between fast hashes multiplied by sqrt(fastSize).
+                _radius = ::sqrt(double(this->_fastMax));
+                _reach = _radius*::sqrt(double(this->_fastSize));
+                _cell = std::max(int(::ceil(_reach / 2.0)), (RANGE + CELLS_MAX - 1) / CELLS_MAX);
+                _cells = RANGE / _cell + 1;
+                _grid.resize(_cells*_cells*_cells, -1);
+            }
+
+            virtual void Add(const HashPtr & hash)
+            {
+                Index p;
+                Get(hash, p);
+                int & cell = _grid[((p.z / _cell)*_cells + p.y / _cell)*_cells + p.x / _cell];
+                if (cell < 0)
+                {
+                    cell = (int)_blocks.size();
+                    _blocks.push_back(Block());
+                }
+                Block & block = _blocks[cell];
+                if (!block.index.empty())
+                    block.radius = std::max(block.radius, Distance(block.fast.data(), hash->fast));
+                block.index.push_back((uint32_t)_hashes.size());
+                block.fast.insert(block.fast.end(), hash->fast, hash->fast + this->_fastSize);
+                _hashes.push_back(hash);
+                this->_size++;
+            }
+
+            virtual void Find(const HashPtr & hash, Results & results)
+            {
+                if (hash->skip)
+                    return;
+
+                Index p, lo, hi;
+                Get(hash, p);
+                Bound(p.x, lo.x, hi.x);
+                Bound(p.y, lo.y, hi.y);
+                Bound(p.z, lo.z, hi.z);
+
+                const double reach2 = _reach*_reach;
+                std::vector<uint32_t> sums;
+                for (int z = lo.z; z <= hi.z; ++z)
+                {
+                    double dz = Gap(p.z, z);
+                    for (int y = lo.y; y <= hi.y; ++y)
+                    {
+                        double dy = Gap(p.y, y);
+                        for (int x = lo.x; x <= hi.x; ++x)
+                        {
+                            double dx = Gap(p.x, x);
+                            if (dx*dx + dy*dy + dz*dz > reach2)
+                                continue;
+                            int cell = _grid[(z*_cells + y)*_cells + x];
+                            if (cell >= 0)
+                                FindIn(_blocks[cell], hash.get(), sums, results);
+                        }
+                    }
+                }
+            }
+
+        private:
+            static const int RANGE = 4080, CELLS_MAX = 64;
+
+            struct Index
+            {
+                int x;
+                int y;
+                int z;
+            };
+
+            struct Block
+            {
+                double radius;
+                std::vector<uint32_t> index;
+                std::vector<uint8_t, Allocator<uint8_t> > fast;
+                Block() : radius(0) {}
+            };
+            typedef std::vector<Block> Blocks;
+
+            double _radius, _reach;
+            int _cell, _cells;
+            std::vector<int> _grid;
+            Blocks _blocks;
+            std::vector<HashPtr> _hashes;
+
+            void Get(const HashPtr & hash, Index & index) const
+            {
+                const uint8_t * p = hash->fast;
+                int s[2][2];
+                s[0][0] = p[0x0] + p[0x1] + p[0x4] + p[0x5];
+                s[0][1] = p[0x2] + p[0x3] + p[0x6] + p[0x7];
+                s[1][0] = p[0x8] + p[0x9] + p[0xC] + p[0xD];
+                s[1][1] = p[0xA] + p[0xB] + p[0xE] + p[0xF];
+
+                index.x = s[0][0] - s[0][1] + s[1][0] - s[1][1] + RANGE / 2;
+                index.y = s[0][0] + s[0][1] - s[1][0] - s[1][1] + RANGE / 2;
+                index.z = s[0][0] + s[0][1] + s[1][0] + s[1][1];
+            }
+
+            void Bound(int p, int & lo, int & hi) const
+            {
+                lo = std::max(0, int(::floor(p - _reach))) / _cell;
+                hi = std::min(RANGE, int(::ceil(p + _reach))) / _cell;
+            }
+
+            double Gap(int p, int c) const
+            {
+                int lo = c*_cell, hi = lo + _cell - 1;
+                return p < lo ? lo - p : (p > hi ? p - hi : 0);
+            }
+
+            double Distance(const uint8_t * a, const uint8_t * b) const
+            {
+                uint64_t sum = 0;
+                ::SimdSquaredDifferenceSum(a, this->_fastSize, b, this->_fastSize, this->_fastSize, 1, &sum);
+                return ::sqrt(double(sum));
+            }
+
+            // The first hash of the block is a pivot: the whole block is skipped by triangle inequality
+            // or all its fast hashes are compared with the query in one batch.
+            // The distances buffer belongs to the caller, so concurrent Find calls do not share any state.
+            void FindIn(const Block & block, const Hash * hash, std::vector<uint32_t> & sums, Results & results)
+            {
+                if (Distance(block.fast.data(), hash->fast) > block.radius + _radius + 0.01)
+                    return;
+                const size_t fastSize = this->_fastSize, size = block.index.size();
+                sums.resize(size);
+                ::SimdSquaredDifferenceSumsMxN8u(1, size, fastSize, hash->fast, fastSize, block.fast.data(), fastSize, (uint32_t)this->_fastMax, sums.data());
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (sums[i] > this->_fastMax)
+                        continue;
+                    const Hash * candidate = _hashes[block.index[i]].get();
+                    double difference = 0;
+                    if (!candidate->skip && this->CompareMain(candidate, hash, difference))
+                        results.push_back(Result(candidate, difference));
+                }
+            }
+        };
     };
 }
 
@@ -63,11 +63,15 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdPerformance.h"
 
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdCropAndResize.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
+#include "Simd/SimdSynetPreprocess.h"
 #include "Simd/SimdSynetScale8i.h"
 
 #include "Simd/SimdBase.h"
@@ -240,6 +244,31 @@ SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
         return Base::Crc32c(src, size);
 }
 
+SIMD_API uint32_t SimdCrc32cUpdate(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height)
+{
+#ifdef SIMD_SSE42_ENABLE
+    if (Sse42::Enable)
+        return Sse42::Crc32cUpdate(crc, src, stride, width, height);
+    else
+#endif
+        return Base::Crc32cUpdate(crc, src, stride, width, height);
+}
+
+SIMD_API uint32_t SimdCrc32cCombine(uint32_t crc1, uint32_t crc2, size_t size2)
+{
+    return Base::Crc32cCombine(crc1, crc2, size2);
+}
+
+SIMD_API void SimdCrc32cBatch(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc)
+{
+#ifdef SIMD_SSE42_ENABLE
+    if (Sse42::Enable)
+        Sse42::Crc32cBatch(src, size, count, crc);
+    else
+#endif
+        Base::Crc32cBatch(src, size, count, crc);
+}
+
 SIMD_API void SimdAbsDifference(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride,
     size_t width, size_t height)
 {
@@ -862,6 +891,38 @@ SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height
         Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+    size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+        Avx512bw::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 2)
+        Avx2::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgr, bgrStride);
+    else
+#endif
+        Base::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgr, bgrStride);
+}
+
+SIMD_API void SimdBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+    size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+        Avx512bw::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 2)
+        Avx2::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bitDepth, demosaic, gains, bgra, bgraStride, alpha);
+}
+
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1007,6 +1068,41 @@ SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1042,6 +1138,41 @@ SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1072,6 +1203,36 @@ SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A && yuvType == SimdYuvBt601)
+        Vmx::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A && yuvType == SimdYuvBt601)
+        Neon::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
     uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
 {
@@ -1289,6 +1450,36 @@ SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1319,6 +1510,36 @@ SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1349,6 +1570,36 @@ SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A && yuvType == SimdYuvBt601)
+        Vmx::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A && yuvType == SimdYuvBt601)
+        Neon::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
@@ -1625,13 +1876,23 @@ SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t
 
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
 {
-    Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
+    else
+#endif
+        Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
 }
 
 SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
                            size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride)
 {
-    Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
+    else
+#endif
+        Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
 }
 
 SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
@@ -1727,6 +1988,16 @@ SIMD_API void * SimdDetectionLoadA(const char * path)
     return Base::DetectionLoadA(path);
 }
 
+SIMD_API void * SimdDetectionLoadBinary(const uint8_t * data, size_t size)
+{
+    return Base::DetectionLoadBinary(data, size);
+}
+
+SIMD_API SimdBool SimdDetectionSaveA(const void * data, const char * path)
+{
+    return Base::DetectionSaveA(data, path);
+}
+
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
     Base::DetectionInfo(data, width, height, flags);
@@ -1743,6 +2014,16 @@ SIMD_API void SimdDetectionPrepare(void * hid)
     Base::DetectionPrepare(hid);
 }
 
+SIMD_API void SimdDetectionPrepareRegion(void * hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom)
+{
+    Base::DetectionPrepareRegion(hid, left, top, right, bottom);
+}
+
+SIMD_API void SimdDetectionSetAdaptiveStep(void * hid, float level)
+{
+    Base::DetectionSetAdaptiveStep(hid, level);
+}
+
 SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, 
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
@@ -2099,7 +2380,12 @@ SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t v
 
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
 {
-    Base::Fill(dst, stride, width, height, pixelSize, value);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Fill(dst, stride, width, height, pixelSize, value);
+    else
+#endif
+        Base::Fill(dst, stride, width, height, pixelSize, value);
 }
 
 SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
@@ -2301,6 +2587,46 @@ SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uin
         Base::CosineDistancesMxNa16f(M, N, K, A, B, distances);
 }
 
+SIMD_API void SimdSquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && K >= Avx512bw::F)
+        Avx512bw::SquareSums16f(N, K, A, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && K >= Avx2::F)
+        Avx2::SquareSums16f(N, K, A, sums);
+    else
+#endif
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && K >= Neon::F)
+        Neon::SquareSums16f(N, K, A, sums);
+    else
+#endif
+        Base::SquareSums16f(N, K, A, sums);
+}
+
+SIMD_API void SimdCosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && K >= Avx512bw::F)
+        Avx512bw::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && K >= Avx2::F)
+        Avx2::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances);
+    else
+#endif
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && K >= Neon::F)
+        Neon::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances);
+    else
+#endif
+        Base::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances);
+}
+
 SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -2397,12 +2723,23 @@ SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t
 
 SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float* radius)
 {
-    return NULL;
+    typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* radius);
+    const static SimdGaussianBlurInitPtr simdGaussianBlurInit = SIMD_FUNC1(GaussianBlurInit, SIMD_AVX2_FUNC);
+
+    return simdGaussianBlurInit(width, height, channels, radius);
+}
+
+SIMD_API void* SimdGaussianBlurInit32f(size_t width, size_t height, size_t channels, const float* radius)
+{
+    typedef void* (*SimdGaussianBlurInit32fPtr) (size_t width, size_t height, size_t channels, const float* radius);
+    const static SimdGaussianBlurInit32fPtr simdGaussianBlurInit32f = SIMD_FUNC1(GaussianBlurInit32f, SIMD_AVX2_FUNC);
+
+    return simdGaussianBlurInit32f(width, height, channels, radius);
 }
 
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
 {
-    //((GaussianBlur*)filter)->Run(src, srcStride, dst, dstStride);
+    ((Base::GaussianBlurFilter*)filter)->Run(src, srcStride, dst, dstStride);
 }
 
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
@@ -2899,25 +3236,45 @@ SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height,
         Base::Int16ToGray(src, width, height, srcStride, dst, dstStride);
 }
 
-SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                      uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
-                      SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+SIMD_API void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride, size_t bitDepth, SimdDepthReductionType reduction)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+        Avx512bw::Uint16ToGray(src, width, height, srcStride, dst, dstStride, bitDepth, reduction);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Uint16ToGray(src, width, height, srcStride, dst, dstStride, bitDepth, reduction);
     else
 #endif
-        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::Uint16ToGray(src, width, height, srcStride, dst, dstStride, bitDepth, reduction);
+    else
+#endif
+        Base::Uint16ToGray(src, width, height, srcStride, dst, dstStride, bitDepth, reduction);
 }
 
-SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
-{
+SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                      uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+                      SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+}
+
+SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
+{
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
@@ -3913,6 +4270,174 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+}
+
+SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Nv21ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv21ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Nv21ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Nv21ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+}
+
+SIMD_API void SimdP010ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, SimdDepthReductionType reduction)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToYuv420p(y, yStride, uv, uvStride, width, height, dy, dyStride, du, duStride, dv, dvStride, reduction);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P010ToYuv420p(y, yStride, uv, uvStride, width, height, dy, dyStride, du, duStride, dv, dvStride, reduction);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::P010ToYuv420p(y, yStride, uv, uvStride, width, height, dy, dyStride, du, duStride, dv, dvStride, reduction);
+    else
+#endif
+        Base::P010ToYuv420p(y, yStride, uv, uvStride, width, height, dy, dyStride, du, duStride, dv, dvStride, reduction);
+}
+
+SIMD_API void SimdP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+    uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType, reduction);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType, reduction);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType, reduction);
+    else
+#endif
+        Base::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType, reduction);
+}
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
@@ -4363,7 +4888,37 @@ SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t ds
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
-    ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+    ((const Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void * SimdResizerInitShared(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+    return Base::ResizerInitShared(srcX, srcY, dstX, dstY, channels, type, method, SimdResizerInit);
+}
+
+SIMD_API size_t SimdResizerBufferSize(const void * resizer)
+{
+    return ((const Resizer*)resizer)->BufferSize();
+}
+
+SIMD_API void SimdResizerRunBuffered(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer)
+{
+    ((const Resizer*)resizer)->Run(src, srcStride, dst, dstStride, buffer);
+}
+
+SIMD_API void * SimdCropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+    SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType)
+{
+    typedef void* (*SimdCropAndResizeInitPtr) (size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+        SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType);
+    const static SimdCropAndResizeInitPtr simdCropAndResizeInit = SIMD_FUNC1(CropAndResizeInit, SIMD_AVX2_FUNC);
+
+    return simdCropAndResizeInit(srcWidth, srcHeight, channels, srcType, dstWidth, dstHeight, method, lower, upper, tensorFormat, tensorType);
+}
+
+SIMD_API void SimdCropAndResizeRun(const void * context, const uint8_t * src, size_t srcStride, const float * rois, size_t roiCount, uint8_t * dst)
+{
+    ((const Base::CropAndResize*)context)->Run(src, srcStride, rois, roiCount, dst);
 }
 
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
@@ -4936,6 +5491,32 @@ SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, c
         Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
+SIMD_API void SimdSquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+    const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums)
+{
+#ifdef SIMD_AVX512VNNI_ENABLE
+    if (Avx512vnni::Enable)
+        Avx512vnni::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums);
+    else
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && K >= Avx2::HA)
+        Avx2::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && K >= Neon::A)
+        Neon::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums);
+    else
+#endif
+        Base::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums);
+}
+
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
@@ -5337,6 +5918,19 @@ SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float *
         Base::SvmSumLinear(x, svs, weights, length, count, sum);
 }
 
+SIMD_API void * SimdSvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree)
+{
+    typedef void* (*SimdSvmKernelInitPtr) (const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+    const static SimdSvmKernelInitPtr simdSvmKernelInit = SIMD_FUNC3(SvmKernelInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_NEON_FUNC);
+
+    return simdSvmKernelInit(svs, weights, length, count, type, gamma, coef0, degree);
+}
+
+SIMD_API void SimdSvmKernelSum(const void * context, const float * x, size_t batch, float * sum)
+{
+    ((Base::SvmKernel*)context)->Sum(x, batch, sum);
+}
+
 SIMD_API void SimdSynetAddBias(const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     typedef void(*SimdSynetAddBiasPtr) (const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
@@ -5760,6 +6354,21 @@ SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height
         Base::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
 }
 
+SIMD_API void * SimdSynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+    SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding)
+{
+    typedef void* (*SimdSynetPreprocessInitPtr) (size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+        SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding);
+    const static SimdSynetPreprocessInitPtr simdSynetPreprocessInit = SIMD_FUNC1(SynetPreprocessInit, SIMD_AVX2_FUNC);
+
+    return simdSynetPreprocessInit(srcWidth, srcHeight, srcFormat, yuvType, dstWidth, dstHeight, dstFormat, lower, upper, tensorFormat, tensorType, letterbox, padding);
+}
+
+SIMD_API void SimdSynetPreprocessRun(const void * context, const uint8_t * const * src, const size_t * srcStride, const ptrdiff_t * rois, size_t roiCount, uint8_t * dst)
+{
+    ((Base::SynetPreprocess*)context)->Run(src, srcStride, rois, roiCount, dst);
+}
+
 SIMD_API void SimdSynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type)
 {
     typedef void(*SimdSynetShuffleLayerForwardPtr) (const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type);
@@ -6178,6 +6787,37 @@ SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
@@ -6209,6 +6849,37 @@ SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
@@ -6240,6 +6911,37 @@ SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A && yuvType == SimdYuvBt601)
+        Vmx::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A && yuvType == SimdYuvBt601)
+        Neon::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
@@ -6271,6 +6973,79 @@ SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, size_t bitDepth, SimdDepthReductionType reduction)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType, bitDepth, reduction);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType, bitDepth, reduction);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType, bitDepth, reduction);
+    else
+#endif
+        Base::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType, bitDepth, reduction);
+}
+
+SIMD_API void SimdYuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+    uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, size_t bitDepth, SimdDepthReductionType reduction)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToYuv420p(y, yStride, u, uStride, v, vStride, width, height, dy, dyStride, du, duStride, dv, dvStride, bitDepth, reduction);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420p16ToYuv420p(y, yStride, u, uStride, v, vStride, width, height, dy, dyStride, du, duStride, dv, dvStride, bitDepth, reduction);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420p16ToYuv420p(y, yStride, u, uStride, v, vStride, width, height, dy, dyStride, du, duStride, dv, dvStride, bitDepth, reduction);
+    else
+#endif
+        Base::Yuv420p16ToYuv420p(y, yStride, u, uStride, v, vStride, width, height, dy, dyStride, du, duStride, dv, dvStride, bitDepth, reduction);
+}
+
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
@@ -6302,6 +7077,37 @@ SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA && yuvType == SimdYuvBt601)
+        Vmx::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
@@ -6333,6 +7139,37 @@ SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A && yuvType == SimdYuvBt601)
+        Vmx::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A && yuvType == SimdYuvBt601)
+        Neon::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
@@ -6433,6 +7270,32 @@ SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
 SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
@@ -6459,6 +7322,32 @@ SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA && yuvType == SimdYuvBt601)
+        Neon::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
 SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
@@ -6485,5 +7374,31 @@ SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A && yuvType == SimdYuvBt601)
+        Neon::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
 
 
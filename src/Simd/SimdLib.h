@@ -321,6 +321,16 @@ typedef enum
     SimdResizeMethodInferenceEngineInterp,
 } SimdResizeMethodType;
 
+/*! @ingroup svm
+    Describes kernel type of SVM (Support Vector Machine). It is used in function ::SimdSvmKernelInit.
+*/
+typedef enum
+{
+    SimdSvmKernelLinear, /*!< Linear kernel: K(x, y) = x*y. */
+    SimdSvmKernelPolynomial, /*!< Polynomial kernel: K(x, y) = (gamma*x*y + coef0)^degree. */
+    SimdSvmKernelRbf, /*!< RBF (Gaussian) kernel: K(x, y) = exp(-gamma*|x - y|^2). */
+} SimdSvmKernelType;
+
 /*! @ingroup synet
     Describes Synet compatibility flags. This type used in functions ::SimdSynetScaleLayerForward, ::SimdSynetConvert32fTo8u, 
     ::SimdSynetConvolution8iInit, and ::SimdSynetMergedConvolution8iInit.
@@ -404,6 +414,19 @@ typedef enum
     SimdTensorData8u, /*!< 8-bit unsigned integer. */
 } SimdTensorDataType;
 
+/*! @ingroup synet_conversion
+    Describes format of source image used in fused preprocessing functions (see ::SimdSynetPreprocessInit).
+*/
+typedef enum
+{
+    SimdSynetSourceGray8, /*!< One channel 8-bit gray image. */
+    SimdSynetSourceBgr24, /*!< Three channel 24-bit BGR image. */
+    SimdSynetSourceBgra32, /*!< Four channel 32-bit BGRA image. */
+    SimdSynetSourceRgb24, /*!< Three channel 24-bit RGB image. */
+    SimdSynetSourceNv12, /*!< NV12 image: 8-bit Y plane and interleaved 16-bit UV plane with half resolution. */
+    SimdSynetSourceYuv420p, /*!< YUV420P image: 8-bit Y, U and V planes. U and V planes have half resolution. */
+} SimdSynetSourceFormatType;
+
 /*! @ingroup transform
     Describes transform type used in function ::SimdTransformImage in order to describe result of transformation.
 */
@@ -419,6 +442,41 @@ typedef enum
     SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
 } SimdTransformType;
 
+/*! @ingroup yuv_conversion
+    Describes YUV color matrix and range used in YUV to BGR and BGR to YUV conversion functions with suffix V2.
+
+    \note Conversion functions require a valid YUV type. Passing ::SimdYuvUnknown or a value outside of this enumeration
+        is a precondition violation: it triggers an assertion in debug builds, while in release builds the output image is left unchanged.
+*/
+typedef enum
+{
+    SimdYuvUnknown = -1, /*!< Unknown YUV type. */
+    SimdYuvBt601, /*!< BT.601 color matrix, limited range (Y in [16..235], U and V in [16..240]). It is used by functions without yuvType parameter. */
+    SimdYuvBt709, /*!< BT.709 color matrix (HDTV), limited range. */
+    SimdYuvBt2020, /*!< BT.2020 color matrix (UHDTV), limited range. */
+    SimdYuvBt601Full, /*!< BT.601 color matrix, full range (Y, U and V in [0..255]). It is equal to JPEG (T.871) YCbCr. */
+    SimdYuvBt709Full, /*!< BT.709 color matrix, full range. */
+    SimdYuvBt2020Full, /*!< BT.2020 color matrix, full range. */
+} SimdYuvType;
+
+/*! @ingroup other_conversion
+    Describes method of bit depth reduction used in conversion of 10-bit and 16-bit images to 8-bit images (see ::SimdUint16ToGray, ::SimdP010ToBgra etc).
+*/
+typedef enum
+{
+    SimdDepthReductionRound, /*!< Rounding to nearest value: dst = Min(255, (src + (1 << (shift - 1))) >> shift), where shift = bitDepth - 8. */
+    SimdDepthReductionDither, /*!< Ordered dithering with 4x4 Bayer matrix. It suppresses banding on smooth gradients. */
+} SimdDepthReductionType;
+
+/*! @ingroup bayer_conversion
+    Describes demosaicing method used in functions ::SimdBayerToBgrV2 and ::SimdBayerToBgraV2.
+*/
+typedef enum
+{
+    SimdBayerDemosaicBilinear, /*!< Bilinear interpolation with edge-directed green channel. It is used in functions ::SimdBayerToBgr and ::SimdBayerToBgra. */
+    SimdBayerDemosaicMhc, /*!< Gradient-corrected bilinear interpolation with 5x5 kernels (Malvar-He-Cutler). It has no zipper artefacts on edges. */
+} SimdBayerDemosaicType;
+
 /*! @ingroup synet
     \brief Callback function type "SimdGemm32fNNPtr";
 
@@ -735,6 +793,68 @@ extern "C"
     */
     SIMD_API uint32_t SimdCrc32c(const void * src, size_t size);
 
+    /*! @ingroup hash
+
+        \fn uint32_t SimdCrc32cUpdate(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height);
+
+        \short Updates 32-bit cyclic redundancy check (CRC32c) with data of 2D region (image rows).
+
+        The function allows to calculate CRC32c of data which are split into several parts:
+        \verbatim
+        crc = 0; // initial value
+        crc = SimdCrc32cUpdate(crc, part0, size0, size0, 1);
+        crc = SimdCrc32cUpdate(crc, part1, size1, size1, 1);
+        ...
+        // crc is equal to SimdCrc32c of concatenated parts (there is no need of finalization).
+        \endverbatim
+        The rows of the region are hashed as they were packed one after another (a padding at the end of rows is ignored).
+
+        \note This function has a C++ wrapper Simd::Crc32c(const View<A> & src, uint32_t crc).
+        \note This function supports multithreading for large regions (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] crc - a CRC32c of previous data. It must be equal to 0 at the beginning.
+        \param [in] src - a pointer to the region data.
+        \param [in] stride - a row size of the region.
+        \param [in] width - a width of the region in bytes.
+        \param [in] height - a height of the region.
+        \return updated 32-bit cyclic redundancy check (CRC32c).
+    */
+    SIMD_API uint32_t SimdCrc32cUpdate(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height);
+
+    /*! @ingroup hash
+
+        \fn uint32_t SimdCrc32cCombine(uint32_t crc1, uint32_t crc2, size_t size2);
+
+        \short Combines 32-bit cyclic redundancy checks (CRC32c) of two sequential data blocks.
+
+        It allows to calculate CRC32c of independently (for example in parallel) hashed chunks of data:
+        \verbatim
+        SimdCrc32cCombine(SimdCrc32c(a, sizeA), SimdCrc32c(b, sizeB), sizeB) == SimdCrc32c(a + b, sizeA + sizeB);
+        \endverbatim
+
+        \param [in] crc1 - a CRC32c of the first block.
+        \param [in] crc2 - a CRC32c of the second block.
+        \param [in] size2 - a size of the second block.
+        \return 32-bit cyclic redundancy check (CRC32c) of concatenated blocks.
+    */
+    SIMD_API uint32_t SimdCrc32cCombine(uint32_t crc1, uint32_t crc2, size_t size2);
+
+    /*! @ingroup hash
+
+        \fn void SimdCrc32cBatch(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc);
+
+        \short Gets 32-bit cyclic redundancy checks (CRC32c) for a batch of independent buffers.
+
+        Buffers are hashed by triples with interleaving of independent CRC32c instruction chains in order to hide latency of the instruction.
+        It is faster than sequential calls of ::SimdCrc32c for many small buffers.
+
+        \param [in] src - a pointer to array with pointers to buffers.
+        \param [in] size - a pointer to array with sizes of buffers.
+        \param [in] count - a number of buffers.
+        \param [out] crc - a pointer to output array with 32-bit cyclic redundancy checks (CRC32c) of buffers.
+    */
+    SIMD_API void SimdCrc32cBatch(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc);
+
     /*! @ingroup correlation
 
         \fn void SimdAbsDifference(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t * c, size_t cStride, size_t width, size_t height);
@@ -1361,6 +1481,57 @@ extern "C"
     */
     SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 8-bit or 16-bit Bayer image to 24-bit BGR with using of given demosaicing method and white balance gains.
+
+        All images must have the same width and height. The width and the height must be even.
+        White balance gains are applied to raw Bayer values before demosaicing (results are saturated by maximal value for given bit depth).
+
+        \note This function has a C++ wrapper Simd::BayerToBgr(const View<A>& bayer, View<A>& bgr, SimdBayerDemosaicType demosaic, const float * gains).
+
+        \param [in] bayer - a pointer to pixels data of input Bayer image. Pixels have 8-bit (if bitDepth is 8) or 16-bit (little-endian) size.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bayerStride - a row size (in bytes) of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [in] bitDepth - a bit depth of input Bayer image. It must be in range [8..16] (for example 10 or 12 for raw sensor data).
+        \param [in] demosaic - a demosaicing method (see ::SimdBayerDemosaicType).
+        \param [in] gains - a pointer to array with white balance gains for blue, green and red channels. Gains must be in range [0..8). Can be NULL.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, 
+        size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts 8-bit or 16-bit Bayer image to 32-bit BGRA with using of given demosaicing method and white balance gains.
+
+        All images must have the same width and height. The width and the height must be even.
+        White balance gains are applied to raw Bayer values before demosaicing (results are saturated by maximal value for given bit depth).
+
+        \note This function has a C++ wrapper Simd::BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha, SimdBayerDemosaicType demosaic, const float * gains).
+
+        \param [in] bayer - a pointer to pixels data of input Bayer image. Pixels have 8-bit (if bitDepth is 8) or 16-bit (little-endian) size.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bayerStride - a row size (in bytes) of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [in] bitDepth - a bit depth of input Bayer image. It must be in range [8..16] (for example 10 or 12 for raw sensor data).
+        \param [in] demosaic - a demosaicing method (see ::SimdBayerDemosaicType).
+        \param [in] gains - a pointer to array with white balance gains for blue, green and red channels. Gains must be in range [0..8). Can be NULL.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+        size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
@@ -1462,6 +1633,31 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV420P with given YUV color matrix and range.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1486,6 +1682,31 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV422P with given YUV color matrix and range.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1509,6 +1730,30 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV444P with given YUV color matrix and range.
+
+        The input BGRA and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
@@ -1701,6 +1946,31 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV420P with given YUV color matrix and range.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1725,6 +1995,31 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV422P with given YUV color matrix and range.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1748,6 +2043,30 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV444P with given YUV color matrix and range.
+
+        The input BGR and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup binarization
 
         \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
@@ -2051,6 +2370,9 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::Copy(const View<A> & src, View<B> & dst).
 
+        \note Images which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of source image.
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -2071,6 +2393,9 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::CopyFrame(const View<A>& src, const Rectangle<ptrdiff_t> & frame, View<A>& dst).
 
+        \note Images which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of source image.
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -2167,6 +2492,7 @@ extern "C"
 
         This function supports OpenCV HAAR and LBP cascades type.
         Tree based cascades and old cascade formats are not supported.
+        It also loads cascades in binary format which were saved by function ::SimdDetectionSaveA (the format is detected automatically).
 
         \note This function is used for implementation of Simd::Detection.
 
@@ -2176,6 +2502,36 @@ extern "C"
     */
     SIMD_API void * SimdDetectionLoadA(const char * path);
 
+    /*! @ingroup object_detection
+
+        \fn void * SimdDetectionLoadBinary(const uint8_t * data, size_t size);
+
+        \short Loads a classifier cascade from a memory buffer in binary format.
+
+        The binary format is created by function ::SimdDetectionSaveA. It does not need any parsing, so loading is much faster than loading of XML.
+        The buffer can be a read-only memory-mapped file or shared memory. It is not used after the function returns.
+
+        \param [in] data - a pointer to buffer with binary cascade.
+        \param [in] size - a size of the buffer.
+        \return a pointer to loaded cascade. On error it returns NULL.
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdDetectionLoadBinary(const uint8_t * data, size_t size);
+
+    /*! @ingroup object_detection
+
+        \fn SimdBool SimdDetectionSaveA(const void * data, const char * path);
+
+        \short Saves a classifier cascade to file in binary format.
+
+        \note The binary format depends on byte order of the platform.
+
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadStringXml.
+        \param [in] path - a path to output file.
+        \return a result of this operation.
+    */
+    SIMD_API SimdBool SimdDetectionSaveA(const void * data, const char * path);
+
     /*! @ingroup object_detection
 
         \fn void * SimdDetectionLoadStringXml(char * xml);
@@ -2253,6 +2609,43 @@ extern "C"
     */
     SIMD_API void SimdDetectionPrepare(void * hid);
 
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionPrepareRegion(void * hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom);
+
+        \short Prepares a region of hidden classifier cascade structure to work with given input 8-bit gray image.
+
+        It is analogue of function ::SimdDetectionPrepare which is restricted to the given region of integral images.
+        It is useful when integral images are estimated only for a part of input image.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] left - a left side of the region in integral images.
+        \param [in] top - a top side of the region in integral images.
+        \param [in] right - a right side of the region in integral images.
+        \param [in] bottom - a bottom side of the region in integral images.
+    */
+    SIMD_API void SimdDetectionPrepareRegion(void * hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom);
+
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionSetAdaptiveStep(void * hid, float level);
+
+        \short Sets adaptive step mode of hidden classifier cascade structure.
+
+        In this mode functions ::SimdDetectionHaarDetect32fi and ::SimdDetectionLbpDetect16ii skip a scanning window
+        if the window placed above it (in the previous processed row) was strongly rejected by the first stage of the cascade.
+        A window is strongly rejected if the sum of the first stage is less than: min + (threshold - min)*level, where min is a minimal possible sum of the stage.
+        It significantly increases performance for mostly empty scenes at the cost of a little lower detection rate.
+
+        \note This function is used for implementation of Simd::Detection. The result of detection in this mode depends on the row range passed to detection function.
+
+        \param [in, out] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] level - a level of strong rejection. It must be in range [0, 1]. Zero value disables adaptive step mode (it is default).
+    */
+    SIMD_API void SimdDetectionSetAdaptiveStep(void * hid, float level);
+
     /*! @ingroup object_detection
 
         \fn void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
@@ -2610,6 +3003,9 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::Fill(View<A>& dst, uint8_t value).
 
+        \note Images which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [out] dst - a pointer to pixels data of destination image.
         \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
@@ -2667,6 +3063,9 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::FillBgra(View<A>& dst, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha).
 
+        \note Images which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [out] dst - a pointer to pixels data of destination image.
         \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
@@ -2792,6 +3191,56 @@ extern "C"
     */
     SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances);
 
+    /*! @ingroup float16
+
+        \fn void SimdSquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums);
+
+        \short Calculates sums of squares (squared norms) of N 16-bit float arrays.
+
+        Arrays are stored contiguously (with stride K).
+
+        Algorithm description:
+        \verbatim
+        sums[i] = Sum(A[i*K + k]*A[i*K + k]);
+        \endverbatim
+
+        \param [in] N - a number of arrays.
+        \param [in] K - a size of arrays.
+        \param [in] A - a pointer to 16-bit float arrays. Its size must be N*K.
+        \param [out] sums - a pointer to output 32-bit float sums of squares. Its size must be N.
+    */
+    SIMD_API void SimdSquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums);
+
+    /*! @ingroup float16
+
+        \fn void SimdCosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances);
+
+        \short Finds for each of M query 16-bit float arrays the topK nearest (by cosine distance) arrays of the gallery.
+
+        Queries and gallery arrays are stored contiguously (with stride K). Norms of all arrays are calculated once,
+        the gallery is processed by tiles (in several threads for big tasks) and the full M*N distance matrix is never stored.
+        Squared norms of a gallery which is searched many times can be calculated once with ::SimdSquareSums16f and passed in.
+
+        Algorithm description:
+        \verbatim
+        distance[i, j] = 1 - Sum(A[i*K + k]*B[j*K + k])/Sqrt(Sum(A[i*K + k]*A[i*K + k])*Sum(B[j*K + k]*B[j*K + k]));
+        indices[i*topK + t], distances[i*topK + t] - index and distance of t-th nearest to i-th query gallery array.
+        \endverbatim
+
+        \note Results for every query are sorted in ascending order of distance. If N < topK then extra positions are filled by UINT32_MAX indices and FLT_MAX distances.
+
+        \param [in] M - a number of query arrays.
+        \param [in] N - a number of gallery arrays.
+        \param [in] K - a size of query and gallery arrays.
+        \param [in] A - a pointer to query 16-bit float arrays. Its size must be M*K.
+        \param [in] B - a pointer to gallery 16-bit float arrays. Its size must be N*K.
+        \param [in] bSquares - a pointer to squared norms of gallery arrays calculated by ::SimdSquareSums16f. Its size must be N. Can be NULL, then they are calculated on every call.
+        \param [in] topK - a number of nearest gallery arrays to find for every query.
+        \param [out] indices - a pointer to output indices of nearest gallery arrays. Its size must be M*topK.
+        \param [out] distances - a pointer to output cosine distances to nearest gallery arrays. Its size must be M*topK.
+    */
+    SIMD_API void SimdCosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances);
+
     /*! @ingroup other_conversion
 
         \fn void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst);
@@ -2882,25 +3331,50 @@ extern "C"
 
         \fn void * SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float * radius);
 
-        \short Creates Gaussian blur filter context.
+        \short Creates Gaussian blur filter context for 8-bit image.
+
+        The algorithm is chosen automatically: separable convolution with window (6*sigma + 1) for sigma <= 3 
+        and recursive (IIR) Gaussian filter of Young - van Vliet for larger sigma, so the filtering time does not depend on sigma.
+
+        \note This filter supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at creation of the context.
+            The filter has only AVX2 optimization: for SSE4.1, AVX-512 and NEON it uses the scalar implementation.
 
         \param [in] width - a width of input and output image.
         \param [in] height - a height of input and output image.
-        \param [in] channels - a channel number of input and output image.
-        \param [in] radius - a pointer to radius of Gaussian blur.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] radius - a pointer to radius (sigma, standard deviation) of Gaussian blur.
         \return a pointer to filter context. On error it returns NULL.
                 This pointer is used in functions ::SimdGaussianBlurRun.
                 It must be released with using of function ::SimdRelease.
     */
     SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float * radius);
 
+    /*! @ingroup gaussian_filter
+
+        \fn void * SimdGaussianBlurInit32f(size_t width, size_t height, size_t channels, const float * radius);
+
+        \short Creates Gaussian blur filter context for 32-bit float image.
+
+        It is the same as ::SimdGaussianBlurInit but works with 32-bit float pixel channels.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image (from 1 to 4).
+        \param [in] radius - a pointer to radius (sigma, standard deviation) of Gaussian blur.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdGaussianBlurRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdGaussianBlurInit32f(size_t width, size_t height, size_t channels, const float * radius);
+
     /*! @ingroup gaussian_filter
 
         \fn void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
         \short Performs image Gaussian bluring.
 
-        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit and released by function ::SimdRelease.
+        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit (::SimdGaussianBlurInit32f) and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
         \param [out] dst - a pointer to pixels data of the filtered output image.
@@ -3463,6 +3937,35 @@ extern "C"
     */
     SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup other_conversion
+
+        \fn void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride, size_t bitDepth, SimdDepthReductionType reduction);
+
+        \short Converts 16-bit unsigned integer image with given bit depth to 8-bit gray image.
+
+        All images must have the same width and height. The input values are stored in low bits (LSB aligned).
+        Use bitDepth = 16 for MSB aligned data (for example for Y plane of P010 image).
+
+        For every point:
+        \verbatim
+        shift = bitDepth - 8;
+        dst[x, y] = Min(255, Min(65535, src[x, y] + offset[x & 3, y & 3]) >> shift);
+        \endverbatim
+        where offset is equal to (1 << (shift - 1)) for ::SimdDepthReductionRound and is taken from 4x4 Bayer matrix for ::SimdDepthReductionDither.
+
+        \note This function has a C++ wrapper Simd::Uint16ToGray(const View<A> & src, View<A> & dst, size_t bitDepth, SimdDepthReductionType reduction).
+
+        \param [in] src - a pointer to pixels data of input 16-bit unsigned integer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] srcStride - a row size (in bytes) of the 16-bit unsigned integer image.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the gray image.
+        \param [in] bitDepth - a bit depth of input image. It must be in range [9..16].
+        \param [in] reduction - a method of bit depth reduction (see ::SimdDepthReductionType).
+    */
+    SIMD_API void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride, size_t bitDepth, SimdDepthReductionType reduction);
+
     /*! @ingroup integral
 
         \fn void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
@@ -4529,6 +5032,202 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input interleaved UV plane (U, V order) has half height and the same row size in bytes as Y plane.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input interleaved UV plane (U, V order) has half height and the same row size in bytes as Y plane.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input interleaved UV plane (U, V order) has half height and the same row size in bytes as Y plane.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+    */
+    SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input interleaved UV plane (V, U order) has half height and the same row size in bytes as Y plane.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input interleaved UV plane (V, U order) has half height and the same row size in bytes as Y plane.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input interleaved UV plane (V, U order) has half height and the same row size in bytes as Y plane.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+    */
+    SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, SimdDepthReductionType reduction);
+
+        \short Converts P010 image to 8-bit YUV420P image.
+
+        P010 image has 16-bit Y plane and 16-bit interleaved UV plane (U, V order) of half width and height. Significant 10 bits of every value are stored in high bits.
+        The input Y and output Y images must have the same width and height. The output U and V images have half width and height.
+        Width and height must be even.
+
+        \note This function has a C++ wrapper: Simd::P010ToYuv420p(const View<A>& y, const View<A>& uv, View<A>& dy, View<A>& du, View<A>& dv, SimdDepthReductionType reduction).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit UV color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dy - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] dyStride - a row size of the dy image.
+        \param [out] du - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] duStride - a row size of the du image.
+        \param [out] dv - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] dvStride - a row size of the dv image.
+        \param [in] reduction - a method of bit depth reduction (see ::SimdDepthReductionType).
+    */
+    SIMD_API void SimdP010ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, SimdDepthReductionType reduction);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction);
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        P010 image has 16-bit Y plane and 16-bit interleaved UV plane (U, V order) of half width and height. Significant 10 bits of every value are stored in high bits.
+        The input Y and output BGRA images must have the same width and height. Width and height must be even.
+        The components are reduced to 8 bits before color conversion.
+
+        \note This function has a C++ wrapper: Simd::P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit UV color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+        \param [in] reduction - a method of bit depth reduction (see ::SimdDepthReductionType).
+    */
+    SIMD_API void SimdP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -4762,6 +5461,9 @@ extern "C"
 
         The data size must be a multiple of 2.
 
+        \note Arrays which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to the input data.
         \param [in] size - a size of input and output data.
         \param [out] dst - a pointer to the output data.
@@ -4784,6 +5486,9 @@ extern "C"
 
         The data size must be a multiple of 4.
 
+        \note Arrays which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to the input data.
         \param [in] size - a size of input and output data.
         \param [out] dst - a pointer to the output data.
@@ -4810,6 +5515,9 @@ extern "C"
 
         The data size must be a multiple of 8.
 
+        \note Arrays which are larger than half of L3 cache (see ::SimdCpuInfoCacheL3) are written with non-temporal (streaming) stores
+            in order to keep the cache. In this case the function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to the input data.
         \param [in] size - a size of input and output data.
         \param [out] dst - a pointer to the output data.
@@ -4864,7 +5572,11 @@ extern "C"
 
         \short Performs image resizing.
 
-        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
+        \note A context created by ::SimdResizerInit keeps its temporary buffer, so it must not be used concurrently from several threads.
+            A context created by ::SimdResizerInitShared allocates the buffer on each call and may be used concurrently.
+            Use ::SimdResizerRunBuffered to share one context between threads without memory allocation.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit (or ::SimdResizerInitShared) and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
         \param [out] dst - a pointer to pixels data of the resized output image.
@@ -4872,6 +5584,105 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerInitShared(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates resize context which shares its coefficients with other contexts of the same parameters.
+
+        Resize coefficients are kept in a process-wide cache keyed by all parameters of the function.
+        Contexts with equal parameters refer to the same coefficients. The cache holds the coefficients of 16 most recently used
+        parameter sets, so they outlive the contexts and are reused by later calls (for example by Simd::Resize).
+        The function is thread safe.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] channels - a channel number of input and output image.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize image.
+        \return a pointer to resize context. On error it returns NULL.
+                This pointer is used in functions ::SimdResizerRun and ::SimdResizerRunBuffered.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerInitShared(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn size_t SimdResizerBufferSize(const void * resizer);
+
+        \short Gets size of temporary buffer required by function ::SimdResizerRunBuffered.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit or ::SimdResizerInitShared.
+        \return a size (in bytes) of the temporary buffer. It can be equal to 0.
+    */
+    SIMD_API size_t SimdResizerBufferSize(const void * resizer);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerRunBuffered(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer);
+
+        \short Performs image resizing with using of external temporary buffer.
+
+        It is the same as ::SimdResizerRun but does not allocate memory. 
+        Several threads may use the same resize context simultaneously if each of them has its own buffer.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit (or ::SimdResizerInitShared) and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+        \param [out] buffer - a pointer to temporary buffer. Its size must be at least ::SimdResizerBufferSize bytes. 
+            It must be aligned by ::SimdAlignment (use ::SimdAllocate to allocate it).
+    */
+    SIMD_API void SimdResizerRunBuffered(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer);
+
+    /*! @ingroup resizing
+
+        \fn void * SimdCropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType);
+
+        \short Creates a context of batched crop and resize of many regions of interest of one image.
+
+        Every region is resized (with separable bilinear or area interpolation) into its own output tensor, normalized and stored 
+        into a contiguous batch. Region coordinates are floats, so sub-pixel crops (for example detector boxes) are supported.
+        Samples outside of the source image repeat the nearest border pixel.
+
+        \param [in] srcWidth - a width of source image.
+        \param [in] srcHeight - a height of source image.
+        \param [in] channels - a channel number of source image (from 1 to 4).
+        \param [in] srcType - a type of source image channels. There are supported following types: ::SimdResizeChannelByte, ::SimdResizeChannelFloat.
+        \param [in] dstWidth - a width of output tensor.
+        \param [in] dstHeight - a height of output tensor.
+        \param [in] method - a method of interpolation. There are supported following methods: ::SimdResizeMethodBilinear, ::SimdResizeMethodArea.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. It corresponds to 0 in source image. The size of the array have to be equal to channels. Can be NULL (0 is used).
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. It corresponds to 255 in source image. The size of the array have to be equal to channels. Can be NULL (255 is used).
+        \param [in] tensorFormat - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] tensorType - a data type of output tensor. There are supported following types: ::SimdTensorData32f, ::SimdTensorData8u (values are rounded and saturated).
+        \return a pointer to crop and resize context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdCropAndResizeRun.
+    */
+    SIMD_API void * SimdCropAndResizeInit(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+        SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType);
+
+    /*! @ingroup resizing
+
+        \fn void SimdCropAndResizeRun(const void * context, const uint8_t * src, size_t srcStride, const float * rois, size_t roiCount, uint8_t * dst);
+
+        \short Performs batched crop and resize of regions of interest.
+
+        Regions are processed in parallel (see ::SimdSetThreadNumber). The context is not changed, so it can be used in several threads simultaneously.
+
+        \param [in] context - a crop and resize context. It must be created by function ::SimdCropAndResizeInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the source image.
+        \param [in] srcStride - a row size (in bytes) of the source image. For ::SimdResizeChannelFloat it must be a multiple of 4.
+        \param [in] rois - a pointer to array of regions of interest (4 float values per region in source pixel coordinates: left, top, right, bottom). 
+            Can be NULL (whole image is used).
+        \param [in] roiCount - a number of regions of interest. It is ignored if rois is NULL.
+        \param [out] dst - a pointer to output tensors. Tensors of regions are placed consecutively (as a batch).
+    */
+    SIMD_API void SimdCropAndResizeRun(const void * context, const uint8_t * src, size_t srcStride, const float * rois, size_t roiCount, uint8_t * dst);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -5321,6 +6132,39 @@ extern "C"
     SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
         const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
 
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride, const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums);
+
+        \short Calculates sums of squared differences between every 8-bit array from A and every 8-bit array from B.
+
+        Arrays of A and B are stored contiguously with given strides (for example a set of image hashes).
+
+        For every pair of arrays:
+        \verbatim
+        sum = 0;
+        for(k = 0; k < K; ++k)
+            sum += (A[i*aStride + k] - B[j*bStride + k])*(A[i*aStride + k] - B[j*bStride + k]);
+        sums[i*N + j] = sum <= threshold ? sum : UINT32_MAX;
+        \endverbatim
+
+        \note Calculation of a pair can be stopped as soon as its partial sum exceeds the threshold.
+            Use threshold equal to UINT32_MAX to get all sums.
+            This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] M - a number of A arrays.
+        \param [in] N - a number of B arrays.
+        \param [in] K - a size of A and B arrays. It must be not greater than 65536.
+        \param [in] A - a pointer to the first array of A.
+        \param [in] aStride - a distance (in bytes) between A arrays.
+        \param [in] B - a pointer to the first array of B.
+        \param [in] bStride - a distance (in bytes) between B arrays.
+        \param [in] threshold - a maximal sum. Greater sums are returned as UINT32_MAX.
+        \param [out] sums - a pointer to the output array with sums. Its size must be M*N.
+    */
+    SIMD_API void SimdSquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+        const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums);
+
     /*! @ingroup correlation
 
         \fn void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
@@ -5686,6 +6530,57 @@ extern "C"
     */
     SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
 
+    /*! @ingroup svm
+
+        \fn void * SimdSvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+
+        \short Creates context of kernel SVM (Support Vector Machine) prediction.
+
+        Support vectors and their weights are copied into the context. 
+        The context is used in function ::SimdSvmKernelSum in order to predict a batch of vectors.
+
+        \note The array with support vectors must has following structure: svs[length][count] (the same as in function ::SimdSvmSumLinear).
+
+        \param [in] svs - an array with support vectors.
+        \param [in] weights - a weight coefficient of each support vector.
+        \param [in] length - a length of current and support vectors.
+        \param [in] count - a count of support vectors.
+        \param [in] type - a type of SVM kernel (see ::SimdSvmKernelType).
+        \param [in] gamma - a gamma parameter of polynomial and RBF kernels.
+        \param [in] coef0 - a coef0 parameter of polynomial kernel.
+        \param [in] degree - a degree of polynomial kernel. It must be positive for polynomial kernel.
+        \return a pointer to SVM kernel context. On error it returns NULL.
+                This pointer is used in function ::SimdSvmKernelSum.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdSvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+
+    /*! @ingroup svm
+
+        \fn void SimdSvmKernelSum(const void * context, const float * x, size_t batch, float * sum);
+
+        \short It is a part of kernel SVM (Support Vector Machine) prediction algorithm for a batch of vectors.
+
+        Algorithm's details:
+        \verbatim
+        for(b = 0; b < batch; ++b)
+        {
+            sum[b] = 0;
+            for(i = 0; i < count; ++i)
+                sum[b] += K(x[b], svs[i])*weight[i];
+        }
+        \endverbatim
+
+        The kernel matrix is computed tile by tile: dot products of vectors and support vectors are found with using of GEMM 
+        and then are converted to kernel values and accumulated with weights.
+
+        \param [in] context - a SVM kernel context. It must be created by function ::SimdSvmKernelInit and released by function ::SimdRelease.
+        \param [in] x - an array with vectors which need to predict. Its size must be equal to batch*length.
+        \param [in] batch - a number of vectors.
+        \param [out] sum - a pointer to array with result sums. Its size must be equal to batch.
+    */
+    SIMD_API void SimdSvmKernelSum(const void * context, const float * x, size_t batch, float * sum);
+
     /*! @ingroup synet
 
         \fn void SimdSynetAddBias(const float * bias, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
@@ -6830,6 +7725,51 @@ extern "C"
     SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
         const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
+    /*! @ingroup synet_conversion
+
+        \fn void * SimdSynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight, SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding);
+
+        \short Initializes context of fused image preprocessing (color conversion, resizing and normalization) for input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The context converts source image (or its regions of interest) into output tensor in one pass: every used source row is converted to 
+        destination pixel format, bilinearly resized and normalized (as in function ::SimdSynetSetInput) without creation of full-size intermediate images.
+
+        \param [in] srcWidth - a width of source image.
+        \param [in] srcHeight - a height of source image.
+        \param [in] srcFormat - a format of source image. For ::SimdSynetSourceNv12 and ::SimdSynetSourceYuv420p image width and height must be even.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). It is used only for YUV source formats.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] dstFormat - a pixel format of output image tensor. There are supported following pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatRgb24.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor. Can be NULL (0 is used).
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor. Can be NULL (255 is used).
+        \param [in] tensorFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] tensorType - a data type of output image tensor. There are supported following types: ::SimdTensorData32f, ::SimdTensorData8u (values are rounded and saturated).
+        \param [in] letterbox - a flag to keep aspect ratio of source region. The resized region is centered and the rest of output tensor is filled by padding.
+        \param [in] padding - a value of padding pixels (before normalization).
+        \return a pointer to preprocessing context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSynetPreprocessRun.
+    */
+    SIMD_API void * SimdSynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight, 
+        SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetPreprocessRun(const void * context, const uint8_t * const * src, const size_t * srcStride, const ptrdiff_t * rois, size_t roiCount, uint8_t * dst);
+
+        \short Performs fused image preprocessing for input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \note The context uses internal buffers, so it is not thread safe. Use separate contexts in different threads.
+
+        \param [in] context - a preprocessing context. It must be created by function ::SimdSynetPreprocessInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to array with pointers to planes of source image: one plane for packed formats, two planes (Y and UV) for ::SimdSynetSourceNv12, three planes (Y, U and V) for ::SimdSynetSourceYuv420p.
+        \param [in] srcStride - a pointer to array with row sizes of source image planes.
+        \param [in] rois - a pointer to array of regions of interest (4 values per region: left, top, right, bottom). Regions are clipped by source image boundaries. Can be NULL (whole image is used).
+        \param [in] roiCount - a number of regions of interest. It is ignored if rois is NULL.
+        \param [out] dst - a pointer to output tensors. Tensors of regions are placed consecutively (as a batch).
+    */
+    SIMD_API void SimdSynetPreprocessRun(const void * context, const uint8_t * const * src, const size_t * srcStride, const ptrdiff_t * rois, size_t roiCount, uint8_t * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetShuffleLayerForward(const float * src0, const float * src1, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format, int type);
@@ -7554,6 +8494,32 @@ extern "C"
     SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit BGR image with given YUV color matrix and range.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
@@ -7579,6 +8545,32 @@ extern "C"
     SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 24-bit BGR image with given YUV color matrix and range.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
@@ -7603,6 +8595,31 @@ extern "C"
     SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit BGR image with given YUV color matrix and range.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7629,6 +8646,95 @@ extern "C"
     SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 32-bit BGRA image with given YUV color matrix and range.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, size_t bitDepth, SimdDepthReductionType reduction);
+
+        \short Converts 16-bit YUV420P image (for example I010) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        The input values are stored in low bits (LSB aligned). The components are reduced to 8 bits before color conversion.
+
+        \note This function has a C++ wrapper: Simd::Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, size_t bitDepth, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size (in bytes) of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size (in bytes) of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+        \param [in] bitDepth - a bit depth of input image (10 for I010). It must be in range [9..16].
+        \param [in] reduction - a method of bit depth reduction (see ::SimdDepthReductionType).
+    */
+    SIMD_API void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, size_t bitDepth, SimdDepthReductionType reduction);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, size_t bitDepth, SimdDepthReductionType reduction);
+
+        \short Converts 16-bit YUV420P image (for example I010) to 8-bit YUV420P image.
+
+        The input and output Y images must have the same width and height.
+        The input and output U and V images must have half width and height. Width and height must be even.
+        The input values are stored in low bits (LSB aligned).
+
+        \note This function has a C++ wrapper: Simd::Yuv420p16ToYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& dy, View<A>& du, View<A>& dv, size_t bitDepth, SimdDepthReductionType reduction).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size (in bytes) of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size (in bytes) of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dy - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] dyStride - a row size of the dy image.
+        \param [out] du - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] duStride - a row size of the du image.
+        \param [out] dv - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] dvStride - a row size of the dv image.
+        \param [in] bitDepth - a bit depth of input image (10 for I010). It must be in range [9..16].
+        \param [in] reduction - a method of bit depth reduction (see ::SimdDepthReductionType).
+    */
+    SIMD_API void SimdYuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+        uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, size_t bitDepth, SimdDepthReductionType reduction);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7655,6 +8761,33 @@ extern "C"
     SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 32-bit BGRA image with given YUV color matrix and range.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7680,6 +8813,32 @@ extern "C"
     SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 32-bit BGRA image with given YUV color matrix and range.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride);
@@ -7802,6 +8961,32 @@ extern "C"
     SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit RGB image with given YUV color matrix and range.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
@@ -7827,6 +9012,32 @@ extern "C"
     SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 24-bit RGB image with given YUV color matrix and range.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
@@ -7851,6 +9062,31 @@ extern "C"
     SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit RGB image with given YUV color matrix and range.
+
+        The input Y, U, V and output RGB images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of YUV color matrix and range (see ::SimdYuvType). It must be a valid type other than ::SimdYuvUnknown.
+    */
+    SIMD_API void SimdYuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -665,6 +665,30 @@ namespace Simd
         SimdBayerToBgr(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgr.data, bgr.stride);
     }
 
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgr(const View<A>& bayer, View<A>& bgr, SimdBayerDemosaicType demosaic, const float * gains = NULL);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of given demosaicing method and white balance gains.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgrV2.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] demosaic - a demosaicing method (see ::SimdBayerDemosaicType).
+        \param [in] gains - a pointer to array with white balance gains for blue, green and red channels. Can be NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgr(const View<A>& bayer, View<A>& bgr, SimdBayerDemosaicType demosaic, const float * gains = NULL)
+    {
+        assert(EqualSize(bgr, bayer) && bgr.format == View<A>::Bgr24);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToBgrV2(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, 8, demosaic, gains, bgr.data, bgr.stride);
+    }
+
     /*! @ingroup bayer_conversion
 
         \fn void BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha = 0xFF);
@@ -688,6 +712,31 @@ namespace Simd
         SimdBayerToBgra(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha, SimdBayerDemosaicType demosaic, const float * gains = NULL);
+
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of given demosaicing method and white balance gains.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgraV2.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] demosaic - a demosaicing method (see ::SimdBayerDemosaicType).
+        \param [in] gains - a pointer to array with white balance gains for blue, green and red channels. Can be NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha, SimdBayerDemosaicType demosaic, const float * gains = NULL)
+    {
+        assert(EqualSize(bgra, bayer) && bgra.format == View<A>::Bgra32);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToBgraV2(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, 8, demosaic, gains, bgra.data, bgra.stride, alpha);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToBayer(const View<A>& bgra, View<A>& bayer)
@@ -772,77 +821,80 @@ namespace Simd
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 32-bit BGRA image to YUV420P.
 
         The input BGRA and output Y images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv420p.
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv420pV2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv420p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToYuv420pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 32-bit BGRA image to YUV422P.
 
         The input BGRA and output Y images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv422p.
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv422pV2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv422p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToYuv422pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 32-bit BGRA image to YUV444P.
 
         The input BGRA and output Y, U and V images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv444p.
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv444pV2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(EqualSize(bgra, y) && Compatible(y, u, v));
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv444p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToYuv444pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
@@ -1019,77 +1071,80 @@ namespace Simd
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 24-bit BGR image to YUV420P.
 
         The input BGR and output Y images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv420p.
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv420pV2.
 
         \param [in] bgr - an input 24-bit BGR image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdBgrToYuv420p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToYuv420pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 24-bit BGR image to YUV422P.
 
         The input BGR and output Y images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv422p.
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv422pV2.
 
         \param [in] bgr - an input 24-bit BGR image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdBgrToYuv422p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToYuv422pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts 24-bit BGR image to YUV444P.
 
         The input BGR and output Y, U and V images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv444p.
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv444pV2.
 
         \param [in] bgr - an input 24-bit BGR image.
         \param [out] y - an output 8-bit image with Y color plane.
         \param [out] u - an output 8-bit image with U color plane.
         \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(EqualSize(bgr, y) && Compatible(y, u, v));
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdBgrToYuv444p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToYuv444pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
     }
 
     /*! @ingroup binarization
@@ -1433,6 +1488,25 @@ namespace Simd
             frame.left, frame.top, frame.right, frame.bottom, dst.data, dst.stride);
     }
 
+    /*! @ingroup hash
+
+        \fn uint32_t Crc32c(const View<A> & src, uint32_t crc = 0)
+
+        \short Gets (or updates) 32-bit cyclic redundancy check (CRC32c) of image pixels.
+
+        A padding at the end of image rows is ignored.
+
+        \note This function is a C++ wrapper for function ::SimdCrc32cUpdate.
+
+        \param [in] src - an input image.
+        \param [in] crc - a CRC32c of previous data. It is equal to 0 by default.
+        \return 32-bit cyclic redundancy check (CRC32c).
+    */
+    template<template<class> class A> SIMD_INLINE uint32_t Crc32c(const View<A> & src, uint32_t crc = 0)
+    {
+        return SimdCrc32cUpdate(crc, src.data, src.stride, src.width * src.PixelSize(), src.height);
+    }
+
     /*! @ingroup other_conversion
 
         \fn void DeinterleaveUv(const View<A>& uv, View<A>& u, View<A>& v)
@@ -1825,6 +1899,35 @@ namespace Simd
         SimdGaussianBlur3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup gaussian_filter
+
+        \fn void GaussianBlur(const View<A>& src, View<A>& dst, float sigma)
+
+        \short Performs Gaussian blur filtration with arbitrary sigma.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR, 32-bit BGRA or 32-bit float).
+
+        \note This function is a C++ wrapper for functions ::SimdGaussianBlurInit, ::SimdGaussianBlurInit32f and ::SimdGaussianBlurRun.
+            Use these functions directly to reuse the filter context for a sequence of images.
+
+        \param [in] src - a source image.
+        \param [out] dst - a destination image.
+        \param [in] sigma - a sigma (standard deviation) of Gaussian blur.
+    */
+    template<template<class> class A> SIMD_INLINE void GaussianBlur(const View<A>& src, View<A>& dst, float sigma)
+    {
+        assert(Compatible(src, dst) && (src.ChannelSize() == 1 || src.format == View<A>::Float));
+
+        void * filter = src.format == View<A>::Float ?
+            SimdGaussianBlurInit32f(src.width, src.height, 1, &sigma) :
+            SimdGaussianBlurInit(src.width, src.height, src.ChannelCount(), &sigma);
+        if (filter)
+        {
+            SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(filter);
+        }
+    }
+
     /*! @ingroup gray_conversion
 
         \fn void GrayToBgr(const View<A>& gray, View<A>& bgr)
@@ -2105,6 +2208,28 @@ namespace Simd
         SimdInt16ToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void Uint16ToGray(const View<A> & src, View<A> & dst, size_t bitDepth, SimdDepthReductionType reduction = SimdDepthReductionRound)
+
+        \short Converts 16-bit unsigned integer image with given bit depth to 8-bit gray image.
+
+        All images must have the same width and height. The input values are stored in low bits (LSB aligned).
+
+        \note This function is a C++ wrapper for function ::SimdUint16ToGray.
+
+        \param [in] src - an input 16-bit unsigned integer image.
+        \param [out] dst - an output 8-bit gray image.
+        \param [in] bitDepth - a bit depth of input image. It must be in range [9..16].
+        \param [in] reduction - a method of bit depth reduction. It is equal to ::SimdDepthReductionRound by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Uint16ToGray(const View<A> & src, View<A> & dst, size_t bitDepth, SimdDepthReductionType reduction = SimdDepthReductionRound)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Int16 && dst.format == View<A>::Gray8);
+
+        SimdUint16ToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride, bitDepth, reduction);
+    }
+
     /*! @ingroup integral
 
         \fn void Integral(const View<A>& src, View<A>& sum)
@@ -2612,6 +2737,199 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image (U, V order) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, bgr) && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image (U, V order) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image (U, V order) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, rgb) && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgb(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image (V, U order) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, bgr) && bgr.format == View<A>::Bgr24);
+
+        SimdNv21ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image (V, U order) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdNv21ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb)
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image (V, U order) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, rgb) && rgb.format == View<A>::Rgb24);
+
+        SimdNv21ToRgb(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToYuv420p(const View<A>& y, const View<A>& uv, View<A>& dy, View<A>& du, View<A>& dv, SimdDepthReductionType reduction = SimdDepthReductionRound)
+
+        \short Converts P010 image to 8-bit YUV420P image.
+
+        The input and output Y images must have the same width and height.
+        The input UV image (U, V order, 16 bits per component) and output U and V images must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToYuv420p.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [out] dy - an output 8-bit image with Y color plane.
+        \param [out] du - an output 8-bit image with U color plane.
+        \param [out] dv - an output 8-bit image with V color plane.
+        \param [in] reduction - a method of bit depth reduction. It is equal to ::SimdDepthReductionRound by default.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToYuv420p(const View<A>& y, const View<A>& uv, View<A>& dy, View<A>& du, View<A>& dv, SimdDepthReductionType reduction = SimdDepthReductionRound)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Int16 && uv.format == View<A>::Int32);
+        assert(EqualSize(y, dy) && EqualSize(uv, du) && Compatible(du, dv) && dy.format == View<A>::Gray8 && du.format == View<A>::Gray8);
+
+        SimdP010ToYuv420p(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dy.data, dy.stride, du.data, du.stride, dv.data, dv.stride, reduction);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601, SimdDepthReductionType reduction = SimdDepthReductionRound)
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image (U, V order, 16 bits per component) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
+        \param [in] reduction - a method of bit depth reduction. It is equal to ::SimdDepthReductionRound by default.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF,
+        SimdYuvType yuvType = SimdYuvBt601, SimdDepthReductionType reduction = SimdDepthReductionRound)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Int16 && uv.format == View<A>::Int32);
+        assert(EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdP010ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType, reduction);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -2960,7 +3278,7 @@ namespace Simd
 
         \short Performs resizing of image.
 
-        All images must have the same format.
+        All images must have the same format. Resize coefficients are shared between calls with the same sizes (see ::SimdResizerInitShared).
 
         \param [in] src - an original input image.
         \param [out] dst - a resized output image.
@@ -2977,7 +3295,7 @@ namespace Simd
         else
         {
             SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
-            void * resizer = SimdResizerInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
+            void * resizer = SimdResizerInitShared(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
             if (resizer)
             {
                 SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
@@ -3986,153 +4304,219 @@ namespace Simd
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV420P image to 24-bit BGR image.
 
         The input Y and output BGR images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv420pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV422P image to 24-bit BGR image.
 
         The input Y and output BGR images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgr.width && y.height == bgr.height);
         assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv422pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv422pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV444P image to 24-bit BGR image.
 
         The input Y, U, V and output BGR images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv444pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV420P image to 32-bit BGRA image.
 
         The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToBgra.
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, size_t bitDepth, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601, SimdDepthReductionType reduction = SimdDepthReductionRound)
+
+        \short Converts 16-bit YUV420P image (for example I010) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] bitDepth - a bit depth of input image (10 for I010).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
+        \param [in] reduction - a method of bit depth reduction. It is equal to ::SimdDepthReductionRound by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, size_t bitDepth,
+        uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601, SimdDepthReductionType reduction = SimdDepthReductionRound)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p16ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType, bitDepth, reduction);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& dy, View<A>& du, View<A>& dv, size_t bitDepth, SimdDepthReductionType reduction = SimdDepthReductionRound)
+
+        \short Converts 16-bit YUV420P image (for example I010) to 8-bit YUV420P image.
+
+        The input and output images must have the same size. U and V images have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToYuv420p.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] dy - an output 8-bit image with Y color plane.
+        \param [out] du - an output 8-bit image with U color plane.
+        \param [out] dv - an output 8-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input image (10 for I010).
+        \param [in] reduction - a method of bit depth reduction. It is equal to ::SimdDepthReductionRound by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToYuv420p(const View<A>& y, const View<A>& u, const View<A>& v,
+        View<A>& dy, View<A>& du, View<A>& dv, size_t bitDepth, SimdDepthReductionType reduction = SimdDepthReductionRound)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v) && y.format == View<A>::Int16 && u.format == View<A>::Int16);
+        assert(EqualSize(y, dy) && EqualSize(u, du) && Compatible(du, dv) && dy.format == View<A>::Gray8 && du.format == View<A>::Gray8);
+
+        SimdYuv420p16ToYuv420p(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height,
+            dy.data, dy.stride, du.data, du.stride, dv.data, dv.stride, bitDepth, reduction);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV422P image to 32-bit BGRA image.
 
         The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToBgra.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv422pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV444P image to 32-bit BGRA image.
 
         The input Y, U, V and output BGRA images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToBgra.
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(Compatible(y, u, v) && EqualSize(y, bgra) && y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv444pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv444pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
@@ -4228,76 +4612,79 @@ namespace Simd
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+        \fn void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV420P image to 24-bit RGB image.
 
         The input Y and output RGB images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToRgb.
+        \note This function is a C++ wrapper for function ::SimdYuv420pToRgbV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
         assert(y.width == rgb.width && y.height == rgb.height);
         assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdYuv420pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+        SimdYuv420pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+        \fn void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV422P image to 24-bit RGB image.
 
         The input Y and output RGB images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToRgb.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToRgbV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == rgb.width && y.height == rgb.height);
         assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdYuv422pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+        SimdYuv422pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+        \fn void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
 
         \short Converts YUV444P image to 24-bit RGB image.
 
         The input Y, U, V and output RGB images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToRgb.
+        \note This function is a C++ wrapper for function ::SimdYuv444pToRgbV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of YUV color matrix and range. It is equal to ::SimdYuvBt601 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
     {
         assert(Compatible(y, u, v) && EqualSize(y, rgb) && y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdYuv444pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+        SimdYuv444pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
     }
 
     /*! @ingroup universal_conversion
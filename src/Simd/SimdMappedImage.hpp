@@ -0,0 +1,386 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMappedImage_hpp__
+#define __SimdMappedImage_hpp__
+
+#include "Simd/SimdView.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <string>
+#include <vector>
+#include <ctype.h>
+
+#if defined(_MSC_VER)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__GNUC__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#error Platform is not supported!
+#endif
+
+namespace Simd
+{
+    /*! @ingroup cpp_mapped_image
+
+        \short The MappedImage structure provides zero-copy access to images stored in uncompressed files.
+
+        The file is memory-mapped (copy-on-write, so changes of pixels are never written back to the file) and Simd::MappedImage::Image returns a View which points directly to the mapped pixels.
+        Next file formats are supported:
+         - binary PGM (P5) with 8-bit depth - the image has Simd::View::Gray8 format;
+         - binary PPM (P6) with 8-bit depth - the image has Simd::View::Rgb24 format;
+         - uncompressed BMP with 24-bit (Simd::View::Bgr24), 32-bit (Simd::View::Bgra32) or 8-bit with gray palette (Simd::View::Gray8) pixels;
+         - raw files with pixels of given size and format.
+
+        Bottom-up BMP images are returned as vertically flipped View (with negative stride, see Simd::View::Flipped).
+        The View is valid until the image is closed.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdMappedImage.hpp"
+        #include "Simd/SimdLib.hpp"
+
+        int main()
+        {
+            typedef Simd::MappedImage<Simd::Allocator> MappedImage;
+            typedef MappedImage::View View;
+
+            MappedImage mapped;
+            if (mapped.Open("image.ppm"))
+            {
+                View bgra(mapped.Image().width, mapped.Image().height, View::Bgra32);
+                Simd::RgbToBgra(mapped.Image(), bgra);
+            }
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct MappedImage
+    {
+        typedef Simd::View<A> View; /*!< An image type definition. */
+
+        /*!
+            Creates a new empty MappedImage structure.
+        */
+        MappedImage();
+
+        /*!
+            Closes the mapped file and destroys the MappedImage structure.
+        */
+        ~MappedImage();
+
+        /*!
+            Maps binary PGM, PPM or BMP file. The format of the file is determined by its header.
+
+            \param [in] path - a path to the image file.
+            \return a result of the operation.
+        */
+        bool Open(const std::string & path);
+
+        /*!
+            Maps a raw image file.
+
+            \param [in] path - a path to the raw file.
+            \param [in] width - a width of the image.
+            \param [in] height - a height of the image.
+            \param [in] format - a pixel format of the image.
+            \param [in] stride - a row size of the image in bytes. If it is equal to 0 then rows are packed without padding.
+            \param [in] offset - an offset of the first pixel in the file. By default it is equal to 0.
+            \return a result of the operation.
+        */
+        bool Open(const std::string & path, size_t width, size_t height, typename View::Format format, size_t stride = 0, size_t offset = 0);
+
+        /*!
+            Unmaps the file. The previously returned image becomes invalid.
+        */
+        void Close();
+
+        /*!
+            Gets the image which points to the mapped pixels.
+
+            \return a reference to the image. It is empty if the file is not opened.
+        */
+        const View & Image() const;
+
+    private:
+        MappedImage(const MappedImage &);
+        MappedImage & operator = (const MappedImage &);
+
+        bool Map(const std::string & path);
+        bool ParsePnm();
+        bool ParseBmp();
+
+        uint8_t * _data;
+        size_t _size;
+        View _image;
+#if defined(_MSC_VER)
+        HANDLE _file, _mapping;
+#endif
+    };
+
+    /*! @ingroup cpp_mapped_image
+
+        \fn template <template<class> class A> bool OpenMappedImages(const std::vector<std::string> & paths, MappedImage<A> * images, size_t threads);
+
+        \short Maps a batch of image files in parallel.
+
+        \param [in] paths - a list of paths to image files (see Simd::MappedImage::Open).
+        \param [out] images - a pointer to array with MappedImage structures. Its size must be equal to size of paths.
+        \param [in] threads - a number of threads used to open files.
+        \return true if all files have been successfully opened.
+    */
+    template <template<class> class A> bool OpenMappedImages(const std::vector<std::string> & paths, MappedImage<A> * images, size_t threads);
+
+    //-------------------------------------------------------------------------
+
+    // struct MappedImage implementation:
+
+    template <template<class> class A> SIMD_INLINE MappedImage<A>::MappedImage()
+        : _data(NULL)
+        , _size(0)
+#if defined(_MSC_VER)
+        , _file(INVALID_HANDLE_VALUE)
+        , _mapping(NULL)
+#endif
+    {
+    }
+
+    template <template<class> class A> SIMD_INLINE MappedImage<A>::~MappedImage()
+    {
+        Close();
+    }
+
+    template <template<class> class A> SIMD_INLINE bool MappedImage<A>::Open(const std::string & path)
+    {
+        if (!Map(path))
+            return false;
+        if (_size > 2 && _data[0] == 'P' && (_data[1] == '5' || _data[1] == '6') && ParsePnm())
+            return true;
+        if (_size > 2 && _data[0] == 'B' && _data[1] == 'M' && ParseBmp())
+            return true;
+        Close();
+        return false;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool MappedImage<A>::Open(const std::string & path, size_t width, size_t height, typename View::Format format, size_t stride, size_t offset)
+    {
+        if (format == View::None || width == 0 || height == 0 || !Map(path))
+            return false;
+        size_t pixelSize = View::PixelSize(format);
+        if (offset > _size || width > (_size - offset) / pixelSize)
+        {
+            Close();
+            return false;
+        }
+        size_t rowSize = width * pixelSize;
+        if (stride == 0)
+            stride = rowSize;
+        if (stride < rowSize || height - 1 > (_size - offset - rowSize) / stride)
+        {
+            Close();
+            return false;
+        }
+        _image = View(width, height, stride, format, _data + offset);
+        return true;
+    }
+
+    template <template<class> class A> SIMD_INLINE void MappedImage<A>::Close()
+    {
+        _image = View();
+#if defined(_MSC_VER)
+        if (_data)
+            ::UnmapViewOfFile(_data);
+        if (_mapping)
+            ::CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE)
+            ::CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+        _mapping = NULL;
+#else
+        if (_data)
+            ::munmap(_data, _size);
+#endif
+        _data = NULL;
+        _size = 0;
+    }
+
+    template <template<class> class A> SIMD_INLINE const typename MappedImage<A>::View & MappedImage<A>::Image() const
+    {
+        return _image;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool MappedImage<A>::Map(const std::string & path)
+    {
+        Close();
+#if defined(_MSC_VER)
+        _file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (_file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if (::GetFileSizeEx(_file, &size) && size.QuadPart > 0)
+        {
+            _size = (size_t)size.QuadPart;
+            _mapping = ::CreateFileMappingA(_file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+            if (_mapping)
+                _data = (uint8_t*)::MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0);
+        }
+#else
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file == -1)
+            return false;
+        struct stat info;
+        if (::fstat(file, &info) == 0 && info.st_size > 0)
+        {
+            void * data = ::mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+            if (data != MAP_FAILED)
+            {
+                _data = (uint8_t*)data;
+                _size = (size_t)info.st_size;
+            }
+        }
+        ::close(file);
+#endif
+        if (_data == NULL)
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool MappedImage<A>::ParsePnm()
+    {
+        size_t values[3] = { 0, 0, 0 }, pos = 2;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (;;)
+            {
+                while (pos < _size && isspace(_data[pos]))
+                    pos++;
+                if (pos < _size && _data[pos] == '#')
+                {
+                    while (pos < _size && _data[pos] != '\n')
+                        pos++;
+                }
+                else
+                    break;
+            }
+            if (pos == _size || !isdigit(_data[pos]))
+                return false;
+            while (pos < _size && isdigit(_data[pos]))
+            {
+                values[i] = values[i] * 10 + (_data[pos++] - '0');
+                if (values[i] > _size)
+                    return false;
+            }
+        }
+        if (pos == _size || !isspace(_data[pos]) || values[2] != 255)
+            return false;
+        pos++;
+        typename View::Format format = _data[1] == '5' ? View::Gray8 : View::Rgb24;
+        if (values[0] == 0 || values[1] == 0 || values[0] > (_size - pos) / View::PixelSize(format))
+            return false;
+        size_t stride = values[0] * View::PixelSize(format);
+        if (values[1] > (_size - pos) / stride)
+            return false;
+        _image = View(values[0], values[1], stride, format, _data + pos);
+        return true;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool MappedImage<A>::ParseBmp()
+    {
+        struct Reader
+        {
+            static uint32_t Get(const uint8_t * p, size_t size)
+            {
+                uint32_t value = 0;
+                for (size_t i = 0; i < size; ++i)
+                    value |= uint32_t(p[i]) << (8 * i);
+                return value;
+            }
+        };
+        const size_t FILE_HEADER_SIZE = 14, INFO_HEADER_SIZE = 40;
+        if (_size < FILE_HEADER_SIZE + INFO_HEADER_SIZE)
+            return false;
+        const uint8_t * info = _data + FILE_HEADER_SIZE;
+        size_t offset = Reader::Get(_data + 10, 4);
+        size_t headerSize = Reader::Get(info + 0, 4);
+        int32_t width = (int32_t)Reader::Get(info + 4, 4);
+        int32_t height = (int32_t)Reader::Get(info + 8, 4);
+        size_t planes = Reader::Get(info + 12, 2);
+        size_t bitCount = Reader::Get(info + 14, 2);
+        size_t compression = Reader::Get(info + 16, 4);
+        if (headerSize < INFO_HEADER_SIZE || planes != 1 || compression != 0 || width <= 0 || height == 0)
+            return false;
+        typename View::Format format = View::None;
+        if (bitCount == 24)
+            format = View::Bgr24;
+        else if (bitCount == 32)
+            format = View::Bgra32;
+        else if (bitCount == 8)
+        {
+            size_t colors = Reader::Get(info + 32, 4);
+            const uint8_t * palette = info + headerSize;
+            if (colors != 0 && colors != 256)
+                return false;
+            if (headerSize > _size - FILE_HEADER_SIZE || 256 * 4 > _size - FILE_HEADER_SIZE - headerSize)
+                return false;
+            for (size_t i = 0; i < 256; ++i, palette += 4)
+                if (palette[0] != i || palette[1] != i || palette[2] != i)
+                    return false;
+            format = View::Gray8;
+        }
+        else
+            return false;
+        size_t w = width, h = height < 0 ? size_t(-int64_t(height)) : height;
+        size_t stride = (w * bitCount / 8 + 3) & ~size_t(3);
+        if (offset > _size || h > (_size - offset) / stride)
+            return false;
+        View image(w, h, stride, format, _data + offset);
+        _image = height < 0 ? image : image.Flipped();
+        return true;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool OpenMappedImages(const std::vector<std::string> & paths, MappedImage<A> * images, size_t threads)
+    {
+        std::vector<uint8_t> results(paths.size(), 0);
+        Simd::Parallel(0, paths.size(), [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                results[i] = images[i].Open(paths[i]) ? 1 : 0;
+        }, threads);
+        for (size_t i = 0; i < results.size(); ++i)
+            if (!results[i])
+                return false;
+        return true;
+    }
+}
+
+#endif//__SimdMappedImage_hpp__
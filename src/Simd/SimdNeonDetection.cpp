@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdDetection.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -335,6 +336,8 @@ namespace Simd
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
         {
             const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            if (hid.isAdaptiveStep)
+                return Base::DetectionHaarDetect32fi(_hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
             return DetectionHaarDetect32fi(hid,
                 Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
                 Rect(left, top, right, bottom),
@@ -767,6 +770,8 @@ namespace Simd
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
         {
             const HidLbpCascade<int, short> & hid = *(HidLbpCascade<int, short>*)_hid;
+            if (hid.isAdaptiveStep)
+                return Base::DetectionLbpDetect16ii(_hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
             return DetectionLbpDetect16ii(hid,
                 Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
                 Rect(left, top, right, bottom),
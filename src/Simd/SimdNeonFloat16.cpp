@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -454,6 +455,34 @@ namespace Simd
                 }
             }
         }
+
+        static size_t CosineSelect32f(const float * src, size_t size, float threshold, uint32_t * indices)
+        {
+            size_t sizeF = AlignLo(size, F), count = 0, i = 0;
+            float32x4_t _threshold = vdupq_n_f32(threshold);
+            for (; i < sizeF; i += F)
+            {
+                if (TestZ(vcleq_f32(Load<false>(src + i), _threshold)))
+                    continue;
+                for (size_t k = i; k < i + F; ++k)
+                    if (src[k] <= threshold)
+                        indices[count++] = (uint32_t)k;
+            }
+            for (; i < size; ++i)
+                if (src[i] <= threshold)
+                    indices[count++] = (uint32_t)i;
+            return count;
+        }
+
+        void SquareSums16f(size_t N, size_t K, const uint16_t * A, float * sums)
+        {
+            Base::SquareSums16f(N, K, A, sums, Squares);
+        }
+
+        void CosineDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances)
+        {
+            Base::CosineDistancesTopK16f(M, N, K, A, B, bSquares, topK, indices, distances, Squares, MacroCosineDistances, CosineSelect32f);
+        }
     }
 #endif // defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
 }
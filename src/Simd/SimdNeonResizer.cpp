@@ -124,8 +124,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            SetBuffer(size, 2);
 }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const uint8_t * alpha, uint8_t * buffer);
@@ -197,7 +196,7 @@ namespace Simd
             Store<false>(dst, PackU16(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -207,7 +206,7 @@ namespace Simd
             const size_t step = A * N;
             ptrdiff_t previous = -2;
             uint16x8_t a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
@@ -280,7 +279,7 @@ namespace Simd
 
 //#define MERGE_LOADING_AND_INTERPOLATION
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -288,7 +287,7 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             uint16x8_t a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
@@ -336,22 +335,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1:
                 if (_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, dst, dstStride, buffer);
                 else
-                    Run<1>(src, srcStride, dst, dstStride);
+                    Run<1>(src, srcStride, dst, dstStride, buffer);
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); break;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); break;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); break;
             default:
                 assert(0);
             }
@@ -361,7 +359,7 @@ namespace Simd
         ResizerByteArea::ResizerByteArea(const ResParam & param)
             : Base::ResizerByteArea(param)
         {
-            _by.Resize(AlignHi(_param.srcW*_param.channels, _param.align), false, _param.align);
+            SetBuffer(AlignHi(_param.srcW*_param.channels, _param.align) * sizeof(int32_t), 1);
         }
 
         template<UpdateType update> SIMD_INLINE void ResizerByteAreaRowUpdate(const uint8_t * src0, size_t size, int32_t a0, int32_t * dst)
@@ -462,14 +460,14 @@ namespace Simd
             ResizerByteAreaResult34<3>(src, count, curr, zero, next, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = (int32_t*)buffer;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -480,14 +478,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, buffer); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); return;
             default:
                 assert(0);
             }
@@ -500,11 +498,11 @@ namespace Simd
         {
         }
 
-        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride) 
+        void ResizerFloatBilinear::Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const
         {
             size_t cn = _param.channels;
             size_t rs = _param.dstW * cn;
-            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            float * pbx[2] = { buffer, buffer + _rowSize / sizeof(float) };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, F);
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
@@ -579,7 +577,11 @@ namespace Simd
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(float32x4_t));
             if (param.IsByteBilinear() && dstX >= A)
-                return new ResizerByteBilinear(param);
+            {
+                ResizerByteBilinear * resizer = new ResizerByteBilinear(param);
+                resizer->EstimateParams();
+                return resizer;
+            }
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
@@ -86,6 +86,68 @@ namespace Simd
             *sum = ExtractSum64u(_sum);
         }
 
+        template <int n> void SquaredDifferenceSums1xN(const uint8_t * a, const uint8_t * b, size_t bStride, size_t K, uint32_t threshold, uint32_t * sums)
+        {
+            const size_t KB = 256, K16 = AlignLo(K, 16);
+            uint32x4_t _sums[n];
+            for (int j = 0; j < n; ++j)
+                _sums[j] = vdupq_n_u32(0);
+            for (size_t kb = 0; kb < K16; kb += KB)
+            {
+                for (size_t k = kb, ke = Simd::Min(kb + KB, K16); k < ke; k += 16)
+                {
+                    const uint8x16_t _a = vld1q_u8(a + k);
+                    for (int j = 0; j < n; ++j)
+                        _sums[j] = vaddq_u32(_sums[j], SquaredDifferenceSum(_a, vld1q_u8(b + j*bStride + k)));
+                }
+                if (threshold != UINT32_MAX && kb + KB < K)
+                {
+                    int exceeded = 0;
+                    for (int j = 0; j < n; ++j)
+                        exceeded += ExtractSum32u(_sums[j]) > threshold ? 1 : 0;
+                    if (exceeded == n)
+                    {
+                        for (int j = 0; j < n; ++j)
+                            sums[j] = UINT32_MAX;
+                        return;
+                    }
+                }
+            }
+            for (int j = 0; j < n; ++j)
+            {
+                uint32_t sum = ExtractSum32u(_sums[j]);
+                for (size_t k = K16; k < K; ++k)
+                    sum += Base::SquaredDifference(a[k], b[j*bStride + k]);
+                sums[j] = sum > threshold ? UINT32_MAX : sum;
+            }
+        }
+
+        static void SquaredDifferenceSumsMxN(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums, size_t sumsStride)
+        {
+            size_t N4 = AlignLo(N, 4);
+            for (size_t i = 0; i < M; ++i)
+            {
+                const uint8_t * a = A + i*aStride;
+                uint32_t * s = sums + i*sumsStride;
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    SquaredDifferenceSums1xN<4>(a, B + j*bStride, bStride, K, threshold, s + j);
+                switch (N - N4)
+                {
+                case 1: SquaredDifferenceSums1xN<1>(a, B + j*bStride, bStride, K, threshold, s + j); break;
+                case 2: SquaredDifferenceSums1xN<2>(a, B + j*bStride, bStride, K, threshold, s + j); break;
+                case 3: SquaredDifferenceSums1xN<3>(a, B + j*bStride, bStride, K, threshold, s + j); break;
+                }
+            }
+        }
+
+        void SquaredDifferenceSumsMxN8u(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+            const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums)
+        {
+            Base::SquaredDifferenceSumsMxN8u(M, N, K, A, aStride, B, bStride, threshold, sums, SquaredDifferenceSumsMxN);
+        }
+
         void SquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
         {
             if (Aligned(a) && Aligned(aStride) && Aligned(b) && Aligned(bStride))
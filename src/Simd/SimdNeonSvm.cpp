@@ -24,6 +24,9 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdNeon.h"
 
 namespace Simd
 {
@@ -86,6 +89,63 @@ namespace Simd
             for (; i < count; ++i)
                 *sum += buffer.sums[i] * weights[i];
         }
+
+        //---------------------------------------------------------------------
+
+        SvmKernel::SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights)
+            : Base::SvmKernel(param, svs, weights)
+        {
+            _gemm = Neon::Gemm32fNN;
+        }
+
+        void SvmKernel::Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const
+        {
+            const SvmKernelParam & p = _param;
+            size_t count4 = AlignLo(count, 4);
+            Exp exp(-p.gamma);
+            float32x4_t gamma = vdupq_n_f32(p.gamma), coef0 = vdupq_n_f32(p.coef0), _2 = vdupq_n_f32(2.0f), _0 = vdupq_n_f32(0.0f);
+            for (size_t b = 0; b < batch; ++b, dot += count)
+            {
+                float32x4_t _sum = vdupq_n_f32(0.0f);
+                size_t c = 0;
+                if (p.type == SimdSvmKernelLinear)
+                {
+                    for (; c < count4; c += 4)
+                        _sum = vmlaq_f32(_sum, Load<false>(weights + c), Load<false>(dot + c));
+                }
+                else if (p.type == SimdSvmKernelPolynomial)
+                {
+                    for (; c < count4; c += 4)
+                    {
+                        float32x4_t value = vmlaq_f32(coef0, gamma, Load<false>(dot + c)), kernel = value;
+                        for (int i = 1; i < p.degree; ++i)
+                            kernel = vmulq_f32(kernel, value);
+                        _sum = vmlaq_f32(_sum, Load<false>(weights + c), kernel);
+                    }
+                }
+                else
+                {
+                    float32x4_t norm = vdupq_n_f32(norms[b]);
+                    for (; c < count4; c += 4)
+                    {
+                        float32x4_t distance = vmlsq_f32(vaddq_f32(norm, Load<false>(svNorms + c)), _2, Load<false>(dot + c));
+                        _sum = vmlaq_f32(_sum, Load<false>(weights + c), exp.Exponent(vmaxq_f32(distance, _0)));
+                    }
+                }
+                float s = ExtractSum32f(_sum);
+                for (; c < count; ++c)
+                    s += weights[c] * Base::SvmKernelValue(p, dot[c], norms[b], svNorms[c]);
+                sum[b] += s;
+            }
+        }
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree)
+        {
+            SvmKernelParam param(length, count, type, gamma, coef0, degree);
+            if (!param.Valid())
+                return NULL;
+            return new Neon::SvmKernel(param, svs, weights);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
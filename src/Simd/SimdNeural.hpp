@@ -496,6 +496,18 @@ namespace Simd
                 Train, /*!< \brief Forward propagation in train process.*/
             };
 
+            /*!
+                \enum Compression
+
+                Describes compression of weights of the network layer (it is used only for prediction).
+            */
+            enum Compression
+            {
+                CompressionNone, /*!< \brief Weights are stored as 32-bit float point values. */
+                CompressionFloat16, /*!< \brief Weights are stored as 16-bit float point values (relative error of each weight is not greater than 2^-11). */
+                CompressionInt8, /*!< \brief Weights are stored as 8-bit integers with scale per output channel (absolute error of each weight is not greater than max|w|/254 of its channel). */
+            };
+
             /*!
                 Virtual destructor.
             */
@@ -507,6 +519,20 @@ namespace Simd
 
             virtual void Backward(const Vector & src, size_t thread) = 0;
 
+            virtual void ForwardBatch(const Vector & src, size_t batch, size_t thread)
+            {
+                const size_t srcSize = _src.Volume(), dstSize = _dst.Volume();
+                Vector sample(srcSize);
+                Vector & dst = _common[thread].batchDst;
+                dst.resize(batch * dstSize);
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    memcpy(sample.data(), src.data() + b * srcSize, srcSize * sizeof(float));
+                    Forward(sample, thread, Fast);
+                    memcpy(dst.data() + b * dstSize, _common[thread].dst.data(), dstSize * sizeof(float));
+                }
+            }
+
             virtual size_t FanSrc() const = 0;
 
             virtual size_t FanDst() const = 0;
@@ -538,7 +564,64 @@ namespace Simd
                 , _function(f)
                 , _prev(0)
                 , _next(0)
+                , _compression(CompressionNone)
+            {
+            }
+
+            static SIMD_INLINE size_t WeightBufferMax() { return 0x4000; }
+
+            virtual void Compress(Compression)
+            {
+            }
+
+            void CompressWeight(Compression compression, size_t rows)
+            {
+                if (compression == CompressionNone || _compression != CompressionNone || _weight.empty())
+                    return;
+                const size_t size = _weight.size() / rows;
+                if (compression == CompressionFloat16)
+                {
+                    _weight16.resize(_weight.size());
+                    ::SimdFloat32ToFloat16(_weight.data(), _weight.size(), _weight16.data());
+                }
+                else
+                {
+                    Vector scale(rows), shift(rows, 128.0f);
+                    _scale.resize(rows);
+                    _shift.resize(rows);
+                    for (size_t r = 0; r < rows; ++r)
+                    {
+                        float max = 0;
+                        for (size_t i = 0; i < size; ++i)
+                            max = std::max(max, _weight[r * size + i] < 0 ? -_weight[r * size + i] : _weight[r * size + i]);
+                        scale[r] = max > 0 ? 127.0f / max : 0.0f;
+                        _scale[r] = max / 127.0f;
+                        _shift[r] = -128.0f * _scale[r];
+                    }
+                    _weight8.resize(_weight.size());
+                    ::SimdSynetConvert32fTo8u(_weight.data(), 1, rows, 1, size, SimdTensorFormatNchw, 
+                        scale.data(), shift.data(), _weight8.data(), SimdSynetCompatibilityFmaUse);
+                }
+                _compression = compression;
+                Vector().swap(_weight);
+            }
+
+            SIMD_INLINE size_t WeightRows(size_t size, size_t rows) const
+            {
+                return _compression == CompressionNone ? rows : std::max<size_t>(1, std::min<size_t>(rows, WeightBufferMax() / size));
+            }
+
+            const float * Weight(size_t row, size_t count, size_t size, Vector & buffer) const
             {
+                if (_compression == CompressionNone)
+                    return _weight.data() + row * size;
+                buffer.resize(count * size);
+                if (_compression == CompressionFloat16)
+                    ::SimdFloat16ToFloat32(_weight16.data() + row * size, count * size, buffer.data());
+                else
+                    ::SimdSynetConvert8uTo32f(_weight8.data() + row * size, 1, count, 1, size, SimdTensorFormatNchw, 
+                        _scale.data() + row, _shift.data() + row, buffer.data(), SimdSynetCompatibilityFmaUse);
+                return buffer.data();
             }
 
             SIMD_INLINE bool Link(Layer * prev)
@@ -563,6 +646,26 @@ namespace Simd
                 return _common[thread].prevDelta;
             }
 
+            SIMD_INLINE const Vector & DstBatch(size_t thread) const
+            {
+                return _common[thread].batchDst;
+            }
+
+            void ActivateBatch(size_t batch, size_t thread)
+            {
+                const Vector & sum = _common[thread].batchSum;
+                Vector & dst = _common[thread].batchDst;
+                size_t size = _dst.Volume();
+                dst.resize(batch * size);
+                if (_function.type == Function::Softmax)
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                        _function.function(sum.data() + b * size, size, dst.data() + b * size);
+                }
+                else
+                    _function.function(sum.data(), batch * size, dst.data());
+            }
+
             const Type _type;
             const Function _function;
 
@@ -571,11 +674,18 @@ namespace Simd
             Index _src, _dst;
             Vector _weight, _bias, _gWeight, _gBias;
 
+            Compression _compression;
+            std::vector<uint16_t, Allocator<uint16_t>> _weight16;
+            Buffer _weight8;
+            Vector _scale, _shift;
+
             struct Common
             {
-                Vector sum, dst;
+                Vector sum, dst, weight;
 
                 Vector dWeight, dBias, prevDelta;
+
+                Vector batchSum, batchDst;
             };
             std::vector<Common> _common;
 
@@ -605,6 +715,11 @@ namespace Simd
                 _common[thread].dst = src;
             }
 
+            void ForwardBatch(const Vector & src, size_t batch, size_t thread) override
+            {
+                _common[thread].batchDst.assign(src.begin(), src.begin() + batch * _dst.Volume());
+            }
+
             void Backward(const Vector & src, size_t thread) override
             {
             }
@@ -712,14 +827,16 @@ namespace Simd
                 if (_partial)
                 {
                     Detail::SetZero(sum);
+                    const size_t size = _core.Volume() / _dst.depth, area = _core.width*_core.height;
                     for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
                     {
+                        const float * weight = Weight(dc, 1, size, _common[thread].weight);
                         for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
                         {
                             if (!_connection.At<bool>(dc, sc))
                                 return;
 
-                            const float * pweight = _core.Get(_weight, 0, 0, _src.depth*dc + sc);
+                            const float * pweight = weight + sc * area;
                             const float * psrc = _padded.Get(padded, 0, 0, sc);
                             float * psum = _dst.Get(sum, 0, 0, dc);
 
@@ -749,11 +866,16 @@ namespace Simd
                 else
                 {
                     Buffer & buffer = _specific[thread].buffer;
-                    size_t size = buffer.size();
-                    ::SimdNeuralConvolutionForward(padded.data(), _padded.width, _padded.height, _padded.depth, _weight.data(),
-                        _core.width, _core.height, 0, 0, 1, 1, 1, 1, buffer.data(), &size, sum.data(), _dst.width, _dst.height, _dst.depth, 0);
-                    if (size > buffer.size())
-                        buffer.resize(size);
+                    const size_t kernel = _core.Volume() / _dst.depth, step = WeightRows(kernel, _dst.depth);
+                    for (size_t dc = 0; dc < (size_t)_dst.depth; dc += step)
+                    {
+                        size_t count = std::min<size_t>(_dst.depth, dc + step) - dc, size = buffer.size();
+                        const float * weight = Weight(dc, count, kernel, _common[thread].weight);
+                        ::SimdNeuralConvolutionForward(padded.data(), _padded.width, _padded.height, _padded.depth, weight,
+                            _core.width, _core.height, 0, 0, 1, 1, 1, 1, buffer.data(), &size, _dst.Get(sum, 0, 0, dc), _dst.width, _dst.height, count, 0);
+                        if (size > buffer.size())
+                            buffer.resize(size);
+                    }
                 }
                 for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
                 {
@@ -763,6 +885,48 @@ namespace Simd
                 _function.function(sum.data(), sum.size(), dst.data());
             }
 
+            void ForwardBatch(const Vector & src, size_t batch, size_t thread) override
+            {
+                if (_partial)
+                {
+                    Layer::ForwardBatch(src, batch, thread);
+                    return;
+                }
+                const size_t BUFFER_MAX = 0x40000;
+                const size_t srcSize = _src.Volume(), dstSize = _dst.Volume(), area = _dst.Area(), kernel = _core.Volume() / _dst.depth;
+                const size_t step = std::max<size_t>(1, std::min<size_t>(batch, BUFFER_MAX / (kernel * area))), rows = WeightRows(kernel, _dst.depth);
+                const float one = 1.0f, zero = 0.0f;
+                Specific & specific = _specific[thread];
+                specific.columns.resize(kernel * step * area);
+                specific.product.resize(_dst.depth * step * area);
+                Vector & sum = _common[thread].batchSum;
+                sum.resize(batch * dstSize);
+                for (size_t b = 0; b < batch; b += step)
+                {
+                    size_t count = std::min(batch, b + step) - b, width = count * area;
+                    for (size_t s = 0; s < count; ++s)
+                        ImgToCol(src.data() + (b + s) * srcSize, specific.columns.data() + s * area, width);
+                    if (_bias.size())
+                    {
+                        for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                            ::SimdFill32f(specific.product.data() + dc * width, width, _bias.data() + dc);
+                    }
+                    for (size_t dc = 0; dc < (size_t)_dst.depth; dc += rows)
+                    {
+                        size_t count = std::min<size_t>(_dst.depth, dc + rows) - dc;
+                        const float * weight = Weight(dc, count, kernel, _common[thread].weight);
+                        ::SimdGemm32fNN(count, width, kernel, &one, weight, kernel, specific.columns.data(), width, 
+                            _bias.size() ? &one : &zero, specific.product.data() + dc * width, width);
+                    }
+                    for (size_t s = 0; s < count; ++s)
+                    {
+                        for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                            memcpy(sum.data() + (b + s) * dstSize + dc * area, specific.product.data() + dc * width + s * area, area * sizeof(float));
+                    }
+                }
+                ActivateBatch(batch, thread);
+            }
+
             void Backward(const Vector & currDelta, size_t thread) override
             {
                 const Vector & prevDst = _valid ? _prev->Dst(thread) : _specific[thread].paddedSrc;
@@ -866,6 +1030,11 @@ namespace Simd
                 return _core.width*_core.height*_dst.depth;
             }
 
+            void Compress(Compression compression) override
+            {
+                CompressWeight(compression, _dst.depth);
+            }
+
             virtual void SetThreadNumber(size_t number, bool train) override
             {
                 Layer::SetThreadNumber(number, train);
@@ -900,6 +1069,40 @@ namespace Simd
                 }
             }
 
+            void ImgToCol(const float * src, float * dst, size_t stride) const
+            {
+                const ptrdiff_t indentX = _valid ? 0 : _indent.x, indentY = _valid ? 0 : _indent.y;
+                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                {
+                    for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                    {
+                        for (ptrdiff_t kx = 0; kx < _core.width; ++kx, dst += stride)
+                        {
+                            ptrdiff_t x0 = std::max<ptrdiff_t>(0, indentX - kx);
+                            ptrdiff_t x1 = std::max(x0, std::min(_dst.width, _src.width + indentX - kx));
+                            for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                            {
+                                float * pd = dst + y * _dst.width;
+                                ptrdiff_t sy = y + ky - indentY;
+                                if (sy < 0 || sy >= _src.height)
+                                {
+                                    memset(pd, 0, _dst.width * sizeof(float));
+                                    continue;
+                                }
+                                const float * ps = src + _src.Offset(kx - indentX, sy, sc);
+                                ptrdiff_t x = 0;
+                                for (; x < x0; ++x)
+                                    pd[x] = 0.0f;
+                                for (; x < x1; ++x)
+                                    pd[x] = ps[x];
+                                for (; x < _dst.width; ++x)
+                                    pd[x] = 0.0f;
+                            }
+                        }
+                    }
+                }
+            }
+
             void UnpadDelta(const Vector & src, size_t thread)
             {
                 if (!_valid)
@@ -918,6 +1121,7 @@ namespace Simd
             {
                 Vector paddedSrc, paddedDelta;
                 Buffer buffer;
+                Vector columns, product;
             };
             std::vector<Specific> _specific;
 
@@ -1209,23 +1413,17 @@ namespace Simd
                 Vector & sum = _common[thread].sum;
                 Vector & dst = _common[thread].dst;
 
-                if (method == Layer::Fast)
+                if (method == Layer::Fast || _compression != CompressionNone)
                 {
-                    if (!_reordered)
+                    Reorder();
+                    const size_t step = WeightRows(_src.width, _dst.width);
+                    for (size_t i = 0; i < sum.size(); i += step)
                     {
-                        std::lock_guard<std::mutex> lock(_mutex);
-                        if (!_reordered)
-                        {
-                            Vector buffer(_weight.size());
-                            for (ptrdiff_t i = 0; i < _dst.width; ++i)
-                                for (ptrdiff_t j = 0; j < _src.width; ++j)
-                                    buffer[i*_src.width + j] = _weight[j*_dst.width + i];
-                            _weight.swap(buffer);
-                            _reordered = true;                        
-                        }
+                        size_t count = std::min(sum.size(), i + step) - i;
+                        const float * weight = Weight(i, count, _src.width, _common[thread].weight);
+                        for (size_t j = 0; j < count; ++j)
+                            ::SimdNeuralProductSum(src.data(), weight + j * _src.width, src.size(), &sum[i + j]);
                     }
-                    for (size_t i = 0; i < sum.size(); ++i)
-                        ::SimdNeuralProductSum(src.data(), &_weight[i*_src.width], src.size(), &sum[i]);
                 }
                 else
                 {
@@ -1240,6 +1438,27 @@ namespace Simd
                 _function.function(sum.data(), sum.size(), dst.data());
             }
 
+            void ForwardBatch(const Vector & src, size_t batch, size_t thread) override
+            {
+                Vector & sum = _common[thread].batchSum;
+                sum.resize(batch * _dst.width);
+                const float one = 1.0f, zero = 0.0f;
+                Reorder();
+                const size_t step = WeightRows(_src.width, _dst.width);
+                for (size_t i = 0; i < (size_t)_dst.width; i += step)
+                {
+                    size_t count = std::min<size_t>(_dst.width, i + step) - i;
+                    const float * weight = Weight(i, count, _src.width, _common[thread].weight);
+                    ::SimdGemm32fNT(batch, count, _src.width, &one, src.data(), _src.width, weight, _src.width, &zero, sum.data() + i, _dst.width);
+                }
+                if (_bias.size())
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                        ::SimdNeuralAddVector(_bias.data(), _dst.width, sum.data() + b * _dst.width);
+                }
+                ActivateBatch(batch, thread);
+            }
+
             void Backward(const Vector & currDelta, size_t thread) override
             {
                 const Vector & prevDst = _prev->Dst(thread);
@@ -1272,6 +1491,29 @@ namespace Simd
         protected:
             bool _reordered;
             std::mutex _mutex;
+
+            void Compress(Compression compression) override
+            {
+                Reorder();
+                CompressWeight(compression, _dst.width);
+            }
+
+            void Reorder()
+            {
+                if (!_reordered)
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (!_reordered)
+                    {
+                        Vector buffer(_weight.size());
+                        for (ptrdiff_t i = 0; i < _dst.width; ++i)
+                            for (ptrdiff_t j = 0; j < _src.width; ++j)
+                                buffer[i*_src.width + j] = _weight[j*_dst.width + i];
+                        _weight.swap(buffer);
+                        _reordered = true;
+                    }
+                }
+            }
         };
 
         /*! @ingroup cpp_neural
@@ -1602,7 +1844,7 @@ namespace Simd
             {
                 SIMD_CHECK_PERFORMANCE();
 
-                if (src.size() != dst.size())
+                if (src.size() != dst.size() || Compressed())
                     return false;
 
                 options.threadNumber = std::max<size_t>(1, std::min<size_t>(options.threadNumber, std::thread::hardware_concurrency()));
@@ -1667,6 +1909,79 @@ namespace Simd
                 return Forward(x, thread, method);
             }
 
+            /*!
+                \short Classifies a batch of samples.
+
+                Samples are stored contiguously with layout [batch x InputIndex().Volume()].
+                Convolutional and fully connected layers process the whole batch with matrix multiplication (::SimdGemm32fNN, ::SimdGemm32fNT).
+
+                \param [in] src - a batch of input samples.
+                \param [in] batch - a number of samples in the batch.
+                \param [out] dst - results of classification with layout [batch x OutputIndex().Volume()].
+                \param [in] thread - a work thread number. By default it is equal to 0.
+            */
+            void Predict(const Vector & src, size_t batch, Vector & dst, size_t thread = 0)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                assert(src.size() >= batch * InputIndex().Volume());
+                _layers.front()->ForwardBatch(src, batch, thread);
+                for (size_t i = 1; i < _layers.size(); ++i)
+                    _layers[i]->ForwardBatch(_layers[i - 1]->DstBatch(thread), batch, thread);
+                const Vector & output = _layers.back()->DstBatch(thread);
+                dst.assign(output.begin(), output.begin() + batch * OutputIndex().Volume());
+            }
+
+            /*!
+                \short Classifies given samples as one batch.
+
+                \param [in] src - a set of input samples.
+                \param [out] dst - a set of results of classification (vectors with predicted probabilities).
+                \param [in] thread - a work thread number. By default it is equal to 0.
+            */
+            void Predict(const Vectors & src, Vectors & dst, size_t thread = 0)
+            {
+                const size_t srcSize = InputIndex().Volume(), dstSize = OutputIndex().Volume();
+                Vector batch(src.size() * srcSize), output;
+                for (size_t b = 0; b < src.size(); ++b)
+                    memcpy(batch.data() + b * srcSize, src[b].data(), srcSize * sizeof(float));
+                Predict(batch, src.size(), output, thread);
+                dst.resize(src.size());
+                for (size_t b = 0; b < src.size(); ++b)
+                    dst[b].assign(output.begin() + b * dstSize, output.begin() + (b + 1) * dstSize);
+            }
+
+            /*!
+                \short Compresses weights of convolutional and fully connected layers of the neural network.
+
+                Weights are stored as 16-bit float point values or as 8-bit integers with scale per output channel 
+                (see Layer::Compression for accuracy bounds) and are decompressed by small blocks in a per-thread buffer during prediction.
+
+                \note Compression is irreversible: the compressed network can be used only for prediction. Methods Load, Save and Train return false for it.
+
+                \param [in] compression - a type of compression.
+                \return a result of compression.
+            */
+            bool Compress(Layer::Compression compression)
+            {
+                if (_layers.empty() || Compressed())
+                    return false;
+                for (size_t i = 0; i < _layers.size(); ++i)
+                    _layers[i]->Compress(compression);
+                return true;
+            }
+
+            /*!
+                \short Returns true if the weights of the neural network are compressed.
+            */
+            bool Compressed() const
+            {
+                for (size_t i = 0; i < _layers.size(); ++i)
+                    if (_layers[i]->_compression != Layer::CompressionNone)
+                        return true;
+                return false;
+            }
+
             /*!
                 \short Loads the weights of neural network from an external buffer.
 
@@ -1679,7 +1994,7 @@ namespace Simd
             */
             bool Load(const void * data, size_t size, bool train = false)
             {
-                if (Requred(train) > size)
+                if (Compressed() || Requred(train) > size)
                     return false;
                 typedef  Vector::value_type Type;
                 Type * ptr = (Type*)data;
@@ -1723,6 +2038,8 @@ namespace Simd
             {
                 SIMD_CHECK_PERFORMANCE();
 
+                if (Compressed())
+                    return false;
                 if (train)
                 {
                     for (size_t i = 0; i < _layers.size(); ++i)
@@ -1781,6 +2098,8 @@ namespace Simd
             */
             bool Save(void * data, size_t * size, bool train = false) const
             {
+                if (Compressed())
+                    return false;
                 typedef  Vector::value_type Type;
                 Type * ptr = (Type*)data;
                 size_t requred = Requred(train);
@@ -1823,6 +2142,8 @@ namespace Simd
             */
             bool Save(std::ostream & os, bool train = false) const
             {
+                if (Compressed())
+                    return false;
                 for (size_t i = 0; i < _layers.size(); ++i)
                 {
                     const Layer & layer = *_layers[i];
@@ -2014,23 +2335,43 @@ namespace Simd
                 }
             }
 
+            void ReduceGradient(const TrainOptions & options)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                const size_t threadNumber = _layers.front()->_common.size();
+                for (size_t step = 1; step < threadNumber; step *= 2)
+                {
+                    size_t pairs = (threadNumber - step + 2 * step - 1) / (2 * step);
+                    Parallel(0, pairs, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t p = begin; p < end; ++p)
+                        {
+                            size_t dst = p * 2 * step, src = dst + step;
+                            for (size_t l = 0; l < _layers.size(); ++l)
+                            {
+                                Layer::Common & d = _layers[l]->_common[dst];
+                                Layer::Common & s = _layers[l]->_common[src];
+                                ::SimdNeuralAddVector(s.dWeight.data(), s.dWeight.size(), d.dWeight.data());
+                                ::SimdNeuralAddVector(s.dBias.data(), s.dBias.size(), d.dBias.data());
+                                Detail::SetZero(s.dWeight);
+                                Detail::SetZero(s.dBias);
+                            }
+                        }
+                    }, options.threadNumber);
+                }
+            }
+
             template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & options)
             {
+                ReduceGradient(options);
                 for (size_t l = 0; l < _layers.size(); ++l)
                 {
                     Layer & layer = *_layers[l];
-                    for (size_t t = 1; t < layer._common.size(); ++t)
-                    {
-                        ::SimdNeuralAddVector(layer._common[t].dWeight.data(), layer._common[t].dWeight.size(), layer._common[0].dWeight.data());
-                        ::SimdNeuralAddVector(layer._common[t].dBias.data(), layer._common[t].dBias.size(), layer._common[0].dBias.data());
-                    }
                     Detail::UpdateWeight<type>(options, layer._common[0].dWeight, layer._gWeight, layer._weight);
                     Detail::UpdateWeight<type>(options, layer._common[0].dBias, layer._gBias, layer._bias);
-                    for (size_t t = 0; t < layer._common.size(); ++t)
-                    {
-                        Detail::SetZero(layer._common[t].dWeight);
-                        Detail::SetZero(layer._common[t].dBias);
-                    }
+                    Detail::SetZero(layer._common[0].dWeight);
+                    Detail::SetZero(layer._common[0].dBias);
                 }
             }
 
@@ -27,6 +27,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 
+#include <memory>
+
 namespace Simd
 {
     struct ResParam
@@ -69,13 +71,72 @@ namespace Simd
     public:
         Resizer(const ResParam & param)
             : _param(param)
+            , _rowSize(0)
+            , _rowCount(0)
+        {
+        }
+
+        const ResParam & Param() const
+        {
+            return _param;
+        }
+
+        size_t BufferSize() const
         {
+            return _rowSize * _rowCount;
         }
 
-        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const = 0;
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) const
+        {
+            if (_buffer.size < BufferSize())
+                _buffer.Resize(BufferSize(), false, _param.align);
+            Run(src, srcStride, dst, dstStride, _buffer.data);
+        }
 
     protected:
         ResParam _param;
+        size_t _rowSize, _rowCount;
+        mutable Array8u _buffer;
+
+        void SetBuffer(size_t rowSize, size_t rowCount)
+        {
+            _rowSize = AlignHi(rowSize, _param.align);
+            _rowCount = rowCount;
+        }
+    };
+
+    typedef std::shared_ptr<Resizer> ResizerPtr;
+
+    class ResizerShared : public Resizer
+    {
+    public:
+        ResizerShared(const ResizerPtr & resizer)
+            : Resizer(resizer->Param())
+            , _resizer(resizer)
+        {
+            SetBuffer(resizer->BufferSize(), 1);
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
+        {
+            _resizer->Run(src, srcStride, dst, dstStride, buffer);
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) const
+        {
+            Array8u buffer(BufferSize(), false, _param.align);
+            Run(src, srcStride, dst, dstStride, buffer.data);
+        }
+
+        const Resizer * Shared() const
+        {
+            return _resizer.get();
+        }
+
+    private:
+        ResizerPtr _resizer;
     };
 
     namespace Base
@@ -83,13 +144,15 @@ namespace Simd
         class ResizerByteBilinear : public Resizer
         {
         protected:
-            Array32i _ax, _ix, _ay, _iy, _bx[2];
+            Array32i _ax, _ix, _ay, _iy;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas);
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void EstimateParams();
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         const int32_t AREA_SHIFT = 22;
@@ -101,32 +164,36 @@ namespace Simd
         protected:
             Array32i _ax, _ix, _ay, _iy;
 
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) const;
         public:
             ResizerByteArea(const ResParam & param);
 
             void EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t * alpha, int32_t * index);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerFloatBilinear : public Resizer
         {
         protected:
             Array32i _ix, _iy;
-            Array32f _ax, _ay, _bx[2];
+            Array32f _ax, _ay;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
 
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const;
 
         public:
             ResizerFloatBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        typedef void * (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerInitShared(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, ResizerInitPtr init);
     }
 
 #ifdef SIMD_SSE_ENABLE    
@@ -134,7 +201,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const;
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -150,26 +217,24 @@ namespace Simd
         {
         protected:
             Array16i _ax;
-            Array8u _bx[2];
 
-            void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void EstimateParams();
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerByteArea : public Base::ResizerByteArea
         {
         protected:
-            Array32i _by;
-
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteArea(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -192,13 +257,14 @@ namespace Simd
             Array<Idx> _ixg;
 
             size_t BlockCountMax(size_t align);
-            void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void EstimateParams();
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -211,11 +277,11 @@ namespace Simd
         class ResizerByteArea : public Sse2::ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteArea(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -227,7 +293,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const;
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -257,28 +323,29 @@ namespace Simd
             };
             Array<Idx> _ixg;
 
-            void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void EstimateParams();
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerByteArea : public Sse41::ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteArea(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const;
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -292,7 +359,7 @@ namespace Simd
     {
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const;
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -307,22 +374,22 @@ namespace Simd
         class ResizerByteBilinear : public Avx2::ResizerByteBilinear
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerByteArea : public Avx2::ResizerByteArea
         {
         protected:
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteArea(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -335,7 +402,7 @@ namespace Simd
         class ResizerByteBilinear : public Base::ResizerByteBilinear
         {
         protected:
-            Array8u _ax, _bx[2];
+            Array8u _ax;
             size_t _blocks;
             struct Idx
             {
@@ -345,30 +412,29 @@ namespace Simd
             Array<Idx> _ixg;
 
             size_t BlockCountMax(size_t align);
-            void EstimateParams();
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
-            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
+            void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteBilinear(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void EstimateParams();
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerByteArea : public Base::ResizerByteArea
         {
         protected:
-            Array32i _by;
-
-            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         public:
             ResizerByteArea(const ResParam & param);
 
-            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const;
         };
 
         class ResizerFloatBilinear : public Base::ResizerFloatBilinear
         {
-            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride, float * buffer) const;
         public:
             ResizerFloatBilinear(const ResParam & param);
         };
@@ -42,6 +42,11 @@ namespace Simd
             return _mm_unpacklo_epi16(_mm_set1_epi16(a0), _mm_set1_epi16(a1));
         }
 
+        template <int a0, int a1> SIMD_INLINE __m128i SetInt16()
+        {
+            return _mm_set1_epi32(int(uint32_t(uint16_t(a0)) | (uint32_t(uint16_t(a1)) << 16)));
+        }
+
         SIMD_INLINE __m128i SetInt32(int a0, int a1)
         {
             return _mm_unpacklo_epi32(_mm_set1_epi32(a0), _mm_set1_epi32(a1));
@@ -77,6 +82,11 @@ namespace Simd
             return _mm256_unpacklo_epi16(_mm256_set1_epi16(a0), _mm256_set1_epi16(a1));
         }
 
+        template <int a0, int a1> SIMD_INLINE __m256i SetInt16()
+        {
+            return _mm256_set1_epi32(int(uint32_t(uint16_t(a0)) | (uint32_t(uint16_t(a1)) << 16)));
+        }
+
         SIMD_INLINE __m256i SetInt32(int a0, int a1)
         {
             return _mm256_unpacklo_epi32(_mm256_set1_epi32(a0), _mm256_set1_epi32(a1));
@@ -113,6 +123,11 @@ namespace Simd
         {
             return _mm512_unpacklo_epi16(_mm512_set1_epi16(a0), _mm512_set1_epi16(a1));
         }
+
+        template <int a0, int a1> SIMD_INLINE __m512i SetInt16()
+        {
+            return _mm512_set1_epi32(int(uint32_t(uint16_t(a0)) | (uint32_t(uint16_t(a1)) << 16)));
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 
@@ -64,8 +64,7 @@ namespace Simd
                 _ax.data[2 * dx + 0] = (int16_t)(Base::FRACTION_RANGE - _ax.data[2 * dx + 1]);
             }
             size_t size = AlignHi(_param.dstW, A)*_param.channels * 2;
-            _bx[0].Resize(size);
-            _bx[1].Resize(size);
+            SetBuffer(size, 2);
         }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const __m128i * alpha, __m128i * buffer);
@@ -114,7 +113,7 @@ namespace Simd
             Store<false>((__m128i*)dst, _mm_packus_epi16(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             assert(_param.dstW >= A);
 
@@ -129,7 +128,7 @@ namespace Simd
 
             ptrdiff_t previous = -2;
             __m128i a[2];
-            uint8_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * pbx[2] = { buffer, buffer + _rowSize };
 
             for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
             {
@@ -167,13 +166,12 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
-            EstimateParams();
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
+            case 1: Run<1>(src, srcStride, dst, dstStride, buffer); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); break;
             default:
                 assert(0);
             }        
@@ -184,7 +182,7 @@ namespace Simd
         ResizerByteArea::ResizerByteArea(const ResParam & param)
             : Base::ResizerByteArea(param)
         {
-            _by.Resize(AlignHi(_param.srcW*_param.channels, _param.align), false, _param.align);
+            SetBuffer(AlignHi(_param.srcW*_param.channels, _param.align) * sizeof(int32_t), 1);
         }
 
         template<UpdateType update> SIMD_INLINE void ResizerByteAreaRowUpdate(const uint8_t * src0, size_t size, int32_t a, int32_t * dst)
@@ -261,14 +259,14 @@ namespace Simd
             ResizerByteAreaRes<N>(sum, dst);
         }
 
-        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW*N;
             const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
             for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
             {
-                int32_t * buf = _by.data;
+                int32_t * buf = (int32_t*)buffer;
                 size_t yn = iy[dy + 1] - iy[dy];
                 ResizerByteAreaRowSum(src, srcStride, yn, rowSize, ay[dy], ay0, ay[dy + 1], buf), src += yn * srcStride;
                 for (size_t dx = 0; dx < dstW; dx++, dst += N)
@@ -279,14 +277,14 @@ namespace Simd
             }
         }
 
-        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             switch (_param.channels)
             {
-            case 1: Run<1>(src, srcStride, dst, dstStride); return;
-            case 2: Run<2>(src, srcStride, dst, dstStride); return;
-            case 3: Run<3>(src, srcStride, dst, dstStride); return;
-            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 1: Run<1>(src, srcStride, dst, dstStride, buffer); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); return;
             default:
                 assert(0);
             }
@@ -298,7 +296,11 @@ namespace Simd
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
             if (param.IsByteBilinear() && (channels == 1 || channels == 2) && dstX >= A)
-                return new ResizerByteBilinear(param);
+            {
+                ResizerByteBilinear * resizer = new ResizerByteBilinear(param);
+                resizer->EstimateParams();
+                return resizer;
+            }
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
             else
@@ -30,40 +30,40 @@ namespace Simd
 #ifdef SIMD_SSE2_ENABLE    
     namespace Sse2
     {
-        template <bool align> SIMD_INLINE void AdjustedYuv16ToBgra(__m128i y16, __m128i u16, __m128i v16,
+        template <class T, bool align> SIMD_INLINE void AdjustedYuv16ToBgra(__m128i y16, __m128i u16, __m128i v16,
             const __m128i & a_0, __m128i * bgra)
         {
-            const __m128i b16 = AdjustedYuvToBlue16(y16, u16);
-            const __m128i g16 = AdjustedYuvToGreen16(y16, u16, v16);
-            const __m128i r16 = AdjustedYuvToRed16(y16, v16);
+            const __m128i b16 = AdjustedYuvToBlue16<T>(y16, u16);
+            const __m128i g16 = AdjustedYuvToGreen16<T>(y16, u16, v16);
+            const __m128i r16 = AdjustedYuvToRed16<T>(y16, v16);
             const __m128i bg8 = _mm_or_si128(b16, _mm_slli_si128(g16, 1));
             const __m128i ra8 = _mm_or_si128(r16, a_0);
             Store<align>(bgra + 0, _mm_unpacklo_epi16(bg8, ra8));
             Store<align>(bgra + 1, _mm_unpackhi_epi16(bg8, ra8));
         }
 
-        template <bool align> SIMD_INLINE void Yuv16ToBgra(__m128i y16, __m128i u16, __m128i v16,
+        template <class T, bool align> SIMD_INLINE void Yuv16ToBgra(__m128i y16, __m128i u16, __m128i v16,
             const __m128i & a_0, __m128i * bgra)
         {
-            AdjustedYuv16ToBgra<align>(AdjustY16(y16), AdjustUV16(u16), AdjustUV16(v16), a_0, bgra);
+            AdjustedYuv16ToBgra<T, align>(AdjustY16<T>(y16), AdjustUV16<T>(u16), AdjustUV16<T>(v16), a_0, bgra);
         }
 
-        template <bool align> SIMD_INLINE void Yuva8ToBgra(__m128i y8, __m128i u8, __m128i v8, const __m128i & a8, __m128i * bgra)
+        template <class T, bool align> SIMD_INLINE void Yuva8ToBgra(__m128i y8, __m128i u8, __m128i v8, const __m128i & a8, __m128i * bgra)
         {
-            Yuv16ToBgra<align>(_mm_unpacklo_epi8(y8, K_ZERO), _mm_unpacklo_epi8(u8, K_ZERO),
+            Yuv16ToBgra<T, align>(_mm_unpacklo_epi8(y8, K_ZERO), _mm_unpacklo_epi8(u8, K_ZERO),
                 _mm_unpacklo_epi8(v8, K_ZERO), _mm_unpacklo_epi8(K_ZERO, a8), bgra + 0);
-            Yuv16ToBgra<align>(_mm_unpackhi_epi8(y8, K_ZERO), _mm_unpackhi_epi8(u8, K_ZERO),
+            Yuv16ToBgra<T, align>(_mm_unpackhi_epi8(y8, K_ZERO), _mm_unpackhi_epi8(u8, K_ZERO),
                 _mm_unpackhi_epi8(v8, K_ZERO), _mm_unpackhi_epi8(K_ZERO, a8), bgra + 2);
         }
 
-        template <bool align> SIMD_INLINE void Yuva422pToBgra(const uint8_t * y, const __m128i & u, const __m128i & v,
+        template <class T, bool align> SIMD_INLINE void Yuva422pToBgra(const uint8_t * y, const __m128i & u, const __m128i & v,
             const uint8_t * a, uint8_t * bgra)
         {
-            Yuva8ToBgra<align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), Load<align>((__m128i*)a + 0), (__m128i*)bgra + 0);
-            Yuva8ToBgra<align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), Load<align>((__m128i*)a + 1), (__m128i*)bgra + 4);
+            Yuva8ToBgra<T, align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), Load<align>((__m128i*)a + 0), (__m128i*)bgra + 0);
+            Yuva8ToBgra<T, align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), Load<align>((__m128i*)a + 1), (__m128i*)bgra + 4);
         }
 
-        template <bool align> void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -81,16 +81,16 @@ namespace Simd
                 {
                     __m128i u_ = Load<align>((__m128i*)(u + colUV));
                     __m128i v_ = Load<align>((__m128i*)(v + colUV));
-                    Yuva422pToBgra<align>(y + colY, u_, v_, a + colY, bgra + colBgra);
-                    Yuva422pToBgra<align>(y + colY + yStride, u_, v_, a + colY + aStride, bgra + colBgra + bgraStride);
+                    Yuva422pToBgra<T, align>(y + colY, u_, v_, a + colY, bgra + colBgra);
+                    Yuva422pToBgra<T, align>(y + colY + yStride, u_, v_, a + colY + aStride, bgra + colBgra + bgraStride);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m128i u_ = Load<false>((__m128i*)(u + offset / 2));
                     __m128i v_ = Load<false>((__m128i*)(v + offset / 2));
-                    Yuva422pToBgra<false>(y + offset, u_, v_, a + offset, bgra + 4 * offset);
-                    Yuva422pToBgra<false>(y + offset + yStride, u_, v_, a + offset + aStride, bgra + 4 * offset + bgraStride);
+                    Yuva422pToBgra<T, false>(y + offset, u_, v_, a + offset, bgra + 4 * offset);
+                    Yuva422pToBgra<T, false>(y + offset + yStride, u_, v_, a + offset + aStride, bgra + 4 * offset + bgraStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -100,31 +100,37 @@ namespace Simd
             }
         }
 
-        void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) 
                 && Aligned(a) && Aligned(aStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuva420pToBgra<true>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+                Yuva420pToBgra<T, true>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
             else
-                Yuva420pToBgra<false>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+                Yuva420pToBgra<T, false>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+        }
+
+        void Yuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
+        {
+            Yuva420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
         }
 
-        template <bool align> SIMD_INLINE void Yuv8ToBgra(__m128i y8, __m128i u8, __m128i v8, const __m128i & a_0, __m128i * bgra)
+        template <class T, bool align> SIMD_INLINE void Yuv8ToBgra(__m128i y8, __m128i u8, __m128i v8, const __m128i & a_0, __m128i * bgra)
         {
-            Yuv16ToBgra<align>(_mm_unpacklo_epi8(y8, K_ZERO), _mm_unpacklo_epi8(u8, K_ZERO),
+            Yuv16ToBgra<T, align>(_mm_unpacklo_epi8(y8, K_ZERO), _mm_unpacklo_epi8(u8, K_ZERO),
                 _mm_unpacklo_epi8(v8, K_ZERO), a_0, bgra + 0);
-            Yuv16ToBgra<align>(_mm_unpackhi_epi8(y8, K_ZERO), _mm_unpackhi_epi8(u8, K_ZERO),
+            Yuv16ToBgra<T, align>(_mm_unpackhi_epi8(y8, K_ZERO), _mm_unpackhi_epi8(u8, K_ZERO),
                 _mm_unpackhi_epi8(v8, K_ZERO), a_0, bgra + 2);
         }
 
-        template <bool align> SIMD_INLINE void Yuv444pToBgra(const uint8_t * y, const uint8_t * u,
+        template <class T, bool align> SIMD_INLINE void Yuv444pToBgra(const uint8_t * y, const uint8_t * u,
             const uint8_t * v, const __m128i & a_0, uint8_t * bgra)
         {
-            Yuv8ToBgra<align>(Load<align>((__m128i*)y), Load<align>((__m128i*)u), Load<align>((__m128i*)v), a_0, (__m128i*)bgra);
+            Yuv8ToBgra<T, align>(Load<align>((__m128i*)y), Load<align>((__m128i*)u), Load<align>((__m128i*)v), a_0, (__m128i*)bgra);
         }
 
-        template <bool align> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert(width >= A);
@@ -141,12 +147,12 @@ namespace Simd
             {
                 for (size_t colYuv = 0, colBgra = 0; colYuv < bodyWidth; colYuv += A, colBgra += QA)
                 {
-                    Yuv444pToBgra<align>(y + colYuv, u + colYuv, v + colYuv, a_0, bgra + colBgra);
+                    Yuv444pToBgra<T, align>(y + colYuv, u + colYuv, v + colYuv, a_0, bgra + colBgra);
                 }
                 if (tail)
                 {
                     size_t col = width - A;
-                    Yuv444pToBgra<false>(y + col, u + col, v + col, a_0, bgra + 4 * col);
+                    Yuv444pToBgra<T, false>(y + col, u + col, v + col, a_0, bgra + 4 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -155,24 +161,46 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv444pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv444pToBgra<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv444pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv444pToBgra<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const __m128i & u, const __m128i & v,
+        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv444pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv444pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv444pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv444pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv444pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv444pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const __m128i & u, const __m128i & v,
             const __m128i & a_0, uint8_t * bgra)
         {
-            Yuv8ToBgra<align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), a_0, (__m128i*)bgra + 0);
-            Yuv8ToBgra<align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), a_0, (__m128i*)bgra + 4);
+            Yuv8ToBgra<T, align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), a_0, (__m128i*)bgra + 0);
+            Yuv8ToBgra<T, align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), a_0, (__m128i*)bgra + 4);
         }
 
-        template <bool align> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -191,16 +219,16 @@ namespace Simd
                 {
                     __m128i u_ = Load<align>((__m128i*)(u + colUV));
                     __m128i v_ = Load<align>((__m128i*)(v + colUV));
-                    Yuv422pToBgra<align>(y + colY, u_, v_, a_0, bgra + colBgra);
-                    Yuv422pToBgra<align>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
+                    Yuv422pToBgra<T, align>(y + colY, u_, v_, a_0, bgra + colBgra);
+                    Yuv422pToBgra<T, align>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m128i u_ = Load<false>((__m128i*)(u + offset / 2));
                     __m128i v_ = Load<false>((__m128i*)(v + offset / 2));
-                    Yuv422pToBgra<false>(y + offset, u_, v_, a_0, bgra + 4 * offset);
-                    Yuv422pToBgra<false>(y + offset + yStride, u_, v_, a_0, bgra + 4 * offset + bgraStride);
+                    Yuv422pToBgra<T, false>(y + offset, u_, v_, a_0, bgra + 4 * offset);
+                    Yuv422pToBgra<T, false>(y + offset + yStride, u_, v_, a_0, bgra + 4 * offset + bgraStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -209,22 +237,98 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv420pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv420pToBgra<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv420pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv420pToBgra<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const uint8_t * u, const uint8_t * v, const __m128i & a_0, uint8_t * bgra)
+        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
-            Yuv422pToBgra<align>(y, Load<align>((__m128i*)u), Load<align>((__m128i*)v), a_0, bgra);
+            Yuv420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv420pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv420pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool swap> void NvToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride));
+
+            __m128i a_0 = _mm_slli_si128(_mm_set1_epi16(alpha), 1);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colBgra += OA)
+                {
+                    __m128i u_, v_;
+                    LoadUv<align, swap>(uv + colY, u_, v_);
+                    Yuv422pToBgra<T, align>(y + colY, u_, v_, a_0, bgra + colBgra);
+                    Yuv422pToBgra<T, align>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    __m128i u_, v_;
+                    LoadUv<false, swap>(uv + offset, u_, v_);
+                    Yuv422pToBgra<T, false>(y + offset, u_, v_, a_0, bgra + 4 * offset);
+                    Yuv422pToBgra<T, false>(y + offset + yStride, u_, v_, a_0, bgra + 4 * offset + bgraStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <class T, bool swap> void NvToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+                NvToBgra<T, true, swap>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+            else
+                NvToBgra<T, false, swap>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            NvToBgra<Base::Bt601, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            NvToBgra<Base::Bt601, true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        template <class T, bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const uint8_t * u, const uint8_t * v, const __m128i & a_0, uint8_t * bgra)
+        {
+            Yuv422pToBgra<T, align>(y, Load<align>((__m128i*)u), Load<align>((__m128i*)v), a_0, bgra);
+        }
+
+        template <class T, bool align> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -240,11 +344,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colUV += A, colBgra += OA)
-                    Yuv422pToBgra<align>(y + colY, u + colUV, v + colUV, a_0, bgra + colBgra);
+                    Yuv422pToBgra<T, align>(y + colY, u + colUV, v + colUV, a_0, bgra + colBgra);
                 if (tail)
                 {
                     size_t offset = width - DA;
-                    Yuv422pToBgra<false>(y + offset, u + offset / 2, v + offset / 2, a_0, bgra + 4 * offset);
+                    Yuv422pToBgra<T, false>(y + offset, u + offset / 2, v + offset / 2, a_0, bgra + 4 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -253,14 +357,36 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv422pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv422pToBgra<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv422pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv422pToBgra<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv422pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv422pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv422pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv422pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv422pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv422pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
         }
     }
 #endif// SIMD_SSE2_ENABLE
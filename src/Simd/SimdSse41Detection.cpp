@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdDetection.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -328,6 +329,8 @@ namespace Simd
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
         {
             const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            if (hid.isAdaptiveStep)
+                return Base::DetectionHaarDetect32fi(_hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
             return DetectionHaarDetect32fi(hid,
                 Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
                 Rect(left, top, right, bottom),
@@ -765,6 +768,8 @@ namespace Simd
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
         {
             const HidLbpCascade<int, uint16_t> & hid = *(HidLbpCascade<int, uint16_t>*)_hid;
+            if (hid.isAdaptiveStep)
+                return Base::DetectionLbpDetect16ii(_hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
             return DetectionLbpDetect16ii(hid,
                 Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
                 Rect(left, top, right, bottom),
@@ -32,6 +32,10 @@ namespace Simd
     namespace Sse42
     {
         uint32_t Crc32c(const void * src, size_t size);
+
+        uint32_t Crc32cUpdate(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height);
+
+        void Crc32cBatch(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc);
     }
 #endif// SIMD_SSE42_ENABLE
 }
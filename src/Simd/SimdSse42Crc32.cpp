@@ -22,22 +22,33 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdCrc32.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
 #ifdef SIMD_SSE42_ENABLE
     namespace Sse42
     {
-        SIMD_INLINE void Crc32c(size_t & crc, const size_t * p, const size_t * end)
+        const size_t CRC32C_BLOCK_LONG = 4096;
+        const size_t CRC32C_BLOCK_SHORT = 256;
+        const size_t CRC32C_PARALLEL_MIN = 0x100000;
+
+        SIMD_INLINE size_t Crc32c(size_t crc, size_t value)
         {
-            while (p < end)
-            {
 #ifdef SIMD_X64_ENABLE
-                crc = _mm_crc32_u64(crc, *p++);
+            return _mm_crc32_u64(crc, value);
 #else
-                crc = _mm_crc32_u32(crc, *p++);
+            return _mm_crc32_u32((uint32_t)crc, value);
 #endif
-            }
+        }
+
+        SIMD_INLINE void Crc32c(size_t & crc, const size_t * p, const size_t * end)
+        {
+            while (p < end)
+                crc = Crc32c(crc, *p++);
         }
 
         SIMD_INLINE void Crc32c(size_t & crc, const uint8_t * p, const uint8_t * end)
@@ -46,17 +57,110 @@ namespace Simd
                 crc = _mm_crc32_u8((uint32_t)crc, *p++);
         }
 
-        uint32_t Crc32c(const void *src, size_t size)
+        SIMD_INLINE void Crc32c(size_t & crc0, size_t & crc1, size_t & crc2, const size_t * p0, const size_t * p1, const size_t * p2, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                crc0 = Crc32c(crc0, p0[i]);
+                crc1 = Crc32c(crc1, p1[i]);
+                crc2 = Crc32c(crc2, p2[i]);
+            }
+        }
+
+        template<size_t block> SIMD_INLINE void Crc32c(size_t & crc, const size_t * & p, const size_t * end, const Base::Crc32cShift & shift)
         {
-            uint8_t * nose = (uint8_t*)src;
-            size_t * body = (size_t*)AlignHi(nose, sizeof(size_t));
-            size_t * tail = (size_t*)AlignLo(nose + size, sizeof(size_t));
+            const size_t step = block / sizeof(size_t);
+            for (; p + 3 * step <= end; p += 3 * step)
+            {
+                size_t crc1 = 0, crc2 = 0;
+                Crc32c(crc, crc1, crc2, p, p + step, p + 2 * step, step);
+                crc = shift(shift((uint32_t)crc) ^ (uint32_t)crc1) ^ (uint32_t)crc2;
+            }
+        }
+
+        SIMD_INLINE uint32_t Crc32cRaw(uint32_t crc, const uint8_t * src, size_t size)
+        {
+            static const Base::Crc32cShift shiftLong(CRC32C_BLOCK_LONG), shiftShort(CRC32C_BLOCK_SHORT);
 
-            size_t crc = 0xFFFFFFFF;
-            Crc32c(crc, nose, (uint8_t*)body);
-            Crc32c(crc, body, tail);
-            Crc32c(crc, (uint8_t*)tail, nose + size);
-            return ~(uint32_t)crc;
+            const uint8_t * nose = src;
+            const size_t * body = (size_t*)AlignHi(nose, sizeof(size_t));
+            const size_t * tail = (size_t*)AlignLo(nose + size, sizeof(size_t));
+            size_t _crc = crc;
+            if ((uint8_t*)body > (uint8_t*)tail)
+            {
+                Crc32c(_crc, nose, nose + size);
+                return (uint32_t)_crc;
+            }
+            Crc32c(_crc, nose, (uint8_t*)body);
+            Crc32c<CRC32C_BLOCK_LONG>(_crc, body, tail, shiftLong);
+            Crc32c<CRC32C_BLOCK_SHORT>(_crc, body, tail, shiftShort);
+            Crc32c(_crc, body, tail);
+            Crc32c(_crc, (uint8_t*)tail, nose + size);
+            return (uint32_t)_crc;
+        }
+
+        SIMD_INLINE uint32_t Crc32cRaw(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height)
+        {
+            for (size_t row = 0; row < height; ++row, src += stride)
+                crc = Crc32cRaw(crc, src, width);
+            return crc;
+        }
+
+        uint32_t Crc32cUpdate(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height)
+        {
+            if (stride == width || height == 1)
+            {
+                width *= height;
+                height = 1;
+            }
+            size_t size = width * height;
+            size_t threads = size >= CRC32C_PARALLEL_MIN ? Base::GetThreadNumber() : 1;
+            if (threads <= 1)
+                return ~Crc32cRaw(~crc, src, stride, width, height);
+
+            std::vector<uint32_t> crcs(threads, 0);
+            std::vector<size_t> sizes(threads, 0);
+            if (height == 1)
+            {
+                Simd::Parallel(0, width, [&](size_t thread, size_t begin, size_t end)
+                {
+                    crcs[thread] = ~Crc32cRaw(0xFFFFFFFF, src + begin, end - begin);
+                    sizes[thread] = end - begin;
+                }, threads, CRC32C_BLOCK_LONG);
+            }
+            else
+            {
+                Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    crcs[thread] = ~Crc32cRaw(0xFFFFFFFF, src + begin * stride, stride, width, end - begin);
+                    sizes[thread] = (end - begin) * width;
+                }, threads);
+            }
+            for (size_t i = 0; i < threads; ++i)
+                crc = Base::Crc32cCombine(crc, crcs[i], sizes[i]);
+            return crc;
+        }
+
+        uint32_t Crc32c(const void * src, size_t size)
+        {
+            return Crc32cUpdate(0, (const uint8_t*)src, size, size, 1);
+        }
+
+        void Crc32cBatch(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc)
+        {
+            size_t i = 0;
+            for (; i + 3 <= count; i += 3)
+            {
+                size_t common = Simd::Min(size[i + 0], Simd::Min(size[i + 1], size[i + 2])) / sizeof(size_t);
+                size_t crc0 = 0xFFFFFFFF, crc1 = 0xFFFFFFFF, crc2 = 0xFFFFFFFF;
+                Crc32c(crc0, crc1, crc2, (const size_t*)src[i + 0], (const size_t*)src[i + 1], (const size_t*)src[i + 2], common);
+                common *= sizeof(size_t);
+                crc[i + 0] = ~Crc32cRaw((uint32_t)crc0, src[i + 0] + common, size[i + 0] - common);
+                crc[i + 1] = ~Crc32cRaw((uint32_t)crc1, src[i + 1] + common, size[i + 1] - common);
+                crc[i + 2] = ~Crc32cRaw((uint32_t)crc2, src[i + 2] + common, size[i + 2] - common);
+            }
+            for (; i < count; ++i)
+                crc[i] = Crc32c(src[i], size[i]);
         }
     }
 #endif// SIMD_SSE42_ENABLE
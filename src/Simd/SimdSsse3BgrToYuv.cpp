@@ -46,7 +46,7 @@ namespace Simd
             return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_maddubs_epi16(s0, K8_01), _mm_maddubs_epi16(s1, K8_01)), K16_0002), 2);
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <class T, bool align> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
         {
             const uint8_t * bgr1 = bgr0 + bgrStride;
             uint8_t * y1 = y0 + yStride;
@@ -54,16 +54,16 @@ namespace Simd
             __m128i blue[2][2], green[2][2], red[2][2];
 
             LoadBgr<align>((__m128i*)bgr0 + 0, blue[0][0], green[0][0], red[0][0]);
-            Store<align>((__m128i*)y0 + 0, BgrToY8(blue[0][0], green[0][0], red[0][0]));
+            Store<align>((__m128i*)y0 + 0, BgrToY8<T>(blue[0][0], green[0][0], red[0][0]));
 
             LoadBgr<align>((__m128i*)bgr0 + 3, blue[0][1], green[0][1], red[0][1]);
-            Store<align>((__m128i*)y0 + 1, BgrToY8(blue[0][1], green[0][1], red[0][1]));
+            Store<align>((__m128i*)y0 + 1, BgrToY8<T>(blue[0][1], green[0][1], red[0][1]));
 
             LoadBgr<align>((__m128i*)bgr1 + 0, blue[1][0], green[1][0], red[1][0]);
-            Store<align>((__m128i*)y1 + 0, BgrToY8(blue[1][0], green[1][0], red[1][0]));
+            Store<align>((__m128i*)y1 + 0, BgrToY8<T>(blue[1][0], green[1][0], red[1][0]));
 
             LoadBgr<align>((__m128i*)bgr1 + 3, blue[1][1], green[1][1], red[1][1]);
-            Store<align>((__m128i*)y1 + 1, BgrToY8(blue[1][1], green[1][1], red[1][1]));
+            Store<align>((__m128i*)y1 + 1, BgrToY8<T>(blue[1][1], green[1][1], red[1][1]));
 
             blue[0][0] = Average16(blue[0][0], blue[1][0]);
             blue[0][1] = Average16(blue[0][1], blue[1][1]);
@@ -72,11 +72,11 @@ namespace Simd
             red[0][0] = Average16(red[0][0], red[1][0]);
             red[0][1] = Average16(red[0][1], red[1][1]);
 
-            Store<align>((__m128i*)u, _mm_packus_epi16(BgrToU16(blue[0][0], green[0][0], red[0][0]), BgrToU16(blue[0][1], green[0][1], red[0][1])));
-            Store<align>((__m128i*)v, _mm_packus_epi16(BgrToV16(blue[0][0], green[0][0], red[0][0]), BgrToV16(blue[0][1], green[0][1], red[0][1])));
+            Store<align>((__m128i*)u, _mm_packus_epi16(BgrToU16<T>(blue[0][0], green[0][0], red[0][0]), BgrToU16<T>(blue[0][1], green[0][1], red[0][1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(BgrToV16<T>(blue[0][0], green[0][0], red[0][0]), BgrToV16<T>(blue[0][1], green[0][1], red[0][1])));
         }
 
-        template <bool align> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -91,11 +91,11 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
-                    BgrToYuv420p<align>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgrToYuv420p<T, align>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgrToYuv420p<false>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                    BgrToYuv420p<T, false>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -104,14 +104,36 @@ namespace Simd
             }
         }
 
-        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv420p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv420p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv420p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv420p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv420p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
 
         SIMD_INLINE void Average16(__m128i & a)
@@ -119,15 +141,15 @@ namespace Simd
             a = _mm_srli_epi16(_mm_add_epi16(_mm_maddubs_epi16(a, K8_01), K16_0001), 1);
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        template <class T, bool align> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             __m128i blue[2], green[2], red[2];
 
             LoadBgr<align>((__m128i*)bgr + 0, blue[0], green[0], red[0]);
-            Store<align>((__m128i*)y + 0, BgrToY8(blue[0], green[0], red[0]));
+            Store<align>((__m128i*)y + 0, BgrToY8<T>(blue[0], green[0], red[0]));
 
             LoadBgr<align>((__m128i*)bgr + 3, blue[1], green[1], red[1]);
-            Store<align>((__m128i*)y + 1, BgrToY8(blue[1], green[1], red[1]));
+            Store<align>((__m128i*)y + 1, BgrToY8<T>(blue[1], green[1], red[1]));
 
             Average16(blue[0]);
             Average16(blue[1]);
@@ -136,11 +158,11 @@ namespace Simd
             Average16(red[0]);
             Average16(red[1]);
 
-            Store<align>((__m128i*)u, _mm_packus_epi16(BgrToU16(blue[0], green[0], red[0]), BgrToU16(blue[1], green[1], red[1])));
-            Store<align>((__m128i*)v, _mm_packus_epi16(BgrToV16(blue[0], green[0], red[0]), BgrToV16(blue[1], green[1], red[1])));
+            Store<align>((__m128i*)u, _mm_packus_epi16(BgrToU16<T>(blue[0], green[0], red[0]), BgrToU16<T>(blue[1], green[1], red[1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(BgrToV16<T>(blue[0], green[0], red[0]), BgrToV16<T>(blue[1], green[1], red[1])));
         }
 
-        template <bool align> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -155,11 +177,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
-                    BgrToYuv422p<align>(bgr + colBgr, y + colY, u + colUV, v + colUV);
+                    BgrToYuv422p<T, align>(bgr + colBgr, y + colY, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgrToYuv422p<false>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
+                    BgrToYuv422p<T, false>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
                 }
                 y += yStride;
                 u += uStride;
@@ -168,26 +190,48 @@ namespace Simd
             }
         }
 
-        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv422p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv422p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv422p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv422p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv422p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             __m128i blue, green, red;
             LoadBgr<align>((__m128i*)bgr, blue, green, red);
-            Store<align>((__m128i*)y, BgrToY8(blue, green, red));
-            Store<align>((__m128i*)u, BgrToU8(blue, green, red));
-            Store<align>((__m128i*)v, BgrToV8(blue, green, red));
+            Store<align>((__m128i*)y, BgrToY8<T>(blue, green, red));
+            Store<align>((__m128i*)u, BgrToU8<T>(blue, green, red));
+            Store<align>((__m128i*)v, BgrToV8<T>(blue, green, red));
         }
 
-        template <bool align> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert(width >= A);
@@ -202,11 +246,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgr = 0; col < alignedWidth; col += A, colBgr += A3)
-                    BgrToYuv444p<align>(bgr + colBgr, y + col, u + col, v + col);
+                    BgrToYuv444p<T, align>(bgr + colBgr, y + col, u + col, v + col);
                 if (width != alignedWidth)
                 {
                     size_t col = width - A;
-                    BgrToYuv444p<false>(bgr + col * 3, y + col, u + col, v + col);
+                    BgrToYuv444p<T, false>(bgr + col * 3, y + col, u + col, v + col);
                 }
                 y += yStride;
                 u += uStride;
@@ -215,14 +259,36 @@ namespace Simd
             }
         }
 
-        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv444p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv444p<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv444p<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv444p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv444p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv444p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
     }
 #endif// SIMD_SSSE3_ENABLE
@@ -40,19 +40,19 @@ namespace Simd
             g16_1 = _mm_or_si128(_mm_shuffle_epi8(_bgra, K8_SHUFFLE_BGRA_TO_G000), K32_00010000);
         }
 
-        template <bool align> SIMD_INLINE __m128i LoadAndConvertY16(const __m128i * bgra, __m128i & b16_r16, __m128i & g16_1)
+        template <class T, bool align> SIMD_INLINE __m128i LoadAndConvertY16(const __m128i * bgra, __m128i & b16_r16, __m128i & g16_1)
         {
             __m128i _b16_r16[2], _g16_1[2];
             LoadPreparedBgra16<align>(bgra + 0, _b16_r16[0], _g16_1[0]);
             LoadPreparedBgra16<align>(bgra + 1, _b16_r16[1], _g16_1[1]);
             b16_r16 = _mm_hadd_epi32(_b16_r16[0], _b16_r16[1]);
             g16_1 = _mm_hadd_epi32(_g16_1[0], _g16_1[1]);
-            return SaturateI16ToU8(_mm_add_epi16(K16_Y_ADJUST, _mm_packs_epi32(BgrToY32(_b16_r16[0], _g16_1[0]), BgrToY32(_b16_r16[1], _g16_1[1]))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_ADJUST), _mm_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
         }
 
-        template <bool align> SIMD_INLINE __m128i LoadAndConvertY8(const __m128i * bgra, __m128i b16_r16[2], __m128i g16_1[2])
+        template <class T, bool align> SIMD_INLINE __m128i LoadAndConvertY8(const __m128i * bgra, __m128i b16_r16[2], __m128i g16_1[2])
         {
-            return _mm_packus_epi16(LoadAndConvertY16<align>(bgra + 0, b16_r16[0], g16_1[0]), LoadAndConvertY16<align>(bgra + 2, b16_r16[1], g16_1[1]));
+            return _mm_packus_epi16(LoadAndConvertY16<T, align>(bgra + 0, b16_r16[0], g16_1[0]), LoadAndConvertY16<T, align>(bgra + 2, b16_r16[1], g16_1[1]));
         }
 
         SIMD_INLINE void Average16(__m128i & a, const __m128i & b)
@@ -60,26 +60,26 @@ namespace Simd
             a = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(a, b), K16_0002), 2);
         }
 
-        SIMD_INLINE __m128i ConvertU16(__m128i b16_r16[2], __m128i g16_1[2])
+        template <class T> SIMD_INLINE __m128i ConvertU16(__m128i b16_r16[2], __m128i g16_1[2])
         {
-            return SaturateI16ToU8(_mm_add_epi16(K16_UV_ADJUST, _mm_packs_epi32(BgrToU32(b16_r16[0], g16_1[0]), BgrToU32(b16_r16[1], g16_1[1]))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_ADJUST), _mm_packs_epi32(BgrToU32<T>(b16_r16[0], g16_1[0]), BgrToU32<T>(b16_r16[1], g16_1[1]))));
         }
 
-        SIMD_INLINE __m128i ConvertV16(__m128i b16_r16[2], __m128i g16_1[2])
+        template <class T> SIMD_INLINE __m128i ConvertV16(__m128i b16_r16[2], __m128i g16_1[2])
         {
-            return SaturateI16ToU8(_mm_add_epi16(K16_UV_ADJUST, _mm_packs_epi32(BgrToV32(b16_r16[0], g16_1[0]), BgrToV32(b16_r16[1], g16_1[1]))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_ADJUST), _mm_packs_epi32(BgrToV32<T>(b16_r16[0], g16_1[0]), BgrToV32<T>(b16_r16[1], g16_1[1]))));
         }
 
-        template <bool align> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <class T, bool align> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
             uint8_t * y1 = y0 + yStride;
 
             __m128i _b16_r16[2][2][2], _g16_1[2][2][2];
-            Store<align>((__m128i*)y0 + 0, LoadAndConvertY8<align>((__m128i*)bgra0 + 0, _b16_r16[0][0], _g16_1[0][0]));
-            Store<align>((__m128i*)y0 + 1, LoadAndConvertY8<align>((__m128i*)bgra0 + 4, _b16_r16[0][1], _g16_1[0][1]));
-            Store<align>((__m128i*)y1 + 0, LoadAndConvertY8<align>((__m128i*)bgra1 + 0, _b16_r16[1][0], _g16_1[1][0]));
-            Store<align>((__m128i*)y1 + 1, LoadAndConvertY8<align>((__m128i*)bgra1 + 4, _b16_r16[1][1], _g16_1[1][1]));
+            Store<align>((__m128i*)y0 + 0, LoadAndConvertY8<T, align>((__m128i*)bgra0 + 0, _b16_r16[0][0], _g16_1[0][0]));
+            Store<align>((__m128i*)y0 + 1, LoadAndConvertY8<T, align>((__m128i*)bgra0 + 4, _b16_r16[0][1], _g16_1[0][1]));
+            Store<align>((__m128i*)y1 + 0, LoadAndConvertY8<T, align>((__m128i*)bgra1 + 0, _b16_r16[1][0], _g16_1[1][0]));
+            Store<align>((__m128i*)y1 + 1, LoadAndConvertY8<T, align>((__m128i*)bgra1 + 4, _b16_r16[1][1], _g16_1[1][1]));
 
             Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
             Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
@@ -91,11 +91,11 @@ namespace Simd
             Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
             Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
 
-            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16(_b16_r16[0][0], _g16_1[0][0]), ConvertU16(_b16_r16[0][1], _g16_1[0][1])));
-            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16(_b16_r16[0][0], _g16_1[0][0]), ConvertV16(_b16_r16[0][1], _g16_1[0][1])));
+            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16<T>(_b16_r16[0][1], _g16_1[0][1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16<T>(_b16_r16[0][1], _g16_1[0][1])));
         }
 
-        template <bool align> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -110,11 +110,11 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
-                    BgraToYuv420p<align>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgraToYuv420p<T, align>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgraToYuv420p<false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                    BgraToYuv420p<T, false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -123,14 +123,36 @@ namespace Simd
             }
         }
 
-        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv420p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv420p<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv420p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv420p<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv420p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv420p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv420p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv420p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv420p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv420p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv420p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
 
         SIMD_INLINE void Average16(__m128i a[2][2])
@@ -141,20 +163,20 @@ namespace Simd
             a[1][1] = _mm_srli_epi16(_mm_add_epi16(a[1][1], K16_0001), 1);
         }
 
-        template <bool align> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        template <class T, bool align> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             __m128i _b16_r16[2][2], _g16_1[2][2];
-            Store<align>((__m128i*)y + 0, LoadAndConvertY8<align>((__m128i*)bgra + 0, _b16_r16[0], _g16_1[0]));
-            Store<align>((__m128i*)y + 1, LoadAndConvertY8<align>((__m128i*)bgra + 4, _b16_r16[1], _g16_1[1]));
+            Store<align>((__m128i*)y + 0, LoadAndConvertY8<T, align>((__m128i*)bgra + 0, _b16_r16[0], _g16_1[0]));
+            Store<align>((__m128i*)y + 1, LoadAndConvertY8<T, align>((__m128i*)bgra + 4, _b16_r16[1], _g16_1[1]));
 
             Average16(_b16_r16);
             Average16(_g16_1);
 
-            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1])));
-            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1])));
+            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16<T>(_b16_r16[0], _g16_1[0]), ConvertU16<T>(_b16_r16[1], _g16_1[1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16<T>(_b16_r16[0], _g16_1[0]), ConvertV16<T>(_b16_r16[1], _g16_1[1])));
         }
 
-        template <bool align> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -169,11 +191,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
-                    BgraToYuv422p<align>(bgra + colBgra, y + colY, u + colUV, v + colUV);
+                    BgraToYuv422p<T, align>(bgra + colBgra, y + colY, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgraToYuv422p<false>(bgra + offset * 4, y + offset, u + offset / 2, v + offset / 2);
+                    BgraToYuv422p<T, false>(bgra + offset * 4, y + offset, u + offset / 2, v + offset / 2);
                 }
                 y += yStride;
                 u += uStride;
@@ -182,14 +204,36 @@ namespace Simd
             }
         }
 
-        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv422p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv422p<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv422p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv422p<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv422p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv422p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv422p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv422p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv422p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv422p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv422p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
         }
 
         template <bool align> SIMD_INLINE void LoadPreparedBgra16(const __m128i * bgra, __m128i & b16_r16, __m128i & g16_1, __m128i & a32)
@@ -200,37 +244,37 @@ namespace Simd
             a32 = _mm_and_si128(_mm_srli_si128(_bgra, 3), K32_000000FF);
         }
 
-        template <bool align> SIMD_INLINE void LoadAndConvertYA16(const __m128i * bgra, __m128i & b16_r16, __m128i & g16_1, __m128i & y16, __m128i & a16)
+        template <class T, bool align> SIMD_INLINE void LoadAndConvertYA16(const __m128i * bgra, __m128i & b16_r16, __m128i & g16_1, __m128i & y16, __m128i & a16)
         {
             __m128i _b16_r16[2], _g16_1[2], a32[2];
             LoadPreparedBgra16<align>(bgra + 0, _b16_r16[0], _g16_1[0], a32[0]);
             LoadPreparedBgra16<align>(bgra + 1, _b16_r16[1], _g16_1[1], a32[1]);
             b16_r16 = _mm_hadd_epi32(_b16_r16[0], _b16_r16[1]);
             g16_1 = _mm_hadd_epi32(_g16_1[0], _g16_1[1]);
-            y16 = SaturateI16ToU8(_mm_add_epi16(K16_Y_ADJUST, _mm_packs_epi32(BgrToY32(_b16_r16[0], _g16_1[0]), BgrToY32(_b16_r16[1], _g16_1[1]))));
+            y16 = SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_ADJUST), _mm_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
             a16 = _mm_packs_epi32(a32[0], a32[1]);
         }
 
-        template <bool align> SIMD_INLINE void LoadAndStoreYA(const __m128i * bgra, __m128i b16_r16[2], __m128i g16_1[2], __m128i * y, __m128i * a)
+        template <class T, bool align> SIMD_INLINE void LoadAndStoreYA(const __m128i * bgra, __m128i b16_r16[2], __m128i g16_1[2], __m128i * y, __m128i * a)
         {
             __m128i y16[2], a16[2];
-            LoadAndConvertYA16<align>(bgra + 0, b16_r16[0], g16_1[0], y16[0], a16[0]);
-            LoadAndConvertYA16<align>(bgra + 2, b16_r16[1], g16_1[1], y16[1], a16[1]);
+            LoadAndConvertYA16<T, align>(bgra + 0, b16_r16[0], g16_1[0], y16[0], a16[0]);
+            LoadAndConvertYA16<T, align>(bgra + 2, b16_r16[1], g16_1[1], y16[1], a16[1]);
             Store<align>(y, _mm_packus_epi16(y16[0], y16[1]));
             Store<align>(a, _mm_packus_epi16(a16[0], a16[1]));
         }
 
-        template <bool align> SIMD_INLINE void BgraToYuva420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, uint8_t * a0, size_t aStride)
+        template <class T, bool align> SIMD_INLINE void BgraToYuva420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, uint8_t * a0, size_t aStride)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
             uint8_t * y1 = y0 + yStride;
             uint8_t * a1 = a0 + aStride;
 
             __m128i _b16_r16[2][2][2], _g16_1[2][2][2];
-            LoadAndStoreYA<align>((__m128i*)bgra0 + 0, _b16_r16[0][0], _g16_1[0][0], (__m128i*)y0 + 0, (__m128i*)a0 + 0);
-            LoadAndStoreYA<align>((__m128i*)bgra0 + 4, _b16_r16[0][1], _g16_1[0][1], (__m128i*)y0 + 1, (__m128i*)a0 + 1);
-            LoadAndStoreYA<align>((__m128i*)bgra1 + 0, _b16_r16[1][0], _g16_1[1][0], (__m128i*)y1 + 0, (__m128i*)a1 + 0);
-            LoadAndStoreYA<align>((__m128i*)bgra1 + 4, _b16_r16[1][1], _g16_1[1][1], (__m128i*)y1 + 1, (__m128i*)a1 + 1);
+            LoadAndStoreYA<T, align>((__m128i*)bgra0 + 0, _b16_r16[0][0], _g16_1[0][0], (__m128i*)y0 + 0, (__m128i*)a0 + 0);
+            LoadAndStoreYA<T, align>((__m128i*)bgra0 + 4, _b16_r16[0][1], _g16_1[0][1], (__m128i*)y0 + 1, (__m128i*)a0 + 1);
+            LoadAndStoreYA<T, align>((__m128i*)bgra1 + 0, _b16_r16[1][0], _g16_1[1][0], (__m128i*)y1 + 0, (__m128i*)a1 + 0);
+            LoadAndStoreYA<T, align>((__m128i*)bgra1 + 4, _b16_r16[1][1], _g16_1[1][1], (__m128i*)y1 + 1, (__m128i*)a1 + 1);
 
             Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
             Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
@@ -242,11 +286,11 @@ namespace Simd
             Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
             Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
 
-            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16(_b16_r16[0][0], _g16_1[0][0]), ConvertU16(_b16_r16[0][1], _g16_1[0][1])));
-            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16(_b16_r16[0][0], _g16_1[0][0]), ConvertV16(_b16_r16[0][1], _g16_1[0][1])));
+            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16<T>(_b16_r16[0][1], _g16_1[0][1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16<T>(_b16_r16[0][1], _g16_1[0][1])));
         }
 
-        template <bool align> void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+        template <class T, bool align> void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -261,11 +305,11 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colYA = 0, colBgra = 0; colYA < alignedWidth; colYA += DA, colUV += A, colBgra += A8)
-                    BgraToYuva420p<align>(bgra + colBgra, bgraStride, y + colYA, yStride, u + colUV, v + colUV, a + colYA, aStride);
+                    BgraToYuva420p<T, align>(bgra + colBgra, bgraStride, y + colYA, yStride, u + colUV, v + colUV, a + colYA, aStride);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgraToYuva420p<false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2, a + offset, aStride);
+                    BgraToYuva420p<T, false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2, a + offset, aStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -275,14 +319,20 @@ namespace Simd
             }
         }
 
-        void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride)
                 && Aligned(a) && Aligned(aStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuva420p<true>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+                BgraToYuva420p<T, true>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
             else
-                BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+                BgraToYuva420p<T, false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+        }
+
+        void BgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
+        {
+            BgraToYuva420p<Base::Bt601>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
     }
 #endif// SIMD_SSSE3_ENABLE
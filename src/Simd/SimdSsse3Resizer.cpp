@@ -123,8 +123,7 @@ namespace Simd
                 }
             }
             size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
+            SetBuffer(size, 2);
         }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const __m128i * alpha, __m128i * buffer);
@@ -205,7 +204,7 @@ namespace Simd
             Store<false>((__m128i*)dst, _mm_packus_epi16(lo, hi));
         }
 
-        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        template<size_t N> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             struct One { uint8_t val[N * 1]; };
             struct Two { uint8_t val[N * 2]; };
@@ -215,7 +214,7 @@ namespace Simd
             const size_t step = A * N;
             ptrdiff_t previous = -2;
             __m128i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
@@ -265,7 +264,7 @@ namespace Simd
             _mm_storeu_si128((__m128i*)(dst + index.dst), _mm_maddubs_epi16(_mm_shuffle_epi8(_src, _shuffle), _alpha));
         }
 
-        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             size_t bufW = AlignHi(_param.dstW, A) * 2;
             size_t size = 2 * _param.dstW;
@@ -273,7 +272,7 @@ namespace Simd
             size_t blocks = _blocks;
             ptrdiff_t previous = -2;
             __m128i a[2];
-            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
+            uint8_t * bx[2] = { buffer, buffer + _rowSize };
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
@@ -310,22 +309,21 @@ namespace Simd
             }
         }
 
-        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, uint8_t * buffer) const
         {
             assert(_param.dstW >= A);
 
-            EstimateParams();
             switch (_param.channels)
             {
             case 1: 
                 if(_blocks)
-                    RunG(src, srcStride, dst, dstStride);
+                    RunG(src, srcStride, dst, dstStride, buffer);
                 else
-                    Run<1>(src, srcStride, dst, dstStride); 
+                    Run<1>(src, srcStride, dst, dstStride, buffer); 
                 break;
-            case 2: Run<2>(src, srcStride, dst, dstStride); break;
-            case 3: Run<3>(src, srcStride, dst, dstStride); break;
-            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride, buffer); break;
+            case 3: Run<3>(src, srcStride, dst, dstStride, buffer); break;
+            case 4: Run<4>(src, srcStride, dst, dstStride, buffer); break;
             default:
                 assert(0);
             }        
@@ -337,7 +335,11 @@ namespace Simd
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
             if (param.IsByteBilinear() && dstX >= A)
-                return new ResizerByteBilinear(param);
+            {
+                ResizerByteBilinear * resizer = new ResizerByteBilinear(param);
+                resizer->EstimateParams();
+                return resizer;
+            }
             else
                 return Sse2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
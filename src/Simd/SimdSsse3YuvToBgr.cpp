@@ -30,22 +30,22 @@ namespace Simd
 #ifdef SIMD_SSSE3_ENABLE    
     namespace Ssse3
     {
-        template <bool align> SIMD_INLINE void YuvToBgr(__m128i y, __m128i u, __m128i v, __m128i * bgr)
+        template <class T, bool align> SIMD_INLINE void YuvToBgr(__m128i y, __m128i u, __m128i v, __m128i * bgr)
         {
-            __m128i blue = YuvToBlue(y, u);
-            __m128i green = YuvToGreen(y, u, v);
-            __m128i red = YuvToRed(y, v);
+            __m128i blue = YuvToBlue<T>(y, u);
+            __m128i green = YuvToGreen<T>(y, u, v);
+            __m128i red = YuvToRed<T>(y, v);
             Store<align>(bgr + 0, InterleaveBgr<0>(blue, green, red));
             Store<align>(bgr + 1, InterleaveBgr<1>(blue, green, red));
             Store<align>(bgr + 2, InterleaveBgr<2>(blue, green, red));
         }
 
-        template <bool align> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        template <class T, bool align> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
         {
-            YuvToBgr<align>(Load<align>((__m128i*)y), Load<align>((__m128i*)u), Load<align>((__m128i*)v), (__m128i*)bgr);
+            YuvToBgr<T, align>(Load<align>((__m128i*)y), Load<align>((__m128i*)u), Load<align>((__m128i*)v), (__m128i*)bgr);
         }
 
-        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert(width >= A);
@@ -62,12 +62,12 @@ namespace Simd
             {
                 for (size_t colYuv = 0, colBgr = 0; colYuv < bodyWidth; colYuv += A, colBgr += A3)
                 {
-                    Yuv444pToBgr<align>(y + colYuv, u + colYuv, v + colYuv, bgr + colBgr);
+                    Yuv444pToBgr<T, align>(y + colYuv, u + colYuv, v + colYuv, bgr + colBgr);
                 }
                 if (tail)
                 {
                     size_t col = width - A;
-                    Yuv444pToBgr<false>(y + col, u + col, v + col, bgr + 3 * col);
+                    Yuv444pToBgr<T, false>(y + col, u + col, v + col, bgr + 3 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -76,18 +76,18 @@ namespace Simd
             }
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const __m128i & u, const __m128i & v, uint8_t * bgr)
+        template <class T, bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const __m128i & u, const __m128i & v, uint8_t * bgr)
         {
-            YuvToBgr<align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), (__m128i*)bgr + 0);
-            YuvToBgr<align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), (__m128i*)bgr + 3);
+            YuvToBgr<T, align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), (__m128i*)bgr + 0);
+            YuvToBgr<T, align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), (__m128i*)bgr + 3);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        template <class T, bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
         {
-            Yuv422pToBgr<align>(y, Load<align>((__m128i*)u), Load<align>((__m128i*)v), bgr);
+            Yuv422pToBgr<T, align>(y, Load<align>((__m128i*)u), Load<align>((__m128i*)v), bgr);
         }
 
-        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T, bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -103,11 +103,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colUV += A, colBgr += A6)
-                    Yuv422pToBgr<align>(y + colY, u + colUV, v + colUV, bgr + colBgr);
+                    Yuv422pToBgr<T, align>(y + colY, u + colUV, v + colUV, bgr + colBgr);
                 if (tail)
                 {
                     size_t offset = width - DA;
-                    Yuv422pToBgr<false>(y + offset, u + offset / 2, v + offset / 2, bgr + 3 * offset);
+                    Yuv422pToBgr<T, false>(y + offset, u + offset / 2, v + offset / 2, bgr + 3 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -116,17 +116,39 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -145,16 +167,16 @@ namespace Simd
                 {
                     __m128i u_ = Load<align>((__m128i*)(u + colUV));
                     __m128i v_ = Load<align>((__m128i*)(v + colUV));
-                    Yuv422pToBgr<align>(y + colY, u_, v_, bgr + colBgr);
-                    Yuv422pToBgr<align>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
+                    Yuv422pToBgr<T, align>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<T, align>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m128i u_ = Load<false>((__m128i*)(u + offset / 2));
                     __m128i v_ = Load<false>((__m128i*)(v + offset / 2));
-                    Yuv422pToBgr<false>(y + offset, u_, v_, bgr + 3 * offset);
-                    Yuv422pToBgr<false>(y + offset + yStride, u_, v_, bgr + 3 * offset + bgrStride);
+                    Yuv422pToBgr<T, false>(y + offset, u_, v_, bgr + 3 * offset);
+                    Yuv422pToBgr<T, false>(y + offset + yStride, u_, v_, bgr + 3 * offset + bgrStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -163,44 +185,142 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool swap> void NvToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            size_t A6 = A * 6;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colBgr += A6)
+                {
+                    __m128i u_, v_;
+                    LoadUv<align, swap>(uv + colY, u_, v_);
+                    Yuv422pToBgr<T, align>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<T, align>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    __m128i u_, v_;
+                    LoadUv<false, swap>(uv + offset, u_, v_);
+                    Yuv422pToBgr<T, false>(y + offset, u_, v_, bgr + 3 * offset);
+                    Yuv422pToBgr<T, false>(y + offset + yStride, u_, v_, bgr + 3 * offset + bgrStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T, bool swap> void NvToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                NvToBgr<T, true, swap>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+            else
+                NvToBgr<T, false, swap>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            NvToBgr<Base::Bt601, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            NvToBgr<Base::Bt601, true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<T, true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<T, false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
         }
 
         //---------------------------------------------------------------------
 
-        template <bool align> SIMD_INLINE void YuvToRgb(__m128i y, __m128i u, __m128i v, __m128i* rgb)
+        template <class T, bool align> SIMD_INLINE void YuvToRgb(__m128i y, __m128i u, __m128i v, __m128i* rgb)
         {
-            __m128i blue = YuvToBlue(y, u);
-            __m128i green = YuvToGreen(y, u, v);
-            __m128i red = YuvToRed(y, v);
+            __m128i blue = YuvToBlue<T>(y, u);
+            __m128i green = YuvToGreen<T>(y, u, v);
+            __m128i red = YuvToRed<T>(y, v);
             Store<align>(rgb + 0, InterleaveBgr<0>(red, green, blue));
             Store<align>(rgb + 1, InterleaveBgr<1>(red, green, blue));
             Store<align>(rgb + 2, InterleaveBgr<2>(red, green, blue));
         }
 
-        template <bool align> SIMD_INLINE void Yuv444pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb)
+        template <class T, bool align> SIMD_INLINE void Yuv444pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb)
         {
-            YuvToRgb<align>(Load<align>((__m128i*)y), Load<align>((__m128i*)u), Load<align>((__m128i*)v), (__m128i*)rgb);
+            YuvToRgb<T, align>(Load<align>((__m128i*)y), Load<align>((__m128i*)u), Load<align>((__m128i*)v), (__m128i*)rgb);
         }
 
-        template <bool align> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T, bool align> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert(width >= A);
@@ -217,12 +337,12 @@ namespace Simd
             {
                 for (size_t colYuv = 0, colRgb = 0; colYuv < bodyWidth; colYuv += A, colRgb += A3)
                 {
-                    Yuv444pToRgb<align>(y + colYuv, u + colYuv, v + colYuv, rgb + colRgb);
+                    Yuv444pToRgb<T, align>(y + colYuv, u + colYuv, v + colYuv, rgb + colRgb);
                 }
                 if (tail)
                 {
                     size_t col = width - A;
-                    Yuv444pToRgb<false>(y + col, u + col, v + col, rgb + 3 * col);
+                    Yuv444pToRgb<T, false>(y + col, u + col, v + col, rgb + 3 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -231,18 +351,18 @@ namespace Simd
             }
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const __m128i& u, const __m128i& v, uint8_t* rgb)
+        template <class T, bool align> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const __m128i& u, const __m128i& v, uint8_t* rgb)
         {
-            YuvToRgb<align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), (__m128i*)rgb + 0);
-            YuvToRgb<align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), (__m128i*)rgb + 3);
+            YuvToRgb<T, align>(Load<align>((__m128i*)y + 0), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), (__m128i*)rgb + 0);
+            YuvToRgb<T, align>(Load<align>((__m128i*)y + 1), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), (__m128i*)rgb + 3);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb)
+        template <class T, bool align> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* rgb)
         {
-            Yuv422pToRgb<align>(y, Load<align>((__m128i*)u), Load<align>((__m128i*)v), rgb);
+            Yuv422pToRgb<T, align>(y, Load<align>((__m128i*)u), Load<align>((__m128i*)v), rgb);
         }
 
-        template <bool align> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T, bool align> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -258,11 +378,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colRgb = 0; colY < bodyWidth; colY += DA, colUV += A, colRgb += A6)
-                    Yuv422pToRgb<align>(y + colY, u + colUV, v + colUV, rgb + colRgb);
+                    Yuv422pToRgb<T, align>(y + colY, u + colUV, v + colUV, rgb + colRgb);
                 if (tail)
                 {
                     size_t offset = width - DA;
-                    Yuv422pToRgb<false>(y + offset, u + offset / 2, v + offset / 2, rgb + 3 * offset);
+                    Yuv422pToRgb<T, false>(y + offset, u + offset / 2, v + offset / 2, rgb + 3 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -271,17 +391,39 @@ namespace Simd
             }
         }
 
-        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv422pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv422pToRgb<T, true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv422pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv422pToRgb<T, false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv422pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv422pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv422pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv422pToRgb<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv422pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv422pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -300,16 +442,16 @@ namespace Simd
                 {
                     __m128i u_ = Load<align>((__m128i*)(u + colUV));
                     __m128i v_ = Load<align>((__m128i*)(v + colUV));
-                    Yuv422pToRgb<align>(y + colY, u_, v_, rgb + colRgb);
-                    Yuv422pToRgb<align>(y + colY + yStride, u_, v_, rgb + colRgb + rgbStride);
+                    Yuv422pToRgb<T, align>(y + colY, u_, v_, rgb + colRgb);
+                    Yuv422pToRgb<T, align>(y + colY + yStride, u_, v_, rgb + colRgb + rgbStride);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m128i u_ = Load<false>((__m128i*)(u + offset / 2));
                     __m128i v_ = Load<false>((__m128i*)(v + offset / 2));
-                    Yuv422pToRgb<false>(y + offset, u_, v_, rgb + 3 * offset);
-                    Yuv422pToRgb<false>(y + offset + yStride, u_, v_, rgb + 3 * offset + rgbStride);
+                    Yuv422pToRgb<T, false>(y + offset, u_, v_, rgb + 3 * offset);
+                    Yuv422pToRgb<T, false>(y + offset + yStride, u_, v_, rgb + 3 * offset + rgbStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -318,24 +460,122 @@ namespace Simd
             }
         }
 
-        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv420pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv420pToRgb<T, true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv420pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv420pToRgb<T, false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
 
-        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv420pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv420pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv420pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv420pToRgb<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv420pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv420pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool swap> void NvToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(rgb) && Aligned(rgbStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            size_t A6 = A * 6;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colRgb = 0; colY < bodyWidth; colY += DA, colRgb += A6)
+                {
+                    __m128i u_, v_;
+                    LoadUv<align, swap>(uv + colY, u_, v_);
+                    Yuv422pToRgb<T, align>(y + colY, u_, v_, rgb + colRgb);
+                    Yuv422pToRgb<T, align>(y + colY + yStride, u_, v_, rgb + colRgb + rgbStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    __m128i u_, v_;
+                    LoadUv<false, swap>(uv + offset, u_, v_);
+                    Yuv422pToRgb<T, false>(y + offset, u_, v_, rgb + 3 * offset);
+                    Yuv422pToRgb<T, false>(y + offset + yStride, u_, v_, rgb + 3 * offset + rgbStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        template <class T, bool swap> void NvToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(rgb) && Aligned(rgbStride))
+                NvToRgb<T, true, swap>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+            else
+                NvToRgb<T, false, swap>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            NvToRgb<Base::Bt601, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            NvToRgb<Base::Bt601, true>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        template <class T> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv444pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv444pToRgb<T, true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv444pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv444pToRgb<T, false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv444pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv444pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv444pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt601Full: Yuv444pToRgb<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv444pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv444pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
         }
     }
 #endif// SIMD_SSSE3_ENABLE
@@ -25,11 +25,21 @@
 #define __SimdStream_h__
 
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdMath.h"
 
 namespace Simd
 {
     const size_t STREAM_SIZE_MIN = 0x00100000;
 
+    namespace Base
+    {
+        SIMD_INLINE bool NeedStream(size_t size)
+        {
+            return size >= Simd::Max(STREAM_SIZE_MIN, Cpu::L3_CACHE_SIZE / 2);
+        }
+    }
+
 #ifdef SIMD_SSE_ENABLE
     namespace Sse
     {
@@ -168,5 +178,36 @@ namespace Simd
         }
     }
 #endif//SIMD_AVX512F_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align, bool stream> SIMD_INLINE void Stream(uint8_t * p, __m512i a);
+
+        template <> SIMD_INLINE void Stream<false, false>(uint8_t * p, __m512i a)
+        {
+            _mm512_storeu_si512(p, a);
+        }
+
+        template <> SIMD_INLINE void Stream<false, true>(uint8_t * p, __m512i a)
+        {
+            _mm512_storeu_si512(p, a);
+        }
+
+        template <> SIMD_INLINE void Stream<true, false>(uint8_t * p, __m512i a)
+        {
+            _mm512_store_si512(p, a);
+        }
+
+        template <> SIMD_INLINE void Stream<true, true>(uint8_t * p, __m512i a)
+        {
+#if defined(__clang__)
+            _mm512_store_si512(p, a);
+#else
+            _mm512_stream_si512((__m512i*)p, a);
+#endif
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
 }
 #endif//__SimdStream_h__
@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSvm_h__
+#define __SimdSvm_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct SvmKernelParam
+    {
+        SimdSvmKernelType type;
+        size_t length, count;
+        float gamma, coef0;
+        int degree;
+
+        SvmKernelParam(size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree)
+        {
+            this->type = type;
+            this->length = length;
+            this->count = count;
+            this->gamma = gamma;
+            this->coef0 = coef0;
+            this->degree = degree;
+        }
+
+        bool Valid() const
+        {
+            return length > 0 && count > 0 && type >= SimdSvmKernelLinear && type <= SimdSvmKernelRbf && (type != SimdSvmKernelPolynomial || degree >= 1);
+        }
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE float SvmKernelValue(const SvmKernelParam & param, float dot, float norm, float svNorm)
+        {
+            switch (param.type)
+            {
+            case SimdSvmKernelPolynomial:
+            {
+                float value = param.gamma * dot + param.coef0, kernel = value;
+                for (int i = 1; i < param.degree; ++i)
+                    kernel *= value;
+                return kernel;
+            }
+            case SimdSvmKernelRbf:
+                return ::expf(-param.gamma * Simd::Max(norm + svNorm - 2.0f * dot, 0.0f));
+            default:
+                return dot;
+            }
+        }
+
+        typedef void(*GemmNNPtr)(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
+
+        class SvmKernel : public Deletable
+        {
+        public:
+            SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights);
+
+            void Sum(const float * x, size_t batch, float * sum) const;
+
+        protected:
+            virtual void Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const;
+
+            SvmKernelParam _param;
+            Array32f _svs, _weights, _svNorms;
+            GemmNNPtr _gemm;
+            size_t _microB, _microC;
+        };
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SvmKernel : public Base::SvmKernel
+        {
+        public:
+            SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights);
+
+        protected:
+            virtual void Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const;
+        };
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        class SvmKernel : public Base::SvmKernel
+        {
+        public:
+            SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights);
+
+        protected:
+            virtual void Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const;
+        };
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+    }
+#endif//SIMD_AVX512F_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class SvmKernel : public Base::SvmKernel
+        {
+        public:
+            SvmKernel(const SvmKernelParam & param, const float * svs, const float * weights);
+
+        protected:
+            virtual void Accumulate(const float * dot, size_t batch, size_t count, const float * norms, const float * weights, const float * svNorms, float * sum) const;
+        };
+
+        void * SvmKernelInit(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+#endif//__SimdSvm_h__
@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPreprocess_h__
+#define __SimdSynetPreprocess_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct PreprocessParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdSynetSourceFormatType srcFormat;
+        SimdYuvType yuvType;
+        SimdPixelFormatType dstFormat;
+        SimdTensorFormatType tensorFormat;
+        SimdTensorDataType tensorType;
+        bool letterbox;
+        uint8_t padding;
+        float lower[3], upper[3];
+
+        PreprocessParam(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight, 
+            SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding)
+        {
+            this->srcW = srcWidth;
+            this->srcH = srcHeight;
+            this->srcFormat = srcFormat;
+            this->yuvType = yuvType;
+            this->dstW = dstWidth;
+            this->dstH = dstHeight;
+            this->dstFormat = dstFormat;
+            this->channels = dstFormat == SimdPixelFormatGray8 ? 1 : 3;
+            this->tensorFormat = tensorFormat;
+            this->tensorType = tensorType;
+            this->letterbox = letterbox == SimdTrue;
+            this->padding = padding;
+            for (size_t c = 0; c < 3; ++c)
+            {
+                this->lower[c] = lower ? lower[c] : 0.0f;
+                this->upper[c] = upper ? upper[c] : 255.0f;
+            }
+        }
+
+        bool Valid() const
+        {
+            return srcW > 0 && srcH > 0 && dstW > 0 && dstH > 0 &&
+                (dstFormat == SimdPixelFormatGray8 || dstFormat == SimdPixelFormatBgr24 || dstFormat == SimdPixelFormatRgb24) &&
+                (tensorFormat == SimdTensorFormatNchw || tensorFormat == SimdTensorFormatNhwc) &&
+                (tensorType == SimdTensorData32f || tensorType == SimdTensorData8u) &&
+                ((srcFormat != SimdSynetSourceNv12 && srcFormat != SimdSynetSourceYuv420p) || (srcW % 2 == 0 && srcH % 2 == 0));
+        }
+
+        bool Yuv() const
+        {
+            return srcFormat == SimdSynetSourceNv12 || srcFormat == SimdSynetSourceYuv420p;
+        }
+
+        size_t SrcPixelSize() const
+        {
+            switch (srcFormat)
+            {
+            case SimdSynetSourceGray8: return 1;
+            case SimdSynetSourceBgr24: return 3;
+            case SimdSynetSourceBgra32: return 4;
+            case SimdSynetSourceRgb24: return 3;
+            default: return 1;
+            }
+        }
+
+        size_t TensorSize() const
+        {
+            return dstW * dstH * channels * (tensorType == SimdTensorData32f ? 4 : 1);
+        }
+    };
+
+    struct PreprocessConverter
+    {
+        typedef void(*PackedPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+        typedef void(*YuvPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+
+        PackedPtr packed, gray;
+        YuvPtr yuv;
+        size_t minWidth;
+    };
+
+    namespace Base
+    {
+        class SynetPreprocess : public Deletable
+        {
+        public:
+            SynetPreprocess(const PreprocessParam & param);
+
+            void Run(const uint8_t * const * src, const size_t * srcStride, const ptrdiff_t * rois, size_t roiCount, uint8_t * dst);
+
+        protected:
+            virtual void HorizontalRow(const uint8_t * src, size_t dstSize, float * dst);
+            virtual void VerticalRow(const float * src0, const float * src1, float fy, size_t size, float * dst);
+
+            void RunRoi(const uint8_t * const * src, const size_t * srcStride, size_t left, size_t top, size_t right, size_t bottom, uint8_t * dst);
+            const float * SourceRow(const uint8_t * const * src, const size_t * srcStride, size_t left, size_t right, size_t row, size_t dstSize);
+            void StoreRow(const float * src, size_t row, uint8_t * dst) const;
+
+            PreprocessParam _param;
+            PreprocessConverter _base, _fast;
+            Array32i _ix;
+            Array32f _fx, _rows, _norm, _pad, _k, _b;
+            Array8u _conv, _bgr, _u, _v;
+            ptrdiff_t _rowIndex[2];
+        };
+
+        void * SynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+            SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetPreprocess : public Base::SynetPreprocess
+        {
+        public:
+            SynetPreprocess(const PreprocessParam & param);
+
+        protected:
+            virtual void HorizontalRow(const uint8_t * src, size_t dstSize, float * dst);
+            virtual void VerticalRow(const float * src0, const float * src1, float fy, size_t size, float * dst);
+
+            Array32f _src;
+        };
+
+        void * SynetPreprocessInit(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+            SimdPixelFormatType dstFormat, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+#endif//__SimdSynetPreprocess_h__
@@ -34,6 +34,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <fstream>
+#include <vector>
 
 namespace Simd
 {
@@ -508,7 +509,8 @@ namespace Simd
              - PGM(Portable Gray Map) text(P2) or binary(P5) (the file is loaded as 8-bit gray image).
              - PPM(Portable Pixel Map) text(P3) or binary(P6) (the file is loaded as 32-bit BGRA image).
 
-            \note PGM and PPM files with comments are not supported.
+            \note Binary PPM images are converted from RGB to BGRA with using of SIMD optimized function ::SimdRgbToBgra. Comments in PGM and PPM headers are skipped.
+                Use Simd::MappedImage in order to get zero-copy access to binary PGM, PPM and BMP files.
 
             \param [in] path - a path to file with PGM or PPM image.
             \return - a result of loading.
@@ -534,6 +536,8 @@ namespace Simd
 
     private:
         bool _owner;
+
+        static bool ReadHeader(std::istream & is, size_t & width, size_t & height, size_t & depth);
     };
 
     /*! @ingroup cpp_view_functions
@@ -1168,10 +1172,8 @@ namespace Simd
             if (type == "P2" || type == "P5")
             {
                 size_t w, h, d;
-                ifs >> w >> h >> d;
-                if (d != 255)
+                if (!ReadHeader(ifs, w, h, d) || d != 255)
                     return false;
-                ifs.get();
                 Recreate(w, h, View<A>::Gray8);
                 if (type == "P2")
                 {
@@ -1187,18 +1189,21 @@ namespace Simd
                 }
                 else
                 {
-                    for (size_t row = 0; row < height; ++row)
-                        ifs.read((char*)(data + row*stride), width);
+                    if ((size_t)stride == width)
+                        ifs.read((char*)data, width * height);
+                    else
+                    {
+                        for (size_t row = 0; row < height; ++row)
+                            ifs.read((char*)(data + row * stride), width);
+                    }
                 }
-                return true;
+                return (bool)ifs;
             }
             if (type == "P3" || type == "P6")
             {
                 size_t w, h, d;
-                ifs >> w >> h >> d;
-                if (d != 255)
+                if (!ReadHeader(ifs, w, h, d) || d != 255)
                     return false;
-                ifs.get();
                 Recreate(w, h, View<A>::Bgra32);
                 if (type == "P3")
                 {
@@ -1218,27 +1223,34 @@ namespace Simd
                 }
                 else
                 {
-                    View buffer(width, 1, Bgr24);
-                    for (size_t row = 0; row < height; ++row)
-                    {
-                        ifs.read((char*)buffer.data, width*3);
-                        const uint8_t * rgb = buffer.data;
-                        uint8_t * bgra = data + row*stride;
-                        for (size_t col = 0; col < width; ++col, rgb += 3, bgra += 4)
-                        {
-                            bgra[0] = rgb[2];
-                            bgra[1] = rgb[1];
-                            bgra[2] = rgb[0];
-                            bgra[3] = 0xFF;
-                        }
-                    }
+                    std::vector<uint8_t> buffer(width * height * 3);
+                    ifs.read((char*)buffer.data(), buffer.size());
+                    SimdRgbToBgra(buffer.data(), width, height, width * 3, data, stride, 0xFF);
                 }
-                return true;
+                return (bool)ifs;
             }
         }
         return false;
     }
 
+    template <template<class> class A> SIMD_INLINE bool View<A>::ReadHeader(std::istream & is, size_t & width, size_t & height, size_t & depth)
+    {
+        size_t * values[3] = { &width, &height, &depth };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            is >> std::ws;
+            while (is.peek() == '#')
+            {
+                std::string comment;
+                std::getline(is, comment);
+                is >> std::ws;
+            }
+            is >> *values[i];
+        }
+        is.get();
+        return (bool)is;
+    }
+
     template <template<class> class A> SIMD_INLINE bool View<A>::Save(const std::string & path) const
     {
         if (!(format == View<A>::Gray8 || format == View<A>::Bgr24 || format == View<A>::Bgra32))
@@ -1253,41 +1265,17 @@ namespace Simd
                 for (size_t row = 0; row < height; ++row)
                     ofs.write((const char*)(data + row*stride), width);
             }
-            else if (format == View<A>::Bgr24)
+            else
             {
                 ofs << "P6\n" << width << " " << height << "\n255\n";
-                View buffer(width, 1, Bgr24);
-                for (size_t row = 0; row < height; ++row)
-                {
-                    const uint8_t * bgr = data + row*stride;
-                    uint8_t * rgb = buffer.data;
-                    for (size_t col = 0; col < width; ++col, bgr += 3, rgb += 3)
-                    {
-                        rgb[0] = bgr[2];
-                        rgb[1] = bgr[1];
-                        rgb[2] = bgr[0];
-                    }
-                    ofs.write((const char*)(buffer.data), width*3);
-                }
-            }
-            else if (format == View<A>::Bgra32)
-            {
-                ofs << "P6\n" << width << " " << height << "\n255\n";
-                View buffer(width, 1, Bgr24);
-                for (size_t row = 0; row < height; ++row)
-                {
-                    const uint8_t * bgra = data + row*stride;
-                    uint8_t * rgb = buffer.data;
-                    for (size_t col = 0; col < width; ++col, bgra += 4, rgb += 3)
-                    {
-                        rgb[0] = bgra[2];
-                        rgb[1] = bgra[1];
-                        rgb[2] = bgra[0];
-                    }
-                    ofs.write((const char*)buffer.data, width * 3);
-                }
+                std::vector<uint8_t> buffer(width * height * 3);
+                if (format == View<A>::Bgr24)
+                    SimdBgrToRgb(data, stride, width, height, buffer.data(), width * 3);
+                else
+                    SimdBgraToRgb(data, width, height, stride, buffer.data(), width * 3);
+                ofs.write((const char*)buffer.data(), buffer.size());
             }
-            return true;
+            return (bool)ofs;
         }
         else
             return false;
@@ -81,6 +81,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(AbsDifferenceSums3x3Masked);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSum);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSumMasked);
+    TEST_ADD_GROUP_A00(SquaredDifferenceSumsMxN8u);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSum32f);
     TEST_ADD_GROUP_AD0(SquaredDifferenceKahanSum32f);
     TEST_ADD_GROUP_AD0(CosineDistance32f);
@@ -96,6 +97,7 @@ namespace Test
     TEST_ADD_GROUP_A00(BgrToRgb);
     TEST_ADD_GROUP_AD0(GrayToBgr);
     TEST_ADD_GROUP_AD0(Int16ToGray);
+    TEST_ADD_GROUP_A00(Uint16ToGray);
     TEST_ADD_GROUP_A00(RgbToGray);
 
     TEST_ADD_GROUP_AD0(BgraToBayer);
@@ -106,11 +108,17 @@ namespace Test
     TEST_ADD_GROUP_A00(RgbToBgra);
 
     TEST_ADD_GROUP_AD0(BgraToYuv420p);
+    TEST_ADD_GROUP_A00(BgraToYuv420pV2);
     TEST_ADD_GROUP_AD0(BgraToYuv422p);
+    TEST_ADD_GROUP_A00(BgraToYuv422pV2);
     TEST_ADD_GROUP_AD0(BgraToYuv444p);
+    TEST_ADD_GROUP_A00(BgraToYuv444pV2);
     TEST_ADD_GROUP_AD0(BgrToYuv420p);
+    TEST_ADD_GROUP_A00(BgrToYuv420pV2);
     TEST_ADD_GROUP_AD0(BgrToYuv422p);
+    TEST_ADD_GROUP_A00(BgrToYuv422pV2);
     TEST_ADD_GROUP_AD0(BgrToYuv444p);
+    TEST_ADD_GROUP_A00(BgrToYuv444pV2);
     TEST_ADD_GROUP_A00(BgraToYuva420p);
 
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeSlow);
@@ -123,8 +131,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(BackgroundInitMask);
 
     TEST_ADD_GROUP_AD0(BayerToBgr);
+    TEST_ADD_GROUP_A00(BayerToBgrV2);
 
     TEST_ADD_GROUP_AD0(BayerToBgra);
+    TEST_ADD_GROUP_A00(BayerToBgraV2);
 
     TEST_ADD_GROUP_AD0(Bgr48pToBgra32);
 
@@ -147,6 +157,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(CopyFrame);
 
     TEST_ADD_GROUP_AD0(Crc32c);
+    TEST_ADD_GROUP_A00(Crc32cUpdate);
+    TEST_ADD_GROUP_A00(Crc32cBatch);
 
     TEST_ADD_GROUP_AD0(DeinterleaveUv);
     TEST_ADD_GROUP_AD0(DeinterleaveBgr);
@@ -158,6 +170,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A00(DetectionPrepareRegion);
+    TEST_ADD_GROUP_A00(DetectionLoadBinary);
+    TEST_ADD_GROUP_A00(DetectionResizeRegion);
+    TEST_ADD_GROUP_A00(DetectionObjects);
     TEST_ADD_GROUP_00S(Detection);
 
     TEST_ADD_GROUP_AD0(AlphaBlending);
@@ -194,6 +210,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(SquaredDifferenceSum16f);
     TEST_ADD_GROUP_AD0(CosineDistance16f);
     TEST_ADD_GROUP_A00(CosineDistancesMxNa16f);
+    TEST_ADD_GROUP_A00(CosineDistancesTopK16f);
 
     TEST_ADD_GROUP_AD0(Float32ToUint8);
     TEST_ADD_GROUP_AD0(Uint8ToFloat32);
@@ -207,6 +224,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_AD0(MedianFilterSquare5x5);
     TEST_ADD_GROUP_AD0(GaussianBlur3x3);
+    TEST_ADD_GROUP_A00(GaussianBlur);
     TEST_ADD_GROUP_AD0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_AD0(LbpEstimate);
     TEST_ADD_GROUP_AD0(NormalizeHistogram);
@@ -228,6 +246,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogExtractFeatures);
     TEST_ADD_GROUP_AD0(HogDeinterleave);
     TEST_ADD_GROUP_AD0(HogFilterSeparable);
+    TEST_ADD_GROUP_00S(HogCache);
 
     TEST_ADD_GROUP_AD0(HogLiteExtractFeatures);
     TEST_ADD_GROUP_AD0(HogLiteFilterFeatures);
@@ -236,6 +255,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogLiteFilterSeparable);
     TEST_ADD_GROUP_AD0(HogLiteFindMax7x7);
     TEST_ADD_GROUP_AD0(HogLiteCreateMask);
+    TEST_ADD_GROUP_00S(HogDetector);
 
     TEST_ADD_GROUP_00S(ImageMatcher);
 
@@ -250,6 +270,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(InterleaveBgr);
     TEST_ADD_GROUP_AD0(InterleaveBgra);
 
+    TEST_ADD_GROUP_A00(MappedImage);
+
     TEST_ADD_GROUP_00S(Motion);
 
     TEST_ADD_GROUP_AD0(NeuralConvert);
@@ -283,6 +305,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(NeuralPooling2x2Max3x3);
     TEST_ADD_GROUP_AD0(NeuralConvolutionForward);
     TEST_ADD_GROUP_00S(NeuralPredict);
+    TEST_ADD_GROUP_00S(NeuralCompress);
     TEST_ADD_GROUP_00S(NeuralTrain);
 
     TEST_ADD_GROUP_AD0(OperationBinary8u);
@@ -301,6 +324,8 @@ namespace Test
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
     TEST_ADD_GROUP_A00(Resizer);
+    TEST_ADD_GROUP_A00(ResizerShared);
+    TEST_ADD_GROUP_A00(CropAndResize);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
@@ -329,6 +354,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(StretchGray2x2);
 
     TEST_ADD_GROUP_AD0(SvmSumLinear);
+    TEST_ADD_GROUP_A00(SvmKernelSum);
 
     TEST_ADD_GROUP_A00(SynetAddBias);
     TEST_ADD_GROUP_A00(SynetAdd8i);
@@ -353,6 +379,7 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A00(SynetConvert8uTo32f);
     TEST_ADD_GROUP_A00(SynetSetInput);
+    TEST_ADD_GROUP_A00(SynetPreprocess);
     TEST_ADD_GROUP_A00(SynetReorderImage);
     TEST_ADD_GROUP_A00(SynetReorderFilter);
 
@@ -419,20 +446,41 @@ namespace Test
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block4x4);
 
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
+    TEST_ADD_GROUP_A00(Yuv444pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv422pToBgr);
+    TEST_ADD_GROUP_A00(Yuv422pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv420pToBgr);
+    TEST_ADD_GROUP_A00(Yuv420pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv444pToHsl);
     TEST_ADD_GROUP_AD0(Yuv444pToHsv);
     TEST_ADD_GROUP_AD0(Yuv444pToHue);
     TEST_ADD_GROUP_AD0(Yuv420pToHue);
     TEST_ADD_GROUP_A00(Yuv444pToRgb);
+    TEST_ADD_GROUP_A00(Yuv444pToRgbV2);
     TEST_ADD_GROUP_A00(Yuv422pToRgb);
+    TEST_ADD_GROUP_A00(Yuv422pToRgbV2);
     TEST_ADD_GROUP_A00(Yuv420pToRgb);
+    TEST_ADD_GROUP_A00(Yuv420pToRgbV2);
+
+    TEST_ADD_GROUP_A00(Nv12ToBgr);
+    TEST_ADD_GROUP_A00(Nv12ToBgra);
+    TEST_ADD_GROUP_A00(Nv12ToRgb);
+    TEST_ADD_GROUP_A00(Nv21ToBgr);
+    TEST_ADD_GROUP_A00(Nv21ToBgra);
+    TEST_ADD_GROUP_A00(Nv21ToRgb);
+
+    TEST_ADD_GROUP_A00(P010ToBgra);
+    TEST_ADD_GROUP_A00(P010ToYuv420p);
+    TEST_ADD_GROUP_A00(Yuv420p16ToBgra);
+    TEST_ADD_GROUP_A00(Yuv420p16ToYuv420p);
 
     TEST_ADD_GROUP_A00(Yuva420pToBgra);
     TEST_ADD_GROUP_AD0(Yuv444pToBgra);
+    TEST_ADD_GROUP_A00(Yuv444pToBgraV2);
     TEST_ADD_GROUP_AD0(Yuv422pToBgra);
+    TEST_ADD_GROUP_A00(Yuv422pToBgraV2);
     TEST_ADD_GROUP_AD0(Yuv420pToBgra);
+    TEST_ADD_GROUP_A00(Yuv420pToBgraV2);
 
     class Task
     {
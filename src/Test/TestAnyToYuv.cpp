@@ -34,21 +34,30 @@ namespace Test
         {
             typedef void(*FuncPtr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
                 uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+            typedef void(*FuncV2Ptr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
             FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
             String description;
 
-            FuncYuv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            FuncYuv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvUnknown), description(d) {}
+            FuncYuv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "[" + ToString(t) + "]") {}
 
             void Call(const View & bgr, View & y, View & u, View & v) const
             {
                 TEST_PERFORMANCE_TEST(description);
-                func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+                if (funcV2)
+                    funcV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+                else
+                    func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
             }
         };
     }
 
 #define FUNC_YUV(function) FuncYuv(function, #function)
+#define FUNC_YUV_V2(function, type) FuncYuv(function, #function, type)
 
     bool AnyToYuvAutoTest(int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f1, const FuncYuv & f2)
     {
@@ -90,6 +99,27 @@ namespace Test
         return result;
     }
 
+    bool BgrToYuvKnownColorTest(int dx, int dy, const FuncYuv & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " for known colors.");
+
+        const int width = 128, height = 2;
+        View bgr(width, height, View::Bgr24), y1(width, height, View::Gray8), y2(width, height, View::Gray8);
+        View u1(width / dx, height / dy, View::Gray8), v1(width / dx, height / dy, View::Gray8);
+        View u2(width / dx, height / dy, View::Gray8), v2(width / dx, height / dy, View::Gray8);
+        FillKnownColors(f.yuvType, dx, dy, bgr, y1, u1, v1);
+
+        f.funcV2(bgr.data, width, height, bgr.stride, y2.data, y2.stride, u2.data, u2.stride, v2.data, v2.stride, f.yuvType);
+
+        result = result && Compare(y1, y2, 2, true, 32, 0, "y");
+        result = result && Compare(u1, u2, 2, true, 32, 0, "u");
+        result = result && Compare(v1, v2, 2, true, 32, 0, "v");
+
+        return result;
+    }
+
     bool BgraToYuv420pAutoTest()
     {
         bool result = true;
@@ -129,6 +159,40 @@ namespace Test
         return result;
     }
 
+    bool BgraToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Base::BgraToYuv420pV2, type), FUNC_YUV_V2(SimdBgraToYuv420pV2, type));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Sse2::BgraToYuv420pV2, type), FUNC_YUV_V2(SimdBgraToYuv420pV2, type));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Ssse3::BgraToYuv420pV2, type), FUNC_YUV_V2(SimdBgraToYuv420pV2, type));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgraToYuv420pV2, type), FUNC_YUV_V2(SimdBgraToYuv420pV2, type));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv420pV2, type), FUNC_YUV_V2(SimdBgraToYuv420pV2, type));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgraToYuv422pAutoTest()
     {
         bool result = true;
@@ -168,6 +232,40 @@ namespace Test
         return result;
     }
 
+    bool BgraToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv422pV2, type), FUNC_YUV_V2(SimdBgraToYuv422pV2, type));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Sse2::BgraToYuv422pV2, type), FUNC_YUV_V2(SimdBgraToYuv422pV2, type));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Ssse3::BgraToYuv422pV2, type), FUNC_YUV_V2(SimdBgraToYuv422pV2, type));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv422pV2, type), FUNC_YUV_V2(SimdBgraToYuv422pV2, type));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv422pV2, type), FUNC_YUV_V2(SimdBgraToYuv422pV2, type));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgraToYuv444pAutoTest()
     {
         bool result = true;
@@ -202,6 +300,35 @@ namespace Test
         return result;
     }
 
+    bool BgraToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv444pV2, type), FUNC_YUV_V2(SimdBgraToYuv444pV2, type));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Sse2::BgraToYuv444pV2, type), FUNC_YUV_V2(SimdBgraToYuv444pV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv444pV2, type), FUNC_YUV_V2(SimdBgraToYuv444pV2, type));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv444pV2, type), FUNC_YUV_V2(SimdBgraToYuv444pV2, type));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgrToYuv420pAutoTest()
     {
         bool result = true;
@@ -236,6 +363,37 @@ namespace Test
         return result;
     }
 
+    bool BgrToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2, type), FUNC_YUV_V2(SimdBgrToYuv420pV2, type));
+            result = result && BgrToYuvKnownColorTest(2, 2, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2, type));
+            result = result && BgrToYuvKnownColorTest(2, 2, FUNC_YUV_V2(SimdBgrToYuv420pV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv420pV2, type), FUNC_YUV_V2(SimdBgrToYuv420pV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgrToYuv420pV2, type), FUNC_YUV_V2(SimdBgrToYuv420pV2, type));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv420pV2, type), FUNC_YUV_V2(SimdBgrToYuv420pV2, type));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgrToYuv422pAutoTest()
     {
         bool result = true;
@@ -270,6 +428,37 @@ namespace Test
         return result;
     }
 
+    bool BgrToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv422pV2, type), FUNC_YUV_V2(SimdBgrToYuv422pV2, type));
+            result = result && BgrToYuvKnownColorTest(2, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv422pV2, type));
+            result = result && BgrToYuvKnownColorTest(2, 1, FUNC_YUV_V2(SimdBgrToYuv422pV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv422pV2, type), FUNC_YUV_V2(SimdBgrToYuv422pV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv422pV2, type), FUNC_YUV_V2(SimdBgrToYuv422pV2, type));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv422pV2, type), FUNC_YUV_V2(SimdBgrToYuv422pV2, type));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgrToYuv444pAutoTest()
     {
         bool result = true;
@@ -304,6 +493,37 @@ namespace Test
         return result;
     }
 
+    bool BgrToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv444pV2, type), FUNC_YUV_V2(SimdBgrToYuv444pV2, type));
+            result = result && BgrToYuvKnownColorTest(1, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv444pV2, type));
+            result = result && BgrToYuvKnownColorTest(1, 1, FUNC_YUV_V2(SimdBgrToYuv444pV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv444pV2, type), FUNC_YUV_V2(SimdBgrToYuv444pV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv444pV2, type), FUNC_YUV_V2(SimdBgrToYuv444pV2, type));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv444pV2, type), FUNC_YUV_V2(SimdBgrToYuv444pV2, type));
+#endif
+        }
+
+        return result;
+    }
+
     namespace
     {
         struct FuncYuva
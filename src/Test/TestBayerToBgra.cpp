@@ -112,6 +112,182 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, 
+                size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            FuncPtr func;
+            String description;
+
+            FuncV2(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains)
+            {
+                description = description + "[" + FormatDescription(format) + "-" + ToString(bitDepth) + "-" + ToString((int)demosaic) + (gains ? "-g" : "") + "]";
+            }
+
+            void Call(const View & src, View::Format format, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, dst.width, dst.height, src.stride, (SimdPixelFormatType)format, bitDepth, demosaic, gains, dst.data, dst.stride, 0xFF);
+            }
+        };
+    }
+
+#define FUNC_V2(func) FuncV2(func, #func)
+
+    bool BayerToBgraV2AutoTest(int width, int height, View::Format format, size_t bitDepth, SimdBayerDemosaicType demosaic, const float * gains, FuncV2 f1, FuncV2 f2)
+    {
+        bool result = true;
+
+        f1.Update(format, bitDepth, demosaic, gains);
+        f2.Update(format, bitDepth, demosaic, gains);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View s(width, height, bitDepth == 8 ? format : View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, format, bitDepth, demosaic, gains, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, format, bitDepth, demosaic, gains, d2));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    static void SetBayer(View & bayer, size_t x, size_t y, int value)
+    {
+        if (bayer.format == View::Int16)
+            bayer.At<uint16_t>(x, y) = (uint16_t)value;
+        else
+            bayer.At<uint8_t>(x, y) = (uint8_t)value;
+    }
+
+    static bool CheckBayerOutput(const View & dst, size_t x, size_t y, int expected)
+    {
+        const uint8_t * p = dst.data + y * dst.stride + x * 4;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            if (p[c] != expected)
+            {
+                TEST_LOG_SS(Error, "Error at [" << x << ", " << y << "] channel " << c << ": " << int(p[c]) << " != " << expected << ".");
+                return false;
+            }
+        }
+        if (p[3] != 0x7F)
+        {
+            TEST_LOG_SS(Error, "Error at [" << x << ", " << y << "]: alpha " << int(p[3]) << " != 127.");
+            return false;
+        }
+        return true;
+    }
+
+    bool BayerToBgraV2KnownAnswerTest(int width, int height, View::Format format, size_t bitDepth, const FuncV2 & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " MHC known answers for " << FormatDescription(format) << "-" << bitDepth << " [" << width << "," << height << "].");
+
+        int shift = int(bitDepth) - 8;
+        View s(width, height, bitDepth == 8 ? format : View::Int16), d(width, height, View::Bgra32);
+
+        // A flat field must stay flat everywhere including the borders.
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                SetBayer(s, x, y, 77 << shift);
+        f.func(s.data, width, height, s.stride, (SimdPixelFormatType)format, bitDepth, SimdBayerDemosaicMhc, NULL, d.data, d.stride, 0x7F);
+        for (int y = 0; y < height && result; ++y)
+            for (int x = 0; x < width && result; ++x)
+                result = CheckBayerOutput(d, x, y, 77);
+
+        // MHC kernels reproduce a linear gray ramp exactly away from the two border pixels touched by padding.
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                SetBayer(s, x, y, (10 + x + 2 * y) << shift);
+        f.func(s.data, width, height, s.stride, (SimdPixelFormatType)format, bitDepth, SimdBayerDemosaicMhc, NULL, d.data, d.stride, 0x7F);
+        for (int y = 2; y < height - 2 && result; ++y)
+            for (int x = 2; x < width - 2 && result; ++x)
+                result = CheckBayerOutput(d, x, y, 10 + x + 2 * y);
+
+        if (bitDepth > 8 && bitDepth < 16)
+        {
+            // 16-bit values above (1 << bitDepth) - 1 must saturate to the maximal value.
+            int max = (1 << bitDepth) - 1;
+            View c(width, height, View::Int16), dc(width, height, View::Bgra32);
+            FillRandom(s);
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x)
+                    c.At<uint16_t>(x, y) = Simd::Min<uint16_t>(s.At<uint16_t>(x, y), max);
+            f.func(s.data, width, height, s.stride, (SimdPixelFormatType)format, bitDepth, SimdBayerDemosaicMhc, NULL, d.data, d.stride, 0x7F);
+            f.func(c.data, width, height, c.stride, (SimdPixelFormatType)format, bitDepth, SimdBayerDemosaicMhc, NULL, dc.data, dc.stride, 0x7F);
+            result = result && Compare(d, dc, 0, true, 32);
+
+            Simd::Fill(s, 0xFF);
+            f.func(s.data, width, height, s.stride, (SimdPixelFormatType)format, bitDepth, SimdBayerDemosaicMhc, NULL, d.data, d.stride, 0x7F);
+            for (int y = 0; y < height && result; ++y)
+                for (int x = 0; x < width && result; ++x)
+                    result = CheckBayerOutput(d, x, y, 255);
+        }
+
+        return result;
+    }
+
+    bool BayerToBgraV2AutoTest(const FuncV2 & f1, const FuncV2 & f2)
+    {
+        bool result = true;
+
+        const float gains[3] = { 1.9f, 1.0f, 1.45f };
+        for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+        {
+            for (int demosaic = SimdBayerDemosaicBilinear; demosaic <= SimdBayerDemosaicMhc; ++demosaic)
+            {
+                result = result && BayerToBgraV2AutoTest(W, H, format, 8, (SimdBayerDemosaicType)demosaic, NULL, f1, f2);
+                result = result && BayerToBgraV2AutoTest(W + E, H - E, format, 8, (SimdBayerDemosaicType)demosaic, gains, f1, f2);
+                result = result && BayerToBgraV2AutoTest(W - E, H + E, format, 12, (SimdBayerDemosaicType)demosaic, gains, f1, f2);
+            }
+        }
+        result = result && BayerToBgraV2AutoTest(258, 64, View::BayerGrbg, 8, SimdBayerDemosaicBilinear, NULL, f1, f2);
+        result = result && BayerToBgraV2AutoTest(W, H, View::BayerRggb, 10, SimdBayerDemosaicMhc, NULL, f1, f2);
+
+        for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+        {
+            result = result && BayerToBgraV2KnownAnswerTest(160, 32, format, 8, f1);
+            result = result && BayerToBgraV2KnownAnswerTest(160, 32, format, 12, f1);
+        }
+        result = result && BayerToBgraV2KnownAnswerTest(160, 32, View::BayerRggb, 10, f1);
+        result = result && BayerToBgraV2KnownAnswerTest(160, 32, View::BayerGbrg, 16, f1);
+
+        return result;
+    }
+
+    bool BayerToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Base::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A + 2)
+            result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Avx2::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A + 2)
+            result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Avx512bw::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2));
+#endif
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool BayerToBgraDataTest(bool create, int width, int height, View::Format format, const Func & f)
     {
         bool result = true;
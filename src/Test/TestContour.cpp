@@ -324,6 +324,54 @@ namespace Test
 {
     typedef Simd::ContourDetector<Simd::Allocator> ContourDetector;
 
+    bool ContourDetectorCheckConnectivity(const ContourDetector::Contours & contours)
+    {
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            for (size_t j = 1; j < contours[i].size(); ++j)
+            {
+                if (std::abs(contours[i][j].x - contours[i][j - 1].x) > 1 || std::abs(contours[i][j].y - contours[i][j - 1].y) > 1)
+                {
+                    TEST_LOG_SS(Error, "Contour " << i << " is broken at point " << j << " !");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool ContourDetectorPointLesser(const ContourDetector::Point & a, const ContourDetector::Point & b)
+    {
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    }
+
+    // Only the estimation of routing steps is parallel, the tracing is sequential in anchor order.
+    // So the contours found with several threads must be the same as with one: the allowed difference is zero.
+    bool ContourDetectorCompare(const ContourDetector::Contours & control, const ContourDetector::Contours & current, size_t threadNumber)
+    {
+        const size_t CONTOUR_COUNT_DIFFERENCE_MAX = 0;
+        size_t difference = control.size() > current.size() ? control.size() - current.size() : current.size() - control.size();
+        if (difference > CONTOUR_COUNT_DIFFERENCE_MAX)
+        {
+            TEST_LOG_SS(Error, "Contour number " << current.size() << " found with " << threadNumber << " threads differs from " << control.size() << " !");
+            return false;
+        }
+
+        std::vector<ContourDetector::Point> a, b;
+        for (size_t i = 0; i < control.size(); ++i)
+            a.insert(a.end(), control[i].begin(), control[i].end());
+        for (size_t i = 0; i < current.size(); ++i)
+            b.insert(b.end(), current[i].begin(), current[i].end());
+        std::sort(a.begin(), a.end(), ContourDetectorPointLesser);
+        std::sort(b.begin(), b.end(), ContourDetectorPointLesser);
+        if (a != b)
+        {
+            TEST_LOG_SS(Error, "Contour points found with " << threadNumber << " threads (" << b.size() << ") differ from ones found with 1 thread (" << a.size() << ") !");
+            return false;
+        }
+        return true;
+    }
+
     bool ContourDetectorSpecialTest()
     {
         ContourDetector::View image;
@@ -343,6 +391,24 @@ namespace Test
 
         TEST_LOG_SS(Info, contours.size() << " contours were found.");
 
+        if (!ContourDetectorCheckConnectivity(contours))
+            return false;
+
+        const size_t threadNumbers[] = { 2, 3, 4, 8 };
+        for (size_t t = 0; t < sizeof(threadNumbers) / sizeof(threadNumbers[0]); ++t)
+        {
+            ContourDetector threaded;
+            threaded.Init(image.Size(), threadNumbers[t]);
+
+            ContourDetector::Contours others;
+            threaded.Detect(image, others);
+
+            TEST_LOG_SS(Info, others.size() << " contours were found with " << threadNumbers[t] << " threads.");
+
+            if (!ContourDetectorCheckConnectivity(others) || !ContourDetectorCompare(contours, others, threadNumbers[t]))
+                return false;
+        }
+
         for (size_t i = 0; i < contours.size(); ++i)
         {
             for (size_t j = 1; j < contours[i].size(); ++j)
@@ -87,6 +87,8 @@ namespace Test
             result = result && CopyAutoTest(format, W - O, H + O, f1c, f2c);
         }
 
+        result = result && CopyAutoTest(View::Bgra32, W + O, int(StreamSizeMin() / W / 4) + H, f1, f2);
+
         return result;
     }
 
@@ -165,6 +167,8 @@ namespace Test
             result = result && CopyFrameAutoTest(format, W - O, H + O, f1c, f2c);
         }
 
+        result = result && CopyFrameAutoTest(View::Bgra32, W + O, int(StreamSizeMin() / W / 4) + H, f1, f2);
+
         return result;
     }
 
@@ -102,6 +102,166 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncU
+        {
+            typedef uint32_t(*FuncPtr)(uint32_t crc, const uint8_t * src, size_t stride, size_t width, size_t height);
+
+            FuncPtr func;
+            String description;
+
+            FuncU(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            uint32_t Call(uint32_t crc, const View & src) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                return func(crc, src.data, src.stride, src.width, src.height);
+            }
+        };
+    }
+
+#define FUNC_U(func) FuncU(func, #func)
+
+    bool Crc32cUpdateAutoTest(size_t width, size_t height, const FuncU & f1, const FuncU & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width + O, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+        View region = src.Region(O, 0, width + O, height);
+
+        std::vector<uint8_t> packed(width * height);
+        for (size_t row = 0; row < height; ++row)
+            memcpy(packed.data() + row * width, region.Row<uint8_t>(row), width);
+        uint32_t crc0 = SimdCrc32c(packed.data(), width), crc1, crc2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(crc1 = f1.Call(crc0, region.Region(0, 1, width, height)));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(crc2 = f2.Call(crc0, region.Region(0, 1, width, height)));
+
+        TEST_CHECK_VALUE(crc);
+
+        crc1 = SimdCrc32c(packed.data(), packed.size());
+
+        TEST_CHECK_VALUE(crc);
+
+        crc2 = SimdCrc32cCombine(crc0, SimdCrc32c(packed.data() + width, packed.size() - width), packed.size() - width);
+
+        TEST_CHECK_VALUE(crc);
+
+        return result;
+    }
+
+    bool Crc32cUpdateAutoTest(const FuncU & f1, const FuncU & f2)
+    {
+        bool result = true;
+
+        result = result && Crc32cUpdateAutoTest(W, H, f1, f2);
+        result = result && Crc32cUpdateAutoTest(W + O, H - O, f1, f2);
+        result = result && Crc32cUpdateAutoTest(W * 8 - O, H / 8, f1, f2);
+
+        return result;
+    }
+
+    bool Crc32cUpdateAutoTest()
+    {
+        bool result = true;
+
+        result = result && Crc32cUpdateAutoTest(FUNC_U(Simd::Base::Crc32cUpdate), FUNC_U(SimdCrc32cUpdate));
+
+#ifdef SIMD_SSE42_ENABLE
+        if (Simd::Sse42::Enable)
+            result = result && Crc32cUpdateAutoTest(FUNC_U(Simd::Sse42::Crc32cUpdate), FUNC_U(SimdCrc32cUpdate));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncB
+        {
+            typedef void(*FuncPtr)(const uint8_t * const * src, const size_t * size, size_t count, uint32_t * crc);
+
+            FuncPtr func;
+            String description;
+
+            FuncB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const std::vector<const uint8_t*> & src, const std::vector<size_t> & size, std::vector<uint32_t> & crc) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data(), size.data(), src.size(), crc.data());
+            }
+        };
+    }
+
+#define FUNC_B(func) FuncB(func, #func)
+
+    bool Crc32cBatchAutoTest(size_t count, size_t size, const FuncB & f1, const FuncB & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << count << " x " << size << "].");
+
+        std::vector<uint8_t> buffer(count * size);
+        SetRandom(buffer.data(), buffer.size());
+        std::vector<const uint8_t*> src(count);
+        std::vector<size_t> sizes(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            src[i] = buffer.data() + i * size + Random(int(size / 2));
+            sizes[i] = buffer.data() + (i + 1) * size - src[i] - Random(int(size / 2));
+        }
+
+        std::vector<uint32_t> crcs1(count, 0), crcs2(count, 0);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, sizes, crcs1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, sizes, crcs2));
+
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            uint32_t crc1 = crcs1[i], crc2 = crcs2[i];
+            TEST_CHECK_VALUE(crc);
+            crc2 = SimdCrc32c(src[i], sizes[i]);
+            TEST_CHECK_VALUE(crc);
+        }
+
+        return result;
+    }
+
+    bool Crc32cBatchAutoTest(const FuncB & f1, const FuncB & f2)
+    {
+        bool result = true;
+
+        result = result && Crc32cBatchAutoTest(H, W, f1, f2);
+        result = result && Crc32cBatchAutoTest(H + 1, W - O, f1, f2);
+
+        return result;
+    }
+
+    bool Crc32cBatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && Crc32cBatchAutoTest(FUNC_B(Simd::Base::Crc32cBatch), FUNC_B(SimdCrc32cBatch));
+
+#ifdef SIMD_SSE42_ENABLE
+        if (Simd::Sse42::Enable)
+            result = result && Crc32cBatchAutoTest(FUNC_B(Simd::Sse42::Crc32cBatch), FUNC_B(SimdCrc32cBatch));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool Crc32cDataTest(bool create, int size, const Func & f)
     {
         bool result = true;
@@ -27,6 +27,8 @@
 
 #include "Simd/SimdDrawing.hpp"
 
+#include <fstream>
+
 namespace Test
 {
     typedef std::map<size_t, View> Samples;
@@ -148,11 +150,12 @@ namespace Test
     FuncD(function1.func, function1.description + (tilted ? "[1]" : "[0]")), \
     FuncD(function2.func, function2.description + (tilted ? "[1]" : "[0]"))
 
-    bool DetectionDetectAutoTest(const void * data, int width, int height, int throughColumn, int int16, const FuncD & f1, const FuncD & f2)
+    bool DetectionDetectAutoTest(const void * data, int width, int height, int throughColumn, int int16, const FuncD & f1, const FuncD & f2, float adaptive)
     {
         bool result = true;
 
-        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "]"
+            << (adaptive > 0.0f ? " with adaptive step." : "."));
 
         View src = GetSample(Size(width, height), false);
         if (src.format == View::None)
@@ -193,6 +196,7 @@ namespace Test
             Simd::Integral(src, sum, sqsum);
 
         SimdDetectionPrepare(hid);
+        SimdDetectionSetAdaptiveStep(hid, adaptive);
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(hid, mask, rect, dst1));
 
@@ -208,7 +212,7 @@ namespace Test
         return result;
     }
 
-    bool DetectionDetectAutoTest(const String & path, int throughColumn, int int16, const FuncD & f1, const FuncD & f2)
+    bool DetectionDetectAutoTest(const String & path, int throughColumn, int int16, const FuncD & f1, const FuncD & f2, float adaptive)
     {
         bool result = true;
 
@@ -228,24 +232,24 @@ namespace Test
             return false;
         }
 
-        result = result && DetectionDetectAutoTest(data, W, H, throughColumn, int16, f1, f2);
-        result = result && DetectionDetectAutoTest(data, W + O, H - O, throughColumn, int16, f1, f2);
+        result = result && DetectionDetectAutoTest(data, W, H, throughColumn, int16, f1, f2, adaptive);
+        result = result && DetectionDetectAutoTest(data, W + O, H - O, throughColumn, int16, f1, f2, adaptive);
 
         SimdRelease(data);
 
         return result;
     }
 
-    bool DetectionDetectAutoTest(int lbp, int throughColumn, int int16, const FuncD & f1, const FuncD & f2)
+    bool DetectionDetectAutoTest(int lbp, int throughColumn, int int16, const FuncD & f1, const FuncD & f2, float adaptive = 0.0f)
     {
         bool result = true;
 
         if (lbp)
-            result = result && DetectionDetectAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", throughColumn, int16, f1, f2);
+            result = result && DetectionDetectAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", throughColumn, int16, f1, f2, adaptive);
         else
         {
-            result = result && DetectionDetectAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml", throughColumn, int16, ARGS_D(0, f1, f2));
-            result = result && DetectionDetectAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml", throughColumn, int16, ARGS_D(1, f1, f2));
+            result = result && DetectionDetectAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml", throughColumn, int16, ARGS_D(0, f1, f2), adaptive);
+            result = result && DetectionDetectAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml", throughColumn, int16, ARGS_D(1, f1, f2), adaptive);
         }
 
         return result;
@@ -306,6 +310,28 @@ namespace Test
             result = result && DetectionDetectAutoTest(0, 1, 0, FUNC_D(Simd::Neon::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi));
 #endif
 
+        result = result && DetectionDetectAutoTest(0, 1, 0, FUNC_D(Simd::Base::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi), 0.5f);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DetectionDetectAutoTest(0, 1, 0, FUNC_D(Simd::Sse41::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi), 0.5f);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionDetectAutoTest(0, 1, 0, FUNC_D(Simd::Avx2::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi), 0.5f);
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionDetectAutoTest(0, 1, 0, FUNC_D(Simd::Avx512bw::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi), 0.5f);
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && DetectionDetectAutoTest(0, 1, 0, FUNC_D(Simd::Neon::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi), 0.5f);
+#endif
+
         return result;
     }
 
@@ -422,6 +448,276 @@ namespace Test
             result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Neon::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii));
 #endif
 
+        result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Base::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii), 0.5f);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Sse41::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii), 0.5f);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Avx2::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii), 0.5f);
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Avx512bw::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii), 0.5f);
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Neon::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii), 0.5f);
+#endif
+
+        return result;
+    }
+
+    bool DetectionPrepareRegionAutoTest(const String & path, int throughColumn, int int16, const FuncD & f1, const FuncD & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdDetectionPrepareRegion with " << f1.description << " & " << f2.description << " for '" << path << "'.");
+
+        void * data = SimdDetectionLoadA(path.c_str());
+        if (data == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+
+        size_t w, h;
+        SimdDetectionInfoFlags flags;
+        SimdDetectionInfo(data, &w, &h, &flags);
+
+        View src = GetSample(Size(W, H), false);
+        View sum(W + 1, H + 1, View::Int32), sqsum(W + 1, H + 1, View::Int32), tilted(W + 1, H + 1, View::Int32);
+        if (flags&SimdDetectionInfoHasTilted)
+            Simd::Integral(src, sum, sqsum, tilted);
+        else
+            Simd::Integral(src, sum, sqsum);
+        View sum2(sum.Size(), View::Int32), tilted2(tilted.Size(), View::Int32);
+
+        void * hid1 = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+            sqsum.data, sqsum.stride, tilted.data, tilted.stride, throughColumn, int16);
+        void * hid2 = SimdDetectionInit(data, sum2.data, sum2.stride, sum2.width, sum2.height,
+            sqsum.data, sqsum.stride, tilted2.data, tilted2.stride, throughColumn, int16);
+        if (hid1 == NULL || hid2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't init cascade!");
+            if (hid1)
+                SimdRelease(hid1);
+            if (hid2)
+                SimdRelease(hid2);
+            SimdRelease(data);
+            return false;
+        }
+
+        Rect full(0, 0, W - w, H - h);
+        Rect rect(Simd::AlignLo(W / 5, 2), Simd::AlignLo(H / 7, 2), Simd::AlignLo(W * 2 / 3, 2), Simd::AlignLo(H * 3 / 4, 2));
+        Rect region(rect.left - 1, rect.top - 1, rect.right + w + 1, rect.bottom + h + 1);
+
+        View mask(W, H, View::Gray8), motion(W, H, View::Gray8);
+        Simd::Fill(mask, 255);
+        Simd::Fill(motion, 0);
+        Simd::Fill(motion.Region(Rect(rect.left + rect.Width() / 4, rect.top, rect.right, rect.bottom - rect.Height() / 3)).Ref(), 255);
+
+        View dst1(W, H, View::Gray8), dst2(W, H, View::Gray8), dst3(W, H, View::Gray8), dst4(W, H, View::Gray8);
+        Simd::Fill(dst1, 0);
+        Simd::Fill(dst2, 0);
+        Simd::Fill(dst3, 0);
+        Simd::Fill(dst4, 0);
+
+        SimdDetectionPrepare(hid1);
+        f1.Call(hid1, mask, full, dst1);
+
+        // Prepared data inside the region is stale before SimdDetectionPrepareRegion,
+        // while input outside the region is corrupted during it.
+        Simd::Copy(sum, sum2);
+        Simd::Copy(tilted, tilted2);
+        Simd::Fill(sum2.Region(region).Ref(), 0x5A);
+        Simd::Fill(tilted2.Region(region).Ref(), 0x5A);
+        SimdDetectionPrepare(hid2);
+        Simd::Fill(sum2, 0xA5);
+        Simd::Fill(tilted2, 0xA5);
+        Simd::Copy(sum.Region(region), sum2.Region(region).Ref());
+        Simd::Copy(tilted.Region(region), tilted2.Region(region).Ref());
+        SimdDetectionPrepareRegion(hid2, region.left, region.top, region.right, region.bottom);
+        Simd::Copy(sum, sum2);
+        Simd::Copy(tilted, tilted2);
+
+        f2.Call(hid2, mask, full, dst2);
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        f2.Call(hid2, motion, rect, dst3);
+        Simd::Copy(dst1.Region(rect), dst4.Region(rect).Ref());
+        Simd::OperationBinary8u(dst4, motion, dst4, SimdOperationBinary8uAnd);
+        result = result && Compare(dst3, dst4, 0, true, 32);
+
+        SimdRelease(hid2);
+        SimdRelease(hid1);
+        SimdRelease(data);
+
+        return result;
+    }
+
+    bool DetectionPrepareRegionAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionPrepareRegionAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml", 1, 0, FUNC_D(Simd::Base::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi));
+        result = result && DetectionPrepareRegionAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml", 1, 0, FUNC_D(Simd::Base::DetectionHaarDetect32fi), FUNC_D(SimdDetectionHaarDetect32fi));
+        result = result && DetectionPrepareRegionAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", 1, 0, FUNC_D(Simd::Base::DetectionLbpDetect32fi), FUNC_D(SimdDetectionLbpDetect32fi));
+        result = result && DetectionPrepareRegionAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", 0, 1, FUNC_D(Simd::Base::DetectionLbpDetect16ip), FUNC_D(SimdDetectionLbpDetect16ip));
+        result = result && DetectionPrepareRegionAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", 1, 1, FUNC_D(Simd::Base::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii));
+
+        return result;
+    }
+
+    // Offsets of the fields in the header of binary cascade (see Simd::Base::Binary::Header).
+    const size_t BINARY_VERSION = 4, BINARY_STAGES = 40, BINARY_HAAR_FEATURES = 60, BINARY_HEADER_SIZE = 68;
+
+    bool DetectionLoadBinaryRejected(const std::vector<uint8_t> & buffer, size_t size, size_t offset, uint32_t value, const String & description)
+    {
+        // The corrupted cascade is placed to an exactly sized buffer, so any read past the size is a read past the allocation.
+        std::vector<uint8_t> corrupted(buffer.begin(), buffer.begin() + size);
+        if (offset + sizeof(value) <= size)
+            memcpy(corrupted.data() + offset, &value, sizeof(value));
+        void * data = SimdDetectionLoadBinary(corrupted.data(), corrupted.size());
+        if (data)
+        {
+            TEST_LOG_SS(Error, "SimdDetectionLoadBinary accepts " << description << "!");
+            SimdRelease(data);
+            return false;
+        }
+        return true;
+    }
+
+    bool DetectionLoadBinaryRejected(const std::vector<uint8_t> & buffer)
+    {
+        bool result = true;
+
+        uint32_t magic, version;
+        memcpy(&magic, buffer.data(), sizeof(magic));
+        memcpy(&version, buffer.data() + BINARY_VERSION, sizeof(version));
+
+        result = result && DetectionLoadBinaryRejected(buffer, 0, 0, 0, "empty buffer");
+        result = result && DetectionLoadBinaryRejected(buffer, BINARY_HEADER_SIZE - 1, 0, magic, "truncated header");
+        result = result && DetectionLoadBinaryRejected(buffer, BINARY_HEADER_SIZE, 0, magic, "header without data");
+        result = result && DetectionLoadBinaryRejected(buffer, buffer.size() / 2, 0, magic, "truncated data");
+        result = result && DetectionLoadBinaryRejected(buffer, buffer.size() - 1, 0, magic, "truncated last feature");
+        result = result && DetectionLoadBinaryRejected(buffer, buffer.size(), 0, magic ^ 1, "bad magic");
+        result = result && DetectionLoadBinaryRejected(buffer, buffer.size(), BINARY_VERSION, version + 1, "bad version");
+        result = result && DetectionLoadBinaryRejected(buffer, buffer.size(), BINARY_STAGES, 0xFFFFFFFF, "stage count larger than buffer");
+        result = result && DetectionLoadBinaryRejected(buffer, buffer.size(), BINARY_HAAR_FEATURES, 0x7FFFFFFF, "feature count larger than buffer");
+
+        return result;
+    }
+
+    bool DetectionLoadBinaryAutoTest(const String & path)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdDetectionSaveA, SimdDetectionLoadA & SimdDetectionLoadBinary for '" << path << "'.");
+
+        void * xml = SimdDetectionLoadA(path.c_str());
+        if (xml == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+
+        String binPath = ROOT_PATH + "/detection_cascade_test.bin";
+        if (SimdDetectionSaveA(xml, binPath.c_str()) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't save cascade '" << binPath << "' !");
+            SimdRelease(xml);
+            ::remove(binPath.c_str());
+            return false;
+        }
+        void * bin = SimdDetectionLoadA(binPath.c_str());
+        std::vector<uint8_t> buffer;
+        std::ifstream ifs(binPath.c_str(), std::ios::binary);
+        if (ifs.is_open())
+            buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        ifs.close();
+        ::remove(binPath.c_str());
+        void * mem = buffer.empty() ? NULL : SimdDetectionLoadBinary(buffer.data(), buffer.size());
+        if (bin == NULL || mem == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load binary cascade '" << binPath << "' !");
+            if (bin)
+                SimdRelease(bin);
+            if (mem)
+                SimdRelease(mem);
+            SimdRelease(xml);
+            return false;
+        }
+
+        size_t w1, h1, w2, h2, w3, h3;
+        SimdDetectionInfoFlags f1, f2, f3;
+        SimdDetectionInfo(xml, &w1, &h1, &f1);
+        SimdDetectionInfo(bin, &w2, &h2, &f2);
+        SimdDetectionInfo(mem, &w3, &h3, &f3);
+        if (w1 != w2 || h1 != h2 || f1 != f2 || w1 != w3 || h1 != h3 || f1 != f3)
+        {
+            TEST_LOG_SS(Error, "Binary cascade has different parameters!");
+            result = false;
+        }
+
+        View src = GetSample(Size(W, H), false);
+        View sum(W + 1, H + 1, View::Int32), sqsum(W + 1, H + 1, View::Int32), tilted(W + 1, H + 1, View::Int32);
+        if ((f1 & SimdDetectionInfoHasTilted) != 0)
+            Simd::Integral(src, sum, sqsum, tilted);
+        else
+            Simd::Integral(src, sum, sqsum);
+
+        Rect rect(W / 9, H / 11, W - w1, H - h1);
+        View mask(W, H, View::Gray8), dst1(W, H, View::Gray8), dst2(W, H, View::Gray8), dst3(W, H, View::Gray8);
+        Simd::Fill(mask, 0);
+        Simd::Fill(mask.Region(rect).Ref(), 255);
+
+        bool haar = (f1 & SimdDetectionInfoFeatureMask) == SimdDetectionInfoFeatureHaar;
+        FuncD funcs[2] = { haar ? FUNC_D(Simd::Base::DetectionHaarDetect32fp) : FUNC_D(Simd::Base::DetectionLbpDetect32fp),
+            haar ? FUNC_D(SimdDetectionHaarDetect32fp) : FUNC_D(SimdDetectionLbpDetect32fp) };
+        void * datas[3] = { xml, bin, mem };
+        View * dsts[3] = { &dst1, &dst2, &dst3 };
+        for (size_t i = 0; result && i < 3; ++i)
+        {
+            void * hid = SimdDetectionInit(datas[i], sum.data, sum.stride, sum.width, sum.height,
+                sqsum.data, sqsum.stride, tilted.data, tilted.stride, 0, 0);
+            if (hid == NULL)
+            {
+                TEST_LOG_SS(Error, "Can't init cascade!");
+                result = false;
+                break;
+            }
+            SimdDetectionPrepare(hid);
+            Simd::Fill(*dsts[i], 0);
+            funcs[i & 1].Call(hid, mask, rect, *dsts[i]);
+            SimdRelease(hid);
+        }
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+        result = result && Compare(dst1, dst3, 0, true, 32);
+
+        result = result && DetectionLoadBinaryRejected(buffer);
+
+        SimdRelease(mem);
+        SimdRelease(bin);
+        SimdRelease(xml);
+
+        return result;
+    }
+
+    bool DetectionLoadBinaryAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionLoadBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml");
+        result = result && DetectionLoadBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml");
+        result = result && DetectionLoadBinaryAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml");
+
         return result;
     }
 
@@ -565,6 +861,283 @@ namespace Test
     typedef Simd::Detection<Simd::Allocator> Detection;
     typedef Detection::Objects Objects;
 
+    bool DetectionResizeRegionAutoTest(View::Format format, int width, int height, double scale)
+    {
+        bool result = true;
+
+        Size size(Size(width, height) / scale);
+
+        TEST_LOG_SS(Info, "Test Simd::ResizeBilinear for region of " << ColorDescription(format) << " image [" << width << ", " << height << "] -> [" << size.x << ", " << size.y << "].");
+
+        View src(width, height, format), dst1(size, format), dst2(size, format), dst3(size, format);
+        FillRandom(src);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(TEST_PERFORMANCE_TEST("Simd::Base::ResizeBilinear");
+            Simd::Base::ResizeBilinear(src.data, src.width, src.height, src.stride, dst1.data, dst1.width, dst1.height, dst1.stride, src.ChannelCount()));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(TEST_PERFORMANCE_TEST("SimdResizeBilinear");
+            SimdResizeBilinear(src.data, src.width, src.height, src.stride, dst2.data, dst2.width, dst2.height, dst2.stride, src.ChannelCount()));
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        Rect regions[] = { Rect(size.x / 5, size.y / 7, size.x * 2 / 3, size.y * 3 / 4), Rect(0, 0, size.x / 3 + 1, size.y / 2 + 1),
+            Rect(size.x / 2 - 1, size.y / 3 + 1, size.x, size.y), Rect(size.x - 1, 0, size.x, size.y), Rect(size) };
+        for (size_t i = 0; i < sizeof(regions) / sizeof(regions[0]) && result; ++i)
+        {
+            const Rect & region = regions[i];
+            Simd::Copy(dst1, dst3);
+            Simd::Fill(dst3.Region(region).Ref(), 0x5A);
+            Simd::ResizeBilinear(src, dst3, region);
+            result = result && Compare(dst1, dst3, 0, true, 32, 0, "region " + ToString(i));
+        }
+
+        return result;
+    }
+
+    bool DetectionResizeRegionAutoTest()
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && DetectionResizeRegionAutoTest(format, W, H, 1.1);
+            result = result && DetectionResizeRegionAutoTest(format, W - O, H + O, 1.7);
+            result = result && DetectionResizeRegionAutoTest(format, W + O, H - O, 2.9);
+        }
+
+        return result;
+    }
+
+    static FuncD DetectionObjectsFunc(bool haar, bool int16, bool throughColumn, bool base)
+    {
+        if (haar)
+        {
+            if (throughColumn)
+                return base ? FUNC_D(Simd::Base::DetectionHaarDetect32fi) : FUNC_D(SimdDetectionHaarDetect32fi);
+            else
+                return base ? FUNC_D(Simd::Base::DetectionHaarDetect32fp) : FUNC_D(SimdDetectionHaarDetect32fp);
+        }
+        else if (int16)
+        {
+            if (throughColumn)
+                return base ? FUNC_D(Simd::Base::DetectionLbpDetect16ii) : FUNC_D(SimdDetectionLbpDetect16ii);
+            else
+                return base ? FUNC_D(Simd::Base::DetectionLbpDetect16ip) : FUNC_D(SimdDetectionLbpDetect16ip);
+        }
+        else
+        {
+            if (throughColumn)
+                return base ? FUNC_D(Simd::Base::DetectionLbpDetect32fi) : FUNC_D(SimdDetectionLbpDetect32fi);
+            else
+                return base ? FUNC_D(Simd::Base::DetectionLbpDetect32fp) : FUNC_D(SimdDetectionLbpDetect32fp);
+        }
+    }
+
+    static bool DetectionObjectsReference(const View & src, const Strings & paths, double scaleFactor, const View & roi, const Detection::Rects & motion, Objects & objects)
+    {
+        std::vector<void*> datas;
+        std::vector<Size> sizes;
+        std::vector<SimdDetectionInfoFlags> flags;
+        bool result = true, normalization = false;
+        for (size_t i = 0; i < paths.size() && result; ++i)
+        {
+            void * data = SimdDetectionLoadA(paths[i].c_str());
+            if (data == NULL)
+            {
+                TEST_LOG_SS(Error, "Can't load cascade '" << paths[i] << "' !");
+                result = false;
+                break;
+            }
+            size_t w, h;
+            SimdDetectionInfoFlags f;
+            SimdDetectionInfo(data, &w, &h, &f);
+            datas.push_back(data);
+            sizes.push_back(Size(w, h));
+            flags.push_back(f);
+            normalization = normalization || (f & SimdDetectionInfoFeatureMask) == SimdDetectionInfoFeatureHaar;
+        }
+
+        View base(src.Size(), View::Gray8);
+        Simd::Copy(src, base);
+        if (normalization)
+            Simd::NormalizeHistogram(base, base);
+
+        // Every level is resized from the whole first level, integrated and scanned by each cascade at once.
+        // Base and API cascade functions give identical masks, so they are alternated between levels.
+        size_t index = 0;
+        for (double scale = 1.0; result; scale *= scaleFactor, index++)
+        {
+            std::vector<size_t> inserts;
+            for (size_t i = 0; i < datas.size(); ++i)
+            {
+                Size window = sizes[i] * scale;
+                if (window.x <= src.width && window.y <= src.height)
+                    inserts.push_back(i);
+            }
+            if (inserts.empty())
+                break;
+
+            Size size(src.Size() / scale);
+            View level(size, View::Gray8), mask(size, View::Gray8), dst(size, View::Gray8);
+            View sum(size + Size(1, 1), View::Int32), sqsum(size + Size(1, 1), View::Int32), tilted(size + Size(1, 1), View::Int32);
+            Simd::ResizeBilinear(base, level);
+            Simd::Integral(level, sum, sqsum, tilted);
+
+            Rect rect(size);
+            if (roi.format == View::None)
+                Simd::Fill(mask, 255);
+            else
+            {
+                Simd::ResizeBilinear(roi, mask);
+                Simd::Binarization(mask, 0, 255, 0, mask, SimdCompareGreater);
+                Simd::SegmentationShrinkRegion(mask, 255, rect);
+            }
+            if (motion.size())
+            {
+                Rect current;
+                View gate(size, View::Gray8);
+                Simd::Fill(gate, 0);
+                for (size_t i = 0; i < motion.size(); ++i)
+                {
+                    Rect r = motion[i] / scale;
+                    current |= r;
+                    Simd::Fill(gate.Region(r.Intersection(rect)).Ref(), 255);
+                }
+                Simd::OperationBinary8u(mask, gate, mask, SimdOperationBinary8uAnd);
+                rect &= current;
+            }
+            if (rect.Empty())
+                continue;
+
+            bool throughColumn = scale <= 2.0;
+            ptrdiff_t step = throughColumn ? 2 : 1;
+            for (size_t j = 0; j < inserts.size(); ++j)
+            {
+                size_t i = inserts[j];
+                bool haar = (flags[i] & SimdDetectionInfoFeatureMask) == SimdDetectionInfoFeatureHaar, int16 = (flags[i] & SimdDetectionInfoCanInt16) != 0;
+                void * hid = SimdDetectionInit(datas[i], sum.data, sum.stride, sum.width, sum.height,
+                    sqsum.data, sqsum.stride, tilted.data, tilted.stride, throughColumn, int16);
+                if (hid == NULL)
+                {
+                    TEST_LOG_SS(Error, "Can't init cascade '" << paths[i] << "' !");
+                    result = false;
+                    break;
+                }
+                FuncD f = DetectionObjectsFunc(haar, int16, throughColumn, index % 2 == 0);
+                Size s = size - sizes[i];
+                Rect area = rect.Shifted(-sizes[i] / 2).Intersection(Rect(s));
+                Simd::Fill(dst, 0);
+                SimdDetectionPrepare(hid);
+                f.Call(hid, mask.Region(s, View::MiddleCenter), area, dst);
+                SimdRelease(hid);
+
+                for (ptrdiff_t row = area.top; row < area.bottom; row += step)
+                    for (ptrdiff_t col = area.left; col < area.right; col += step)
+                        if (dst.At<uint8_t>(col, row))
+                            objects.push_back(Detection::Object(Rect(col, row, col + sizes[i].x, row + sizes[i].y) * scale, 1, Detection::Tag(i)));
+            }
+        }
+
+        for (size_t i = 0; i < datas.size(); ++i)
+            SimdRelease(datas[i]);
+
+        return result;
+    }
+
+    static bool DetectionObjectsLesser(const Detection::Object & a, const Detection::Object & b)
+    {
+        if (a.tag != b.tag)
+            return a.tag < b.tag;
+        if (a.rect.top != b.rect.top)
+            return a.rect.top < b.rect.top;
+        if (a.rect.left != b.rect.left)
+            return a.rect.left < b.rect.left;
+        if (a.rect.bottom != b.rect.bottom)
+            return a.rect.bottom < b.rect.bottom;
+        return a.rect.right < b.rect.right;
+    }
+
+    static bool DetectionObjectsCompare(Objects control, Objects current, const String & desc)
+    {
+        std::sort(control.begin(), control.end(), DetectionObjectsLesser);
+        std::sort(current.begin(), current.end(), DetectionObjectsLesser);
+        Objects missed, excess;
+        std::set_difference(control.begin(), control.end(), current.begin(), current.end(), std::back_inserter(missed), DetectionObjectsLesser);
+        std::set_difference(current.begin(), current.end(), control.begin(), control.end(), std::back_inserter(excess), DetectionObjectsLesser);
+        for (size_t i = 0; i < missed.size() + excess.size() && i < 8; ++i)
+        {
+            const Detection::Object & o = i < missed.size() ? missed[i] : excess[i - missed.size()];
+            TEST_LOG_SS(Error, desc << ": " << (i < missed.size() ? "missed" : "excess") << " object (" << o.rect.left << ", " << o.rect.top << ", "
+                << o.rect.right << ", " << o.rect.bottom << ") - " << o.tag << ", " << control.size() << " vs " << current.size() << " objects.");
+        }
+        return missed.empty() && excess.empty();
+    }
+
+    bool DetectionObjectsAutoTest(int width, int height, int threadNumber)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Detection::Detect against per level detection for size [" << width << "," << height << "] and " << threadNumber << " threads.");
+
+        Strings paths;
+        paths.push_back(ROOT_PATH + "/data/cascade/haar_face_0.xml");
+        paths.push_back(ROOT_PATH + "/data/cascade/haar_face_1.xml");
+        paths.push_back(ROOT_PATH + "/data/cascade/lbp_face.xml");
+        const double scaleFactor = 1.2;
+
+        View src = GetSample(Size(width, height), true);
+        if (src.format == View::None)
+            return false;
+
+        View roi(src.Size(), View::Gray8);
+        Simd::Fill(roi, 0);
+        Simd::Fill(roi.Region(Rect(width / 6, height / 8, width * 5 / 6, height * 7 / 8)).Ref(), 255);
+
+        Detection::Rects motion;
+        motion.push_back(Rect(width / 4, height / 4, width / 2, height * 3 / 4));
+        motion.push_back(Rect(width * 3 / 5, height / 3, width * 4 / 5, height * 5 / 6));
+
+        Detection full, masked;
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            result = result && full.Load(paths[i], Detection::Tag(i));
+            result = result && masked.Load(paths[i], Detection::Tag(i));
+        }
+        result = result && full.Init(src.Size(), scaleFactor, Size(), Size(INT_MAX, INT_MAX), View(), threadNumber);
+        result = result && masked.Init(src.Size(), scaleFactor, Size(), Size(INT_MAX, INT_MAX), roi, threadNumber);
+
+        // A negative size difference disables grouping, so every elementary detection is compared.
+        Objects control, current;
+        result = result && DetectionObjectsReference(src, paths, scaleFactor, View(), Detection::Rects(), control);
+        result = result && full.Detect(src, current, 1, -1.0);
+        result = result && DetectionObjectsCompare(control, current, "Full frame");
+
+        control.clear(), current.clear();
+        result = result && DetectionObjectsReference(src, paths, scaleFactor, roi, Detection::Rects(), control);
+        result = result && masked.Detect(src, current, 1, -1.0);
+        result = result && DetectionObjectsCompare(control, current, "ROI");
+
+        control.clear(), current.clear();
+        result = result && DetectionObjectsReference(src, paths, scaleFactor, View(), motion, control);
+        result = result && full.Detect(src, current, 1, -1.0, true, motion);
+        result = result && DetectionObjectsCompare(control, current, "Motion");
+
+        control.clear(), current.clear();
+        result = result && DetectionObjectsReference(src, paths, scaleFactor, roi, motion, control);
+        result = result && masked.Detect(src, current, 1, -1.0, true, motion);
+        result = result && DetectionObjectsCompare(control, current, "ROI and motion");
+
+        return result;
+    }
+
+    bool DetectionObjectsAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionObjectsAutoTest(W / 2, H / 2, 1);
+        result = result && DetectionObjectsAutoTest(W / 2, H / 2, -1);
+
+        return result;
+    }
+
     static void DetectionSpecialTest(Detection & detection, Objects & objects, int threadNumber)
     {
         View src = GetSample(Size(W, H), true);
@@ -78,11 +78,29 @@ namespace Test
                 func((float*)a.data, (float*)b.data, a.width, sum);
             }
         };
+
+        struct FuncMxN
+        {
+            typedef void(*FuncPtr)(size_t M, size_t N, size_t K, const uint8_t * A, size_t aStride,
+                const uint8_t * B, size_t bStride, uint32_t threshold, uint32_t * sums);
+
+            FuncPtr func;
+            String description;
+
+            FuncMxN(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & a, const View & b, uint32_t threshold, Sums & sums) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(a.height, b.height, a.width, a.data, a.stride, b.data, b.stride, threshold, sums.data());
+            }
+        };
     }
 
 #define FUNC_S(function) FuncS(function, #function)
 #define FUNC_M(function) FuncM(function, #function)
 #define FUNC_F(function) FuncF(function, #function)
+#define FUNC_MXN(function) FuncMxN(function, #function)
 
     bool DifferenceSumsAutoTest(int width, int height, const FuncS & f1, const FuncS & f2, int count)
     {
@@ -265,6 +283,78 @@ namespace Test
         return result;
     }
 
+    bool SquaredDifferenceSumsMxN8uAutoTest(size_t M, size_t N, size_t K, const FuncMxN & f1, const FuncMxN & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << M << ", " << N << ", " << K << "].");
+
+        View a(K, M, View::Gray8, NULL, TEST_ALIGN(K));
+        FillRandom(a);
+
+        View b(K, N, View::Gray8, NULL, TEST_ALIGN(K));
+        FillRandom(b);
+
+        uint32_t threshold = uint32_t(K*10922);
+
+        Sums s1(M*N, 0), s2(M*N, 0);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(a, b, threshold, s1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(a, b, threshold, s2));
+
+        result = Compare(s1, s2, 0, true, 32);
+
+        if (result)
+        {
+            f1.Call(a, b, UINT32_MAX, s1);
+            f2.Call(a, b, UINT32_MAX, s2);
+            result = Compare(s1, s2, 0, true, 32);
+        }
+
+        return result;
+    }
+
+    bool SquaredDifferenceSumsMxN8uAutoTest(const FuncMxN & f1, const FuncMxN & f2)
+    {
+        bool result = true;
+
+        result = result && SquaredDifferenceSumsMxN8uAutoTest(1, 4096, 256, f1, f2);
+        result = result && SquaredDifferenceSumsMxN8uAutoTest(1, 4095, 16, f1, f2);
+        result = result && SquaredDifferenceSumsMxN8uAutoTest(63, 65, 1024 + O, f1, f2);
+
+        return result;
+    }
+
+    bool SquaredDifferenceSumsMxN8uAutoTest()
+    {
+        bool result = true;
+
+        result = result && SquaredDifferenceSumsMxN8uAutoTest(FUNC_MXN(Simd::Base::SquaredDifferenceSumsMxN8u), FUNC_MXN(SimdSquaredDifferenceSumsMxN8u));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SquaredDifferenceSumsMxN8uAutoTest(FUNC_MXN(Simd::Avx2::SquaredDifferenceSumsMxN8u), FUNC_MXN(SimdSquaredDifferenceSumsMxN8u));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SquaredDifferenceSumsMxN8uAutoTest(FUNC_MXN(Simd::Avx512bw::SquaredDifferenceSumsMxN8u), FUNC_MXN(SimdSquaredDifferenceSumsMxN8u));
+#endif 
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && SquaredDifferenceSumsMxN8uAutoTest(FUNC_MXN(Simd::Avx512vnni::SquaredDifferenceSumsMxN8u), FUNC_MXN(SimdSquaredDifferenceSumsMxN8u));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SquaredDifferenceSumsMxN8uAutoTest(FUNC_MXN(Simd::Neon::SquaredDifferenceSumsMxN8u), FUNC_MXN(SimdSquaredDifferenceSumsMxN8u));
+#endif 
+
+        return result;
+    }
+
     bool AbsDifferenceSumAutoTest()
     {
         bool result = true;
@@ -85,6 +85,8 @@ namespace Test
             result = result && FillAutoTest(format, W + O, H - O, f1c, f2c);
         }
 
+        result = result && FillAutoTest(View::Bgra32, W + O, int(StreamSizeMin() / W / 4) + H, f1, f2);
+
         return result;
     }
 
@@ -223,6 +225,7 @@ namespace Test
 
         result = result && FillBgraAutoTest(W, H, f1, f2);
         result = result && FillBgraAutoTest(W + O, H - O, f1, f2);
+        result = result && FillBgraAutoTest(W + O, int(StreamSizeMin() / W / 4) + H, f1, f2);
 
         return result;
     }
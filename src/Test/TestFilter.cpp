@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdGaussianBlur.h"
+
 namespace Test
 {
     namespace
@@ -302,6 +304,200 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncGB
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t channels, const float * radius);
+
+            FuncPtr func;
+            String description;
+
+            FuncGB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t channels, float sigma)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << "-" << sigma << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, float sigma) const
+            {
+                void * filter = func(src.width / (src.format == View::Float ? channels : 1), src.height, channels, &sigma);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_GB(function) \
+    FuncGB(function, std::string(#function))
+
+    bool GaussianBlurAutoTest(View::Format format, size_t channels, int width, int height, float sigma, FuncGB f1, FuncGB f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, sigma);
+        f2.Update(channels, sigma);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        if (format == View::Float)
+            width *= (int)channels;
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, sigma));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, sigma));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceRelative);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool GaussianBlurAutoTest(const FuncGB & f1, const FuncGB & f2, bool float32)
+    {
+        bool result = true;
+
+        for (float sigma = 1.0f; sigma < 20.0f; sigma *= 3.0f)
+        {
+            if (float32)
+            {
+                result = result && GaussianBlurAutoTest(View::Float, 1, W, H, sigma, f1, f2);
+                result = result && GaussianBlurAutoTest(View::Float, 3, W - O, H + O, sigma, f1, f2);
+            }
+            else
+            {
+                result = result && GaussianBlurAutoTest(View::Gray8, 1, W, H, sigma, f1, f2);
+                result = result && GaussianBlurAutoTest(View::Uv16, 2, W + O, H - O, sigma, f1, f2);
+                result = result && GaussianBlurAutoTest(View::Bgr24, 3, W - O, H + O, sigma, f1, f2);
+                result = result && GaussianBlurAutoTest(View::Bgra32, 4, W, H, sigma, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    void GaussianBlurReference(const View & src, size_t channels, float sigma, View & dst)
+    {
+        const ptrdiff_t width = src.width / (src.format == View::Float ? channels : 1), height = src.height;
+        const ptrdiff_t radius = (ptrdiff_t)::ceil(4.0f * sigma);
+        std::vector<double> kernel(2 * radius + 1);
+        double sum = 0;
+        for (ptrdiff_t k = -radius; k <= radius; ++k)
+            sum += kernel[k + radius] = ::exp(-double(k * k) / (2.0 * sigma * sigma));
+        for (ptrdiff_t y = 0; y < height; ++y)
+        {
+            for (ptrdiff_t x = 0; x < width; ++x)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    double value = 0;
+                    for (ptrdiff_t dy = -radius; dy <= radius; ++dy)
+                    {
+                        ptrdiff_t sy = Simd::RestrictRange<ptrdiff_t>(y + dy, 0, height - 1);
+                        for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                        {
+                            size_t sx = Simd::RestrictRange<ptrdiff_t>(x + dx, 0, width - 1) * channels + c;
+                            double s = src.format == View::Float ? src.At<float>(sx, sy) : src.At<uint8_t>(sx, sy);
+                            value += kernel[dy + radius] * kernel[dx + radius] * s;
+                        }
+                    }
+                    dst.At<float>(x * channels + c, y) = float(value / (sum * sum));
+                }
+            }
+        }
+    }
+
+    bool GaussianBlurReferenceTest(View::Format format, size_t channels, int width, int height, float sigma, FuncGB f)
+    {
+        bool result = true;
+
+        f.Update(channels, sigma);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " with direct convolution [" << width << ", " << height << "].");
+
+        if (format == View::Float)
+            width *= (int)channels;
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        if (format == View::Float)
+            FillRandom32f(src, 0.0f, 255.0f);
+        else
+            FillRandom(src);
+
+        View dst(width, height, format, NULL, TEST_ALIGN(width));
+        f.Call(src, dst, channels, sigma);
+
+        View control(width * (format == View::Float ? 1 : channels), height, View::Float);
+        GaussianBlurReference(src, channels, sigma, control);
+
+        // The recursive filter for sigma > 3 only approximates Gaussian kernel.
+        const float eps = (sigma > 3.0f ? 4.0f : 0.1f) + (format == View::Float ? 0.0f : 0.5f);
+        for (size_t y = 0; y < control.height && result; ++y)
+        {
+            for (size_t x = 0; x < control.width && result; ++x)
+            {
+                float value = format == View::Float ? dst.At<float>(x, y) : dst.data[y * dst.stride + x];
+                if (::fabs(value - control.At<float>(x, y)) > eps)
+                {
+                    TEST_LOG_SS(Error, "Error at [" << x << ", " << y << "]: " << value << " != " << control.At<float>(x, y) << " !");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool GaussianBlurReferenceTest(const FuncGB & f8u, const FuncGB & f32f)
+    {
+        bool result = true;
+
+        for (float sigma = 0.7f; sigma < 20.0f; sigma *= 2.5f)
+        {
+            result = result && GaussianBlurReferenceTest(View::Gray8, 1, 67, 45, sigma, f8u);
+            result = result && GaussianBlurReferenceTest(View::Bgr24, 3, 45, 67, sigma, f8u);
+            result = result && GaussianBlurReferenceTest(View::Float, 1, 67, 45, sigma, f32f);
+            result = result && GaussianBlurReferenceTest(View::Float, 3, 45, 67, sigma, f32f);
+        }
+
+        return result;
+    }
+
+    bool GaussianBlurAutoTest()
+    {
+        bool result = true;
+
+        result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit), false);
+        result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit32f), FUNC_GB(SimdGaussianBlurInit32f), true);
+        result = result && GaussianBlurReferenceTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(Simd::Base::GaussianBlurInit32f));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+        {
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx2::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit), false);
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx2::GaussianBlurInit32f), FUNC_GB(SimdGaussianBlurInit32f), true);
+            result = result && GaussianBlurReferenceTest(FUNC_GB(Simd::Avx2::GaussianBlurInit), FUNC_GB(Simd::Avx2::GaussianBlurInit32f));
+        }
+#endif 
+
+        return result;
+    }
+
     namespace
     {
         struct FuncG
@@ -404,6 +404,128 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    typedef std::vector<uint16_t> F16Vector;
+
+    struct FuncCDT
+    {
+        typedef void(*FuncPtr)(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, const float * bSquares, size_t topK, uint32_t * indices, float * distances);
+
+        FuncPtr func;
+        String desc;
+
+        FuncCDT(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+        void Update(size_t M, size_t N, size_t K, size_t topK)
+        {
+            desc = desc + "[" + ToString(M) + "-" + ToString(N) + "-" + ToString(K) + "-" + ToString(topK) + "]";
+        }
+
+        void Call(size_t M, size_t N, size_t K, const F16Vector & A, const F16Vector & B, const float * bSquares, size_t topK, Tensor<uint32_t> & I, Tensor32f & D) const
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            func(M, N, K, A.data(), B.data(), bSquares, topK, I.Data(), D.Data());
+        }
+    };
+
+#define FUNC_CDT(function) FuncCDT(function, #function)
+
+    bool CosineDistancesTopK16fAutoTest(size_t M, size_t N, size_t K, size_t topK, float eps, FuncCDT f1, FuncCDT f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, topK);
+        f2.Update(M, N, K, topK);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Tensor32f Af({ M, K });
+        FillRandom(Af, -1.0, 1.0);
+        F16Vector A(M * K);
+        ::SimdFloat32ToFloat16(Af.Data(), M * K, A.data());
+
+        Tensor32f Bf({ N, K });
+        FillRandom(Bf, -1.0, 1.0);
+        F16Vector B(N * K);
+        ::SimdFloat32ToFloat16(Bf.Data(), N * K, B.data());
+
+        Tensor<uint32_t> I1({ M, topK }), I2({ M, topK });
+        Tensor32f D1({ M, topK }), D2({ M, topK });
+
+        Tensor32f S1({ N }), S2({ N });
+        Simd::Base::SquareSums16f(N, K, B.data(), S1.Data());
+        ::SimdSquareSums16f(N, K, B.data(), S2.Data());
+        result = result && Compare(S1, S2, eps, true, 32, DifferenceRelative, "squares");
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, A, B, NULL, topK, I1, D1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, A, B, S2.Data(), topK, I2, D2));
+
+        result = result && Compare(D1, D2, eps, true, 32, DifferenceAbsolute);
+
+        for (size_t i = 0; i < M && result; ++i)
+        {
+            for (size_t t = 0; t < topK && result; ++t)
+            {
+                uint32_t index = I2.Data()[i * topK + t];
+                float distance = D2.Data()[i * topK + t];
+                if (t < N)
+                {
+                    float control;
+                    ::SimdCosineDistance16f(A.data() + i * K, B.data() + index * K, K, &control);
+                    if (index >= N || ::fabs(control - distance) > eps || (t && distance < D2.Data()[i * topK + t - 1]))
+                    {
+                        TEST_LOG_SS(Error, "Wrong result [" << i << ", " << t << "]: index = " << index << ", distance = " << distance << ", control = " << control << " !");
+                        result = false;
+                    }
+                }
+                else if (index != UINT32_MAX || distance != FLT_MAX)
+                {
+                    TEST_LOG_SS(Error, "Wrong padding [" << i << ", " << t << "]: index = " << index << ", distance = " << distance << " !");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool CosineDistancesTopK16fAutoTest(float eps, const FuncCDT & f1, const FuncCDT & f2)
+    {
+        bool result = true;
+
+        result = result && CosineDistancesTopK16fAutoTest(16, 4000, 512, 10, eps, f1, f2);
+        result = result && CosineDistancesTopK16fAutoTest(7, 1001, 127, 5, eps, f1, f2);
+        result = result && CosineDistancesTopK16fAutoTest(3, 5, 64, 8, eps, f1, f2);
+
+        return result;
+    }
+
+    bool CosineDistancesTopK16fAutoTest()
+    {
+        bool result = true;
+
+        result = result && CosineDistancesTopK16fAutoTest(EPS, FUNC_CDT(Simd::Base::CosineDistancesTopK16f), FUNC_CDT(SimdCosineDistancesTopK16f));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && CosineDistancesTopK16fAutoTest(EPS, FUNC_CDT(Simd::Avx2::CosineDistancesTopK16f), FUNC_CDT(SimdCosineDistancesTopK16f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && CosineDistancesTopK16fAutoTest(EPS, FUNC_CDT(Simd::Avx512bw::CosineDistancesTopK16f), FUNC_CDT(SimdCosineDistancesTopK16f));
+#endif
+
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+        if (Simd::Neon::Enable)
+            result = result && CosineDistancesTopK16fAutoTest(EPS, FUNC_CDT(Simd::Neon::CosineDistancesTopK16f), FUNC_CDT(SimdCosineDistancesTopK16f));
+#endif
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool Float32ToFloat16DataTest(bool create, size_t size, const FuncSH & f)
     {
         bool result = true;
@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdHogCache.hpp"
+
 namespace Test
 {
     namespace
@@ -614,4 +616,59 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    bool HogCacheSpecialTest()
+    {
+        typedef Simd::HogCache<Simd::Allocator> HogCache;
+
+        bool result = true;
+
+        Size size(W, H), cell(8, 8);
+        const size_t quantization = 18;
+        View frame(size, View::Gray8);
+        FillRandom(frame);
+
+        HogCache cache;
+        if (!cache.Init(size, cell, quantization))
+        {
+            TEST_LOG_SS(Error, "Can't init HogCache for [" << W << ", " << H << "]!");
+            return false;
+        }
+        Rect grid(cache.Cells());
+        View crop = frame.Region(Rect(0, 0, grid.Width() * cell.x, grid.Height() * cell.y));
+        Buffer32f control(grid.Area() * quantization), cached(grid.Area() * quantization);
+
+        double time = GetTime();
+        cache.Update(frame);
+        TEST_LOG_SS(Info, "Full update: " << (GetTime() - time) * 1000 << " ms.");
+
+        SimdHogDirectionHistograms(crop.data, crop.stride, crop.width, crop.height, cell.x, cell.y, quantization, control.data());
+        cache.Histograms(grid, cached.data());
+        result = result && Compare(control, cached, EPS, true, 32, true, "full update");
+
+        View mask(size, View::Gray8);
+        Simd::Fill(mask, 0);
+        Rect motion(W / 3 + 3, H / 3 + 5, W / 2 + 1, H / 2 - 2);
+        FillRandom(frame.Region(motion).Ref());
+        Simd::Fill(mask.Region(motion).Ref(), 255);
+
+        time = GetTime();
+        cache.Update(frame, mask);
+        TEST_LOG_SS(Info, "Masked update: " << (GetTime() - time) * 1000 << " ms.");
+
+        SimdHogDirectionHistograms(crop.data, crop.stride, crop.width, crop.height, cell.x, cell.y, quantization, control.data());
+        cache.Histograms(grid, cached.data());
+        result = result && Compare(control, cached, EPS, true, 32, true, "masked update");
+
+        Rect roi = cache.ToCells(Rect(W / 4, H / 4, W / 4 + 64, H / 4 + 128));
+        Buffer32f blocks(cache.BlocksSize(roi));
+        time = GetTime();
+        for (int i = 0; i < 100; ++i)
+            cache.Blocks(roi, blocks.data());
+        TEST_LOG_SS(Info, "Blocks of [" << roi.Width() << ", " << roi.Height() << "] cells: " << (GetTime() - time) * 10 << " ms.");
+
+        return result;
+    }
 }
@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdHogDetector.hpp"
+
 namespace Test
 {
     void FillCircle(View & view)
@@ -1131,4 +1133,79 @@ namespace Test
     {
         return HogLiteCreateMaskDataTest(create, DW, DH, 7, 2, 0.5f, FUNC_HLCM(SimdHogLiteCreateMask));
     }
+
+    //-----------------------------------------------------------------------
+
+    typedef Simd::HogDetector<Simd::Allocator> HogDetector;
+
+    static bool HogDetectorSpecialTest(HogDetector & detector, const View & src, HogDetector::Objects & objects, int threadNumber)
+    {
+        if (!detector.Init(src.Size(), 8, 1.2, threadNumber))
+        {
+            TEST_LOG_SS(Error, "Can't init HogDetector for " << threadNumber << " threads!");
+            return false;
+        }
+        detector.Detect(src, objects, 0.0f, 0.3);
+
+        double time = GetTime();
+        for (size_t i = 0; i < 10; ++i)
+            detector.Detect(src, objects, 0.0f, 0.3);
+        TEST_LOG_SS(Info, "Detect for " << threadNumber << " : " << (GetTime() - time) * 100 << " ms, " << objects.size() << " objects.");
+        return true;
+    }
+
+    bool HogDetectorSpecialTest()
+    {
+        String path = ROOT_PATH + "/data/image/face/lena.pgm";
+        View src;
+        if (!src.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load test image '" << path << "' !");
+            return false;
+        }
+
+        const size_t cell = 8, fw = 8, fh = 10, fx = 20, fy = 20, fs = HogDetector::FEATURE_SIZE;
+        size_t stride = (src.width / cell - 2) * fs, height = src.height / cell - 2;
+        std::vector<float> features(height * stride);
+        SimdHogLiteExtractFeatures(src.data, src.stride, src.width, src.height, cell, features.data(), stride);
+
+        std::vector<float> sample(fh * fw * fs), filter(fh * fw * fs);
+        float mean = 0, sum = 0;
+        for (size_t y = 0; y < fh; ++y)
+            for (size_t x = 0; x < fw * fs; ++x)
+                mean += (sample[y * fw * fs + x] = features[(fy + y) * stride + fx * fs + x]);
+        mean /= float(sample.size());
+        for (size_t i = 0; i < sample.size(); ++i)
+            sum += (filter[i] = sample[i] - mean) * sample[i];
+
+        HogDetector detector;
+        detector.SetFilter(filter.data(), fw, fh, -0.5f * sum);
+
+        HogDetector::Objects os, om;
+        bool result = HogDetectorSpecialTest(detector, src, os, 1);
+        result = result && HogDetectorSpecialTest(detector, src, om, 4);
+
+        Rect expected((fx + 1) * cell, (fy + 1) * cell, (fx + fw + 1) * cell, (fy + fh + 1) * cell);
+        if (result && (os.empty() || os[0].rect != expected))
+        {
+            TEST_LOG_SS(Error, "HogDetector can't find the sample at " << expected.left << ", " << expected.top << " !");
+            result = false;
+        }
+
+        if (result && os.size() != om.size())
+        {
+            TEST_LOG_SS(Error, "Different number of objects: " << os.size() << " != " << om.size() << " !");
+            result = false;
+        }
+        for (size_t i = 0; i < os.size() && result; ++i)
+        {
+            if (os[i].rect != om[i].rect || os[i].score != om[i].score || os[i].weight != om[i].weight)
+            {
+                TEST_LOG_SS(Error, "Objects [" << i << "] are different for 1 and 4 threads!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
 }
@@ -33,6 +33,8 @@
 
 #include "Simd/SimdImageMatcher.hpp"
 
+#include <thread>
+
 namespace Test
 {
     typedef Simd::ImageMatcher<size_t, Simd::Allocator> ImageMatcher;
@@ -96,8 +98,8 @@ namespace Test
         return true;
     }
 
-    const size_t g_numbers[] = { 200, 2000, 20000 };
-    const char * g_names[] = { "D0", "D1", "D3" };
+    const size_t g_numbers[] = { 200, 2000, 20000, 200000 };
+    const char * g_names[] = { "D0", "D1", "D3", "DI" };
 
     void PerformFiltration(const ViewPtrs & src, size_t size, double threshold, size_t type, bool normalized, Indexes & dst)
     {
@@ -121,6 +123,44 @@ namespace Test
         TEST_LOG_SS(Info, "Filtration performance for " << g_names[type] << " : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
     }
 
+    // Find must be safe to call from several threads at once, so the matches found concurrently are compared with sequential ones.
+    bool PerformConcurrentFind(const ViewPtrs & src, const Indexes & added, double threshold, size_t type, bool normalized, size_t threads)
+    {
+        ImageMatcher matcher;
+        matcher.Init(threshold, ImageMatcher::Hash16x16, g_numbers[type], normalized);
+        std::vector<ImageMatcher::HashPtr> hashes(src.size());
+        for (size_t i = 0; i < src.size(); ++i)
+            hashes[i] = matcher.Create(*src[i], i);
+        for (size_t i = 0; i < added.size(); ++i)
+            matcher.Add(hashes[added[i]]);
+
+        Indexes control(src.size()), counts(src.size());
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            ImageMatcher::Results results;
+            matcher.Find(hashes[i], results);
+            control[i] = (uint32_t)results.size();
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.push_back(std::thread([&matcher, &hashes, &counts, t, threads]()
+            {
+                ImageMatcher::Results results;
+                for (size_t i = t; i < hashes.size(); i += threads)
+                {
+                    matcher.Find(hashes[i], results);
+                    counts[i] = (uint32_t)results.size();
+                }
+            }));
+        }
+        for (size_t t = 0; t < threads; ++t)
+            workers[t].join();
+
+        return Compare(control, counts, 0, true, 32, String(g_names[type]) + " concurrent");
+    }
+
     bool ImageMatcherSpecialTest()
     {
         bool result = true;
@@ -147,10 +187,17 @@ namespace Test
         Indexes is2;
         PerformFiltration(samples, size.x, threshold, 2, normalized, is2);
 
+        Indexes is3;
+        PerformFiltration(samples, size.x, threshold, 3, normalized, is3);
+
         result = Compare(is0, is1, 0, true, 0, "D1");
 
         result = Compare(is1, is2, 0, true, 0, "D3");
 
+        result = result && Compare(is0, is3, 0, true, 0, "DI");
+
+        result = result && PerformConcurrentFind(samples, is3, threshold, 3, normalized, 4);
+
         return result;
     }
 }
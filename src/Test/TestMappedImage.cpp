@@ -0,0 +1,290 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+#include "Simd/SimdMappedImage.hpp"
+
+#include <fstream>
+#include <cstdio>
+
+namespace Test
+{
+    typedef Simd::MappedImage<Simd::Allocator> MappedImage;
+    typedef std::vector<uint8_t> Bytes;
+
+    static bool WriteFile(const String & path, const Bytes & bytes)
+    {
+        std::ofstream ofs(path.c_str(), std::ofstream::binary);
+        ofs.write((const char*)bytes.data(), bytes.size());
+        return (bool)ofs;
+    }
+
+    static void AppendString(Bytes & bytes, const String & str)
+    {
+        bytes.insert(bytes.end(), str.begin(), str.end());
+    }
+
+    static void AppendValue(Bytes & bytes, uint32_t value, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+            bytes.push_back(uint8_t(value >> (8 * i)));
+    }
+
+    static void AppendRows(Bytes & bytes, const View & image, size_t stride)
+    {
+        for (size_t row = 0; row < image.height; ++row)
+        {
+            const uint8_t * p = image.data + row * image.stride;
+            bytes.insert(bytes.end(), p, p + image.width * image.PixelSize());
+            bytes.insert(bytes.end(), stride - image.width * image.PixelSize(), 0);
+        }
+    }
+
+    static Bytes MakePnm(const View & image)
+    {
+        Bytes bytes;
+        AppendString(bytes, image.format == View::Gray8 ? "P5\n" : "P6\n");
+        AppendString(bytes, "# width\n" + ToString(image.width) + "\n# height\n" + ToString(image.height) + " # maximal value\n255\n");
+        AppendRows(bytes, image, image.width * image.PixelSize());
+        return bytes;
+    }
+
+    static Bytes MakeBmp(const View & image, bool topDown)
+    {
+        size_t bitCount = image.PixelSize() * 8, stride = Simd::AlignHi(image.width * image.PixelSize(), 4);
+        size_t palette = image.format == View::Gray8 ? 256 * 4 : 0, offset = 14 + 40 + palette;
+        Bytes bytes;
+        AppendString(bytes, "BM");
+        AppendValue(bytes, uint32_t(offset + stride * image.height), 4);
+        AppendValue(bytes, 0, 4);
+        AppendValue(bytes, uint32_t(offset), 4);
+        AppendValue(bytes, 40, 4);
+        AppendValue(bytes, uint32_t(image.width), 4);
+        AppendValue(bytes, uint32_t(topDown ? -int32_t(image.height) : int32_t(image.height)), 4);
+        AppendValue(bytes, 1, 2);
+        AppendValue(bytes, uint32_t(bitCount), 2);
+        AppendValue(bytes, 0, 4);
+        AppendValue(bytes, uint32_t(stride * image.height), 4);
+        AppendValue(bytes, 2835, 4);
+        AppendValue(bytes, 2835, 4);
+        AppendValue(bytes, palette ? 256 : 0, 4);
+        AppendValue(bytes, 0, 4);
+        for (size_t i = 0; i < palette / 4; ++i)
+            AppendValue(bytes, uint32_t(i * 0x010101), 4);
+        AppendRows(bytes, topDown ? image : image.Flipped(), stride);
+        return bytes;
+    }
+
+    static bool CheckMapped(const String & path, const View & expected, bool flipped)
+    {
+        MappedImage mapped;
+        if (!mapped.Open(path))
+        {
+            TEST_LOG_SS(Error, "Can't map image '" << path << "'!");
+            return false;
+        }
+        if (!Simd::Compatible(mapped.Image(), expected) || (mapped.Image().stride < 0) != flipped)
+        {
+            TEST_LOG_SS(Error, "Mapped image '" << path << "' has wrong size, format or orientation!");
+            return false;
+        }
+        return Compare(mapped.Image(), expected, 0, true, 32, 0, path);
+    }
+
+    static bool CheckTruncated(const String & path, Bytes bytes, size_t cut)
+    {
+        bytes.resize(bytes.size() - cut);
+        if (!WriteFile(path, bytes))
+            return false;
+        MappedImage mapped;
+        View loaded;
+        if (mapped.Open(path) || mapped.Image().data)
+        {
+            TEST_LOG_SS(Error, "Truncated image '" << path << "' is mapped!");
+            return false;
+        }
+        if (path.find(".bmp") == String::npos && loaded.Load(path))
+        {
+            TEST_LOG_SS(Error, "Truncated image '" << path << "' is loaded!");
+            return false;
+        }
+        return true;
+    }
+
+    bool ViewLoadSaveAutoTest(int width, int height)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test View::Save and View::Load for size [" << width << "," << height << "].");
+
+        View gray(width, height, View::Gray8), bgr(width, height, View::Bgr24), bgra(width, height, View::Bgra32);
+        FillRandom(gray);
+        FillRandom(bgr);
+        FillRandom(bgra);
+
+        View loaded, expected(width, height, View::Bgra32);
+        result = result && gray.Save("_test_gray.pgm") && loaded.Load("_test_gray.pgm");
+        result = result && Compare(gray, loaded, 0, true, 32, 0, "Gray8");
+
+        result = result && bgr.Save("_test_bgr.ppm") && loaded.Load("_test_bgr.ppm");
+        Simd::BgrToBgra(bgr, expected, 0xFF);
+        result = result && Compare(expected, loaded, 0, true, 32, 0, "Bgr24");
+
+        result = result && bgra.Save("_test_bgra.ppm") && loaded.Load("_test_bgra.ppm");
+        Simd::BgraToBgr(bgra, bgr);
+        Simd::BgrToBgra(bgr, expected, 0xFF);
+        result = result && Compare(expected, loaded, 0, true, 32, 0, "Bgra32");
+
+        result = result && WriteFile("_test_comment.pgm", MakePnm(gray)) && loaded.Load("_test_comment.pgm");
+        result = result && Compare(gray, loaded, 0, true, 32, 0, "Gray8 with comments");
+
+        std::remove("_test_gray.pgm");
+        std::remove("_test_bgr.ppm");
+        std::remove("_test_bgra.ppm");
+        std::remove("_test_comment.pgm");
+
+        return result;
+    }
+
+    bool MappedImageAutoTest(int width, int height)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::MappedImage for size [" << width << "," << height << "].");
+
+        View gray(width, height, View::Gray8), rgb(width, height, View::Rgb24), bgr(width, height, View::Bgr24), bgra(width, height, View::Bgra32);
+        FillRandom(gray);
+        FillRandom(rgb);
+        FillRandom(bgr);
+        FillRandom(bgra);
+
+        Bytes pgm = MakePnm(gray), ppm = MakePnm(rgb), bmp8 = MakeBmp(gray, false), bmp24 = MakeBmp(bgr, false), bmp32 = MakeBmp(bgra, false);
+
+        result = result && WriteFile("_test_mapped.pgm", pgm) && CheckMapped("_test_mapped.pgm", gray, false);
+        result = result && WriteFile("_test_mapped.ppm", ppm) && CheckMapped("_test_mapped.ppm", rgb, false);
+        result = result && WriteFile("_test_mapped_8.bmp", bmp8) && CheckMapped("_test_mapped_8.bmp", gray, true);
+        result = result && WriteFile("_test_mapped_24.bmp", bmp24) && CheckMapped("_test_mapped_24.bmp", bgr, true);
+        result = result && WriteFile("_test_mapped_24t.bmp", MakeBmp(bgr, true)) && CheckMapped("_test_mapped_24t.bmp", bgr, false);
+        result = result && WriteFile("_test_mapped_32.bmp", bmp32) && CheckMapped("_test_mapped_32.bmp", bgra, true);
+        result = result && WriteFile("_test_mapped_32t.bmp", MakeBmp(bgra, true)) && CheckMapped("_test_mapped_32t.bmp", bgra, false);
+
+        if (result)
+        {
+            const size_t offset = 17, stride = width * 3 + 5;
+            Bytes raw(offset, 0x5A);
+            AppendRows(raw, bgr, stride);
+            MappedImage mapped;
+            result = result && WriteFile("_test_mapped.raw", raw) && mapped.Open("_test_mapped.raw", width, height, View::Bgr24, stride, offset);
+            result = result && Compare(mapped.Image(), bgr, 0, true, 32, 0, "raw");
+            if (mapped.Open("_test_mapped.raw", width, height + 1, View::Bgr24, stride, offset))
+            {
+                TEST_LOG_SS(Error, "Raw image larger than the file is mapped!");
+                result = false;
+            }
+            if (mapped.Open("_test_mapped.raw", width, height, View::Bgr24, stride, size_t(-1) - stride) ||
+                mapped.Open("_test_mapped.raw", width, (size_t(1) << (sizeof(size_t) * 8 - 1)) / stride * 2 + 1, View::Bgr24, stride, offset))
+            {
+                TEST_LOG_SS(Error, "Raw image with overflowing size is mapped!");
+                result = false;
+            }
+        }
+
+        result = result && CheckTruncated("_test_truncated.pgm", pgm, 1);
+        result = result && CheckTruncated("_test_truncated.ppm", ppm, 1);
+        result = result && CheckTruncated("_test_truncated.bmp", bmp24, 1);
+        result = result && CheckTruncated("_test_truncated.bmp", bmp8, bmp8.size() - 14 - 40 - 100);
+
+        if (result && sizeof(size_t) == 8)
+        {
+            Bytes huge;
+            AppendString(huge, "P5\n4294967296 4294967296\n255\n");
+            huge.resize(huge.size() + 64, 0);
+            MappedImage mapped;
+            if (!WriteFile("_test_truncated.pgm", huge) || mapped.Open("_test_truncated.pgm"))
+            {
+                TEST_LOG_SS(Error, "Image with overflowing size is mapped!");
+                result = false;
+            }
+        }
+
+        if (result)
+        {
+            std::vector<String> paths = { "_test_mapped.pgm", "_test_mapped.ppm", "_test_mapped_24.bmp", "_test_mapped_32t.bmp" };
+            std::vector<MappedImage> images(paths.size());
+            if (Simd::OpenMappedImages(paths, images.data(), 3))
+            {
+                result = result && Compare(images[0].Image(), gray, 0, true, 32, 0, "OpenMappedImages");
+                result = result && Compare(images[1].Image(), rgb, 0, true, 32, 0, "OpenMappedImages");
+                result = result && Compare(images[2].Image(), bgr, 0, true, 32, 0, "OpenMappedImages");
+                result = result && Compare(images[3].Image(), bgra, 0, true, 32, 0, "OpenMappedImages");
+            }
+            else
+            {
+                TEST_LOG_SS(Error, "OpenMappedImages can't open images!");
+                result = false;
+            }
+            paths.push_back("_test_missing.pgm");
+            std::vector<MappedImage> others(paths.size());
+            if (Simd::OpenMappedImages(paths, others.data(), 3))
+            {
+                TEST_LOG_SS(Error, "OpenMappedImages doesn't report a missing file!");
+                result = false;
+            }
+        }
+
+        if (result)
+        {
+            MappedImage mapped;
+            mapped.Open("_test_mapped.ppm");
+            const View & src = mapped.Image();
+            View dst1(width, height, View::Bgra32), dst2(width, height, View::Bgra32);
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(TEST_PERFORMANCE_TEST("Simd::Base::RgbToBgra");
+                Simd::Base::RgbToBgra(src.data, width, height, src.stride, dst1.data, dst1.stride, 0xFF));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(TEST_PERFORMANCE_TEST("SimdRgbToBgra");
+                SimdRgbToBgra(src.data, width, height, src.stride, dst2.data, dst2.stride, 0xFF));
+            result = result && Compare(dst1, dst2, 0, true, 32);
+        }
+
+        const char * files[] = { "_test_mapped.pgm", "_test_mapped.ppm", "_test_mapped_8.bmp", "_test_mapped_24.bmp", "_test_mapped_24t.bmp",
+            "_test_mapped_32.bmp", "_test_mapped_32t.bmp", "_test_mapped.raw", "_test_truncated.pgm", "_test_truncated.ppm", "_test_truncated.bmp" };
+        for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); ++i)
+            std::remove(files[i]);
+
+        return result;
+    }
+
+    bool MappedImageAutoTest()
+    {
+        bool result = true;
+
+        result = result && ViewLoadSaveAutoTest(W, H);
+        result = result && ViewLoadSaveAutoTest(W + O, H - O);
+
+        result = result && MappedImageAutoTest(W, H);
+        result = result && MappedImageAutoTest(W - O, H + O);
+
+        return result;
+    }
+}
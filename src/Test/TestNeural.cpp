@@ -2698,6 +2698,7 @@ namespace Test
     typedef Simd::Neural::Labels Labels;
     typedef Simd::Neural::VectorI VectorI;
     typedef Simd::Neural::Network Network;
+    typedef Simd::Neural::Layer Layer;
     typedef std::pair<float, float> Error;
 
     struct TrainSample
@@ -2944,6 +2945,22 @@ namespace Test
         Error error = Check(net, sample, 0.5, false);
         TEST_LOG_SS(Info, std::setprecision(6) << "Predict error : (value = " << error.first << " ; count = " << error.second << ")." << std::endl);
 
+        Vectors batch;
+        net.Predict(sample.src, batch);
+        float difference = 0;
+        for (size_t i = 0; i < sample.src.size(); ++i)
+        {
+            const Vector & single = net.Predict(sample.src[i]);
+            for (size_t j = 0; j < single.size(); ++j)
+                difference = std::max(difference, ::fabs(single[j] - batch[i][j]));
+        }
+        TEST_LOG_SS(Info, std::setprecision(6) << "Batch predict difference : " << difference << "." << std::endl);
+        if (difference > EPS)
+        {
+            TEST_LOG_SS(Error, "Batch predict differs from single sample predict!");
+            return false;
+        }
+
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
         TEST_LOG_SS(Info, PerformanceMeasurerStorage::s_storage.TextReport(false, true));
         PerformanceMeasurerStorage::s_storage.Clear();
@@ -2952,6 +2969,62 @@ namespace Test
         return true;
     }
 
+    bool NeuralCompressSpecialTest(Layer::Compression compression, float tolerance)
+    {
+        Network original, compressed;
+        if (!CreateNetwork(original, false, false) || !CreateNetwork(compressed, false, false))
+        {
+            TEST_LOG_SS(Error, "Can't create Simd::Neural::Network!");
+            return false;
+        }
+
+        size_t size = 0;
+        original.Save((void*)NULL, &size);
+        Vector weight(size / sizeof(float));
+        FillRandom(weight.data(), weight.size(), -0.2f, 0.2f);
+        if (!original.Load(weight.data(), size) || !compressed.Load(weight.data(), size))
+        {
+            TEST_LOG_SS(Error, "Can't load Simd::Neural::Network from buffer!");
+            return false;
+        }
+
+        if (!compressed.Compress(compression) || !compressed.Compressed() || compressed.Save(weight.data(), &size))
+        {
+            TEST_LOG_SS(Error, "Can't compress Simd::Neural::Network!");
+            return false;
+        }
+
+        Vectors src(16, Vector(original.InputIndex().Volume())), batch;
+        for (size_t i = 0; i < src.size(); ++i)
+            FillRandom(src[i].data(), src[i].size(), 0.0f, 1.0f);
+        compressed.Predict(src, batch);
+        float difference = 0;
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            Vector control = original.Predict(src[i]);
+            const Vector & single = compressed.Predict(src[i]);
+            for (size_t j = 0; j < single.size(); ++j)
+                difference = std::max(difference, std::max(::fabs(single[j] - control[j]), ::fabs(batch[i][j] - control[j])));
+        }
+        TEST_LOG_SS(Info, std::setprecision(6) << "Compression " << (compression == Layer::CompressionFloat16 ? "FP16" : "INT8") << " predict difference : " << difference << "." << std::endl);
+        if (difference > tolerance)
+        {
+            TEST_LOG_SS(Error, "Compressed network predict differs from original one!");
+            return false;
+        }
+        return true;
+    }
+
+    bool NeuralCompressSpecialTest()
+    {
+        bool result = true;
+
+        result = result && NeuralCompressSpecialTest(Layer::CompressionFloat16, 0.005f);
+        result = result && NeuralCompressSpecialTest(Layer::CompressionInt8, 0.02f);
+
+        return result;
+    }
+
     SIMD_INLINE void Add(const TrainSample & src, size_t index, TrainSample & dst)
     {
         dst.src.push_back(src.src[index]);
@@ -0,0 +1,246 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride);
+            }
+        };
+
+        struct FuncNva
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha);
+
+            FuncPtr func;
+            String description;
+
+            FuncNva(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, 0xFF);
+            }
+        };
+    }
+
+#define FUNC_NV(function) FuncNv(function, #function)
+#define FUNC_NVA(function) FuncNva(function, #function)
+
+    template<class Func> bool NvToAnyAutoTest(int width, int height, View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 255);
+
+        return result;
+    }
+
+    template<class Func> bool NvToAnyAutoTest(View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(W, H, dstType, f1, f2);
+        result = result && NvToAnyAutoTest(W + O * 2, H - O * 2, dstType, f1, f2);
+        result = result && NvToAnyAutoTest(W - O * 2, H + O * 2, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Ssse3::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Base::Nv12ToBgra), FUNC_NVA(SimdNv12ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Sse2::Nv12ToBgra), FUNC_NVA(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Avx2::Nv12ToBgra), FUNC_NVA(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Avx512bw::Nv12ToBgra), FUNC_NVA(SimdNv12ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Base::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Ssse3::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx2::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx512bw::Nv12ToRgb), FUNC_NV(SimdNv12ToRgb));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Ssse3::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Base::Nv21ToBgra), FUNC_NVA(SimdNv21ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Sse2::Nv21ToBgra), FUNC_NVA(SimdNv21ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Avx2::Nv21ToBgra), FUNC_NVA(SimdNv21ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Bgra32, FUNC_NVA(Simd::Avx512bw::Nv21ToBgra), FUNC_NVA(SimdNv21ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Base::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Ssse3::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx2::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Rgb24, FUNC_NV(Simd::Avx512bw::Nv21ToRgb), FUNC_NV(SimdNv21ToRgb));
+#endif 
+
+        return result;
+    }
+}
@@ -76,6 +76,7 @@ namespace Test
         result = result && ReorderAutoTest(W*H, f1, f2);
         result = result && ReorderAutoTest(W*H + O*bytes, f1, f2);
         result = result && ReorderAutoTest(W*H - O*bytes, f1, f2);
+        result = result && ReorderAutoTest(int(StreamSizeMin()) + W*H + O*bytes, f1, f2);
 
         return result;
     }
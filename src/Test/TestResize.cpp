@@ -24,8 +24,10 @@
 #include "Test/TestUtils.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
+#include "Test/TestTensor.h"
 
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdCropAndResize.h"
 
 namespace Test
 {
@@ -365,6 +367,297 @@ namespace Test
             result = result && ResizerAutoTest(FUNC_RS(Simd::Neon::ResizerInit), FUNC_RS(SimdResizerInit));
 #endif 
 
+        result = result && ResizerAutoTest(FUNC_RS(SimdResizerInitShared), FUNC_RS(SimdResizerInit));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool ResizerSharedAutoTest(SimdResizeMethodType method, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t threads)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdResizerInitShared [" << ToString(method) << "-" << channels << "] [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "] in " << threads << " threads.");
+
+        View::Format format = channels == 1 ? View::Gray8 : (channels == 3 ? View::Bgr24 : View::Bgra32);
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        FillRandom(src);
+
+        View control(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        void * resizer = Simd::Base::ResizerInit(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+        uint8_t * buffer = (uint8_t*)SimdAllocate(SimdResizerBufferSize(resizer), SimdAlignment());
+        {
+            TEST_PERFORMANCE_TEST("Simd::Base::ResizerRunBuffered");
+            SimdResizerRunBuffered(resizer, src.data, src.stride, control.data, control.stride, buffer);
+        }
+        SimdFree(buffer);
+        SimdRelease(resizer);
+
+        std::vector<View> dst(threads);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            dst[t].Recreate(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            workers.push_back(std::thread([&src, &dst, t, srcW, srcH, dstW, dstH, channels, method]()
+            {
+                void * shared = SimdResizerInitShared(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+                uint8_t * buffer = (uint8_t*)SimdAllocate(SimdResizerBufferSize(shared), SimdAlignment());
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    TEST_PERFORMANCE_TEST("SimdResizerRunBuffered");
+                    SimdResizerRunBuffered(shared, src.data, src.stride, dst[t].data, dst[t].stride, buffer);
+                }
+                SimdFree(buffer);
+                SimdRelease(shared);
+            }));
+        }
+        for (size_t t = 0; t < threads; ++t)
+            workers[t].join();
+
+        for (size_t t = 0; t < threads && result; ++t)
+            result = result && Compare(control, dst[t], 0, true, 64);
+
+        return result;
+    }
+
+    bool ResizerSharedPlanAutoTest(SimdResizeMethodType method, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdResizerInitShared plan sharing [" << ToString(method) << "-" << channels << "] [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        void * first = SimdResizerInitShared(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+        void * second = SimdResizerInitShared(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+        void * other = SimdResizerInitShared(srcW, srcH, dstW + 1, dstH, channels, SimdResizeChannelByte, method);
+        const Simd::Resizer * plan = ((Simd::ResizerShared*)first)->Shared();
+        if (first == second || plan != ((Simd::ResizerShared*)second)->Shared())
+        {
+            TEST_LOG_SS(Error, "Two contexts with the same parameters do not share one plan!");
+            result = false;
+        }
+        if (plan == ((Simd::ResizerShared*)other)->Shared())
+        {
+            TEST_LOG_SS(Error, "Contexts with different parameters share one plan!");
+            result = false;
+        }
+        SimdRelease(first);
+        SimdRelease(second);
+        SimdRelease(other);
+
+        void * again = SimdResizerInitShared(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+        if (plan != ((Simd::ResizerShared*)again)->Shared())
+        {
+            TEST_LOG_SS(Error, "The plan is not kept in the cache after the release of its contexts!");
+            result = false;
+        }
+        SimdRelease(again);
+
+        return result;
+    }
+
+    bool ResizerSharedAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerSharedPlanAutoTest(SimdResizeMethodBilinear, 3, W, H, W / 3, H / 3);
+        result = result && ResizerSharedPlanAutoTest(SimdResizeMethodArea, 1, W, H, W / 4, H / 4);
+
+        result = result && ResizerSharedAutoTest(SimdResizeMethodBilinear, 1, W, H, W / 3, H / 3, 4);
+        result = result && ResizerSharedAutoTest(SimdResizeMethodBilinear, 3, W, H, W / 2 + O, H / 2 - O, 4);
+        result = result && ResizerSharedAutoTest(SimdResizeMethodArea, 4, W, H, W / 4, H / 4, 4);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCR
+        {
+            typedef void*(*FuncPtr)(size_t srcWidth, size_t srcHeight, size_t channels, SimdResizeChannelType srcType, size_t dstWidth, size_t dstHeight,
+                SimdResizeMethodType method, const float * lower, const float * upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType);
+
+            FuncPtr func;
+            String desc;
+
+            FuncCR(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, SimdTensorFormatType format, SimdTensorDataType tensorType, size_t rois)
+            {
+                desc = desc + "[" + (method == SimdResizeMethodBilinear ? "b" : "a") + "-" + (type == SimdResizeChannelFloat ? "f" : "b") + ToString(channels) + 
+                    ":" + ToString(format) + "-" + ToString((int)tensorType) + "-r" + ToString(rois) + "]";
+            }
+
+            void Call(const View & src, size_t channels, SimdResizeChannelType type, size_t dstW, size_t dstH, SimdResizeMethodType method, const float * lower, const float * upper,
+                SimdTensorFormatType format, SimdTensorDataType tensorType, const float * rois, size_t roiCount, uint8_t * dst) const
+            {
+                void * context = func(src.width / (type == SimdResizeChannelFloat ? channels : 1), src.height, channels, type, dstW, dstH, method, lower, upper, format, tensorType);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdCropAndResizeRun(context, src.data, src.stride, rois, roiCount, dst);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_CR(function) FuncCR(function, #function)
+
+    bool CropAndResizeAutoTest(size_t width, size_t height, size_t channels, SimdResizeChannelType type, size_t dstW, size_t dstH, SimdResizeMethodType method, 
+        SimdTensorFormatType format, SimdTensorDataType tensorType, size_t roiCount, FuncCR f1, FuncCR f2)
+    {
+        bool result = true;
+
+        f1.Update(method, type, channels, format, tensorType, roiCount);
+        f2.Update(method, type, channels, format, tensorType, roiCount);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << "x" << height << "->" << dstW << "x" << dstH << "].");
+
+        View src;
+        if (type == SimdResizeChannelFloat)
+        {
+            src.Recreate(width * channels, height, View::Float);
+            FillRandom32f(src, 0.0f, 255.0f);
+        }
+        else
+        {
+            View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+            src.Recreate(width, height, formats[channels - 1]);
+            FillRandom(src);
+        }
+
+        std::vector<float> rois;
+        for (size_t i = 0; i < roiCount; ++i)
+        {
+            float w = float(width) / (i + 2), h = float(height) / (i + 3), l = i * width / 7.0f - 1.5f, t = i * height / 9.0f + 0.3f;
+            rois.push_back(l);
+            rois.push_back(t);
+            rois.push_back(i % 3 == 2 ? l - w : l + w);
+            rois.push_back(t + h);
+        }
+
+        size_t batch = Simd::Max<size_t>(roiCount, 1);
+        Tensor32f dst1f, dst2f;
+        Tensor8u dst1u, dst2u;
+        uint8_t * dst1, * dst2;
+        if (tensorType == SimdTensorData32f)
+        {
+            dst1f.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst2f.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst1 = (uint8_t*)dst1f.Data(), dst2 = (uint8_t*)dst2f.Data();
+        }
+        else
+        {
+            dst1u.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst2u.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst1 = dst1u.Data(), dst2 = dst2u.Data();
+        }
+
+        float lower[4] = { -0.9f, -1.0f, -1.2f, 0.0f };
+        float upper[4] = { 0.91f, 1.01f, 1.21f, 1.0f };
+        const float * lo = tensorType == SimdTensorData32f ? lower : NULL, * up = tensorType == SimdTensorData32f ? upper : NULL;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, type, dstW, dstH, method, lo, up, format, tensorType, rois.empty() ? NULL : rois.data(), roiCount, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, type, dstW, dstH, method, lo, up, format, tensorType, rois.empty() ? NULL : rois.data(), roiCount, dst2));
+
+        if (tensorType == SimdTensorData32f)
+            result = result && Compare(dst1f, dst2f, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1u, dst2u, 1, true, 64);
+
+        return result;
+    }
+
+    bool CropAndResizeReferenceTest(size_t width, size_t height, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, size_t scale, const FuncCR & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " against SimdResizerRun on cropped image [" << (method == SimdResizeMethodBilinear ? "b" : "a") << "-" 
+            << (type == SimdResizeChannelFloat ? "f" : "b") << channels << "] [" << width << "x" << height << "] with scale " << scale << ".");
+
+        View src;
+        size_t size = type == SimdResizeChannelFloat ? channels : 1;
+        if (type == SimdResizeChannelFloat)
+        {
+            src.Recreate(width * channels, height, View::Float);
+            FillRandom32f(src, 0.0f, 255.0f);
+        }
+        else
+        {
+            View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+            src.Recreate(width, height, formats[channels - 1]);
+            FillRandom(src);
+        }
+
+        // An integer ROI downscaled by an integer factor never samples outside of the crop, so both paths see the same pixels.
+        size_t dstW = width / 2 / scale, dstH = height / 2 / scale, left = width / 5, top = height / 7;
+        size_t right = left + dstW * scale, bottom = top + dstH * scale;
+        float roi[4] = { float(left), float(top), float(right), float(bottom) };
+        View crop = src.Region(left * size, top, right * size, bottom);
+
+        SimdTensorDataType tensorType = type == SimdResizeChannelFloat ? SimdTensorData32f : SimdTensorData8u;
+        View dst(dstW * size, dstH, src.format), ref(dstW * size, dstH, src.format);
+        void * context = f.func(width, height, channels, type, dstW, dstH, method, NULL, NULL, SimdTensorFormatNhwc, tensorType);
+        std::vector<uint8_t> buffer(dst.width * dst.height * dst.PixelSize());
+        SimdCropAndResizeRun(context, src.data, src.stride, roi, 1, buffer.data());
+        SimdRelease(context);
+        Simd::Copy(View(dst.width, dst.height, dst.width * dst.PixelSize(), dst.format, buffer.data()), dst);
+
+        void * resizer = SimdResizerInit(right - left, bottom - top, dstW, dstH, channels, type, method);
+        SimdResizerRun(resizer, crop.data, crop.stride, ref.data, ref.stride);
+        SimdRelease(resizer);
+
+        if (type == SimdResizeChannelFloat)
+            result = result && Compare(dst, ref, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst, ref, 1, true, 64);
+
+        return result;
+    }
+
+    bool CropAndResizeAutoTest(const FuncCR & f1, const FuncCR & f2)
+    {
+        bool result = true;
+
+        SimdResizeMethodType method[2] = { SimdResizeMethodBilinear, SimdResizeMethodArea };
+        SimdTensorFormatType format[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        size_t w = W / 2, h = H / 2;
+
+        for (int m = 0; m < 2; ++m)
+        {
+            for (int f = 0; f < 2; ++f)
+            {
+                result = result && CropAndResizeAutoTest(w, h, 3, SimdResizeChannelByte, 96, 96, method[m], format[f], SimdTensorData32f, 5, f1, f2);
+                result = result && CropAndResizeAutoTest(w, h, 1, SimdResizeChannelByte, 64, 48, method[m], format[f], SimdTensorData8u, 3, f1, f2);
+                result = result && CropAndResizeAutoTest(w, h, 4, SimdResizeChannelFloat, 33, 35, method[m], format[f], SimdTensorData32f, 4, f1, f2);
+            }
+        }
+        result = result && CropAndResizeAutoTest(w + O, h - O, 2, SimdResizeChannelByte, w * 2, h / 3, SimdResizeMethodBilinear, SimdTensorFormatNhwc, SimdTensorData8u, 0, f1, f2);
+        result = result && CropAndResizeAutoTest(w - O, h + O, 3, SimdResizeChannelFloat, w / 5, h / 4, SimdResizeMethodArea, SimdTensorFormatNchw, SimdTensorData32f, 0, f1, f2);
+
+        result = result && CropAndResizeReferenceTest(w, h, 3, SimdResizeChannelByte, SimdResizeMethodBilinear, 2, f1);
+        result = result && CropAndResizeReferenceTest(w + O, h - O, 1, SimdResizeChannelByte, SimdResizeMethodBilinear, 3, f1);
+        result = result && CropAndResizeReferenceTest(w, h, 4, SimdResizeChannelByte, SimdResizeMethodArea, 2, f1);
+        result = result && CropAndResizeReferenceTest(w - O, h + O, 2, SimdResizeChannelByte, SimdResizeMethodArea, 3, f1);
+        result = result && CropAndResizeReferenceTest(w, h, 3, SimdResizeChannelFloat, SimdResizeMethodBilinear, 2, f1);
+
+        return result;
+    }
+
+    bool CropAndResizeAutoTest()
+    {
+        bool result = true;
+
+        result = result && CropAndResizeAutoTest(FUNC_CR(Simd::Base::CropAndResizeInit), FUNC_CR(SimdCropAndResizeInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && CropAndResizeAutoTest(FUNC_CR(Simd::Avx2::CropAndResizeInit), FUNC_CR(SimdCropAndResizeInit));
+#endif 
+
         return result;
     }
 
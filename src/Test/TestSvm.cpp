@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdSvm.h"
+
 namespace Test
 {
     namespace
@@ -120,6 +122,134 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncSK
+        {
+            typedef void*(*FuncPtr)(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType type, float gamma, float coef0, int degree);
+
+            FuncPtr func;
+            String description;
+
+            FuncSK(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            FuncSK(const FuncSK & f, SimdSvmKernelType type) : func(f.func), description(f.description + "[" + ToString(int(type)) + "]") {}
+
+            void Call(const Buffer32f & svs, const Buffer32f & weights, size_t length, size_t count, SimdSvmKernelType type, const Buffer32f & x, size_t batch, Buffer32f & sum) const
+            {
+                void * context = func(svs.data(), weights.data(), length, count, type, 0.5f / length, 0.5f, 3);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdSvmKernelSum(context, x.data(), batch, sum.data());
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_SK(function) FuncSK(function, #function)
+
+    /* Tiles of the batched dot products are summed in a different order by every ISA, so the rounding error
+       of each score grows with the magnitude of its terms, not with the score itself (which may cancel to ~0).
+       The allowed difference of sample j is EPS * sum(|weights[i] * kernel(svs[i], x[j])|). */
+    bool SvmKernelSumCompare(const Buffer32f & svs, const Buffer32f & weights, size_t length, size_t count, SimdSvmKernelType type,
+        const Buffer32f & x, size_t batch, const Buffer32f & s1, const Buffer32f & s2, int differenceCountMax)
+    {
+        double gamma = 0.5 / length, coef0 = 0.5;
+        int degree = 3, errorCount = 0;
+        for (size_t j = 0; j < batch; ++j)
+        {
+            const float * pj = x.data() + j * length;
+            double scale = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float * pi = svs.data() + i * length;
+                double dot = 0, distance = 0;
+                for (size_t k = 0; k < length; ++k)
+                {
+                    dot += double(pi[k]) * pj[k];
+                    distance += Simd::Square(double(pi[k]) - pj[k]);
+                }
+                double kernel = dot;
+                if (type == SimdSvmKernelPolynomial)
+                    kernel = ::pow(gamma * dot + coef0, degree);
+                else if (type == SimdSvmKernelRbf)
+                    kernel = ::exp(-gamma * distance);
+                scale += ::fabs(weights[i] * kernel);
+            }
+            if (::fabs(s1[j] - s2[j]) > EPS * scale)
+            {
+                TEST_LOG_SS(Error, "Error at [" << j << "] : " << s1[j] << " != " << s2[j] << " (allowed difference " << EPS * scale << ")!");
+                if (++errorCount >= differenceCountMax)
+                    return false;
+            }
+        }
+        return errorCount == 0;
+    }
+
+    bool SvmKernelSumAutoTest(size_t length, size_t count, size_t batch, SimdSvmKernelType type, FuncSK f1, FuncSK f2)
+    {
+        bool result = true;
+
+        f1 = FuncSK(f1, type);
+        f2 = FuncSK(f2, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << length << ", " << count << ", " << batch << "].");
+
+        Buffer32f svs(length * count), weights(count), x(length * batch);
+        FillRandom(svs, -1.0f, 1.0f);
+        FillRandom(weights, -1.0f, 1.0f);
+        FillRandom(x, -1.0f, 1.0f);
+
+        Buffer32f s1(batch), s2(batch);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(svs, weights, length, count, type, x, batch, s1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(svs, weights, length, count, type, x, batch, s2));
+
+        result = result && SvmKernelSumCompare(svs, weights, length, count, type, x, batch, s1, s2, 32);
+
+        return result;
+    }
+
+    bool SvmKernelSumAutoTest(const FuncSK & f1, const FuncSK & f2)
+    {
+        bool result = true;
+
+        result = result && SvmKernelSumAutoTest(W / 8, H, W / 4, SimdSvmKernelLinear, f1, f2);
+        result = result && SvmKernelSumAutoTest(W / 8 - 1, H + 1, W / 4 - 3, SimdSvmKernelPolynomial, f1, f2);
+        result = result && SvmKernelSumAutoTest(W / 8, H, W / 4, SimdSvmKernelRbf, f1, f2);
+        result = result && SvmKernelSumAutoTest(W / 8 + 1, H - 3, W / 4 + 1, SimdSvmKernelRbf, f1, f2);
+
+        return result;
+    }
+
+    bool SvmKernelSumAutoTest()
+    {
+        bool result = true;
+
+        result = result && SvmKernelSumAutoTest(FUNC_SK(Simd::Base::SvmKernelInit), FUNC_SK(SimdSvmKernelInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SvmKernelSumAutoTest(FUNC_SK(Simd::Avx2::SvmKernelInit), FUNC_SK(SimdSvmKernelInit));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SvmKernelSumAutoTest(FUNC_SK(Simd::Avx512f::SvmKernelInit), FUNC_SK(SimdSvmKernelInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SvmKernelSumAutoTest(FUNC_SK(Simd::Neon::SvmKernelInit), FUNC_SK(SimdSvmKernelInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool SvmSumLinearDataTest(bool create, size_t length, size_t count, const FuncSL & f)
     {
         bool result = true;
@@ -25,6 +25,7 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 #include "Test/TestTensor.h"
+#include "Simd/SimdSynetPreprocess.h"
 
 namespace Test
 {
@@ -328,6 +329,212 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncSP
+        {
+            typedef void*(*FuncPtr)(size_t srcWidth, size_t srcHeight, SimdSynetSourceFormatType srcFormat, SimdYuvType yuvType, size_t dstWidth, size_t dstHeight,
+                SimdPixelFormatType dstFormat, const float* lower, const float* upper, SimdTensorFormatType tensorFormat, SimdTensorDataType tensorType, SimdBool letterbox, uint8_t padding);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSP(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(SimdSynetSourceFormatType src, View::Format dst, SimdTensorFormatType format, SimdTensorDataType type, SimdBool letterbox, size_t rois)
+            {
+                desc = desc + "[" + ToString((int)src) + "->" + ToString(dst) + ":" + ToString(format) + "-" + ToString((int)type) + 
+                    (letterbox ? "-l" : "") + (rois ? "-r" + ToString(rois) : "") + "]";
+            }
+
+            void Call(size_t width, size_t height, SimdSynetSourceFormatType srcFormat, const uint8_t* const* src, const size_t* stride, 
+                size_t dstW, size_t dstH, View::Format dstFormat, const float* lower, const float* upper, SimdTensorFormatType format, SimdTensorDataType type, 
+                SimdBool letterbox, const ptrdiff_t* rois, size_t roiCount, uint8_t* dst) const
+            {
+                void* context = func(width, height, srcFormat, SimdYuvBt601, dstW, dstH, (SimdPixelFormatType)dstFormat, lower, upper, format, type, letterbox, 127);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdSynetPreprocessRun(context, src, stride, rois, roiCount, dst);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_SP(function) FuncSP(function, #function)
+
+    bool SynetPreprocessAutoTest(size_t width, size_t height, SimdSynetSourceFormatType srcFormat, size_t dstW, size_t dstH, View::Format dstFormat, 
+        SimdTensorFormatType format, SimdTensorDataType type, SimdBool letterbox, size_t roiCount, FuncSP f1, FuncSP f2)
+    {
+        bool result = true;
+
+        f1.Update(srcFormat, dstFormat, format, type, letterbox, roiCount);
+        f2.Update(srcFormat, dstFormat, format, type, letterbox, roiCount);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << "x" << height << "->" << dstW << "x" << dstH << "].");
+
+        View y(width, height, View::Gray8), uv(width / 2, height / 2, View::Uv16), u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        View packed;
+        const uint8_t* src[3] = { NULL, NULL, NULL };
+        size_t stride[3] = { 0, 0, 0 };
+        switch (srcFormat)
+        {
+        case SimdSynetSourceGray8: packed.Recreate(width, height, View::Gray8); break;
+        case SimdSynetSourceBgr24: packed.Recreate(width, height, View::Bgr24); break;
+        case SimdSynetSourceBgra32: packed.Recreate(width, height, View::Bgra32); break;
+        case SimdSynetSourceRgb24: packed.Recreate(width, height, View::Rgb24); break;
+        default: break;
+        }
+        if (packed.data)
+        {
+            FillRandom(packed);
+            src[0] = packed.data, stride[0] = packed.stride;
+        }
+        else
+        {
+            FillRandom(y);
+            src[0] = y.data, stride[0] = y.stride;
+            if (srcFormat == SimdSynetSourceNv12)
+            {
+                FillRandom(uv);
+                src[1] = uv.data, stride[1] = uv.stride;
+            }
+            else
+            {
+                FillRandom(u);
+                FillRandom(v);
+                src[1] = u.data, stride[1] = u.stride;
+                src[2] = v.data, stride[2] = v.stride;
+            }
+        }
+
+        std::vector<ptrdiff_t> rois;
+        for (size_t i = 0; i < roiCount; ++i)
+        {
+            ptrdiff_t w = width / (i + 2), h = height / (i + 2), l = i * width / 8, t = i * height / 10;
+            rois.push_back(l - 1);
+            rois.push_back(t);
+            rois.push_back(l + w);
+            rois.push_back(t + h);
+        }
+
+        size_t channels = dstFormat == View::Gray8 ? 1 : 3, batch = Simd::Max<size_t>(roiCount, 1);
+        Tensor32f dst1f, dst2f;
+        Tensor8u dst1u, dst2u;
+        uint8_t* dst1, * dst2;
+        if (type == SimdTensorData32f)
+        {
+            dst1f.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst2f.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst1 = (uint8_t*)dst1f.Data(), dst2 = (uint8_t*)dst2f.Data();
+        }
+        else
+        {
+            dst1u.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst2u.Reshape(ToShape(batch, channels, dstH, dstW, format), format);
+            dst1 = dst1u.Data(), dst2 = dst2u.Data();
+        }
+
+        float lower[3] = { -0.9f, -1.0f, -1.2f };
+        float upper[3] = { 0.91f, 1.01f, 1.21f };
+        const float* lo = type == SimdTensorData32f ? lower : NULL, * up = type == SimdTensorData32f ? upper : NULL;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(width, height, srcFormat, src, stride, dstW, dstH, dstFormat, lo, up, format, type, letterbox, rois.empty() ? NULL : rois.data(), roiCount, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(width, height, srcFormat, src, stride, dstW, dstH, dstFormat, lo, up, format, type, letterbox, rois.empty() ? NULL : rois.data(), roiCount, dst2));
+
+        if (type == SimdTensorData32f)
+            result = result && Compare(dst1f, dst2f, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1u, dst2u, 1, true, 64);
+
+        return result;
+    }
+
+    bool SynetPreprocessReferenceTest(size_t width, size_t height, size_t dstW, size_t dstH, SimdTensorFormatType format, const FuncSP & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " against Yuv420pToBgrV2 + ResizerRun + SynetSetInput [" << width << "x" << height << "->" << dstW << "x" << dstH << ":" << ToString(format) << "].");
+
+        View y(width, height, View::Gray8), u(width / 2, height / 2, View::Gray8), v(width / 2, height / 2, View::Gray8);
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+        const uint8_t * src[3] = { y.data, u.data, v.data };
+        size_t stride[3] = { (size_t)y.stride, (size_t)u.stride, (size_t)v.stride };
+
+        float lower[3] = { -0.9f, -1.0f, -1.2f };
+        float upper[3] = { 0.91f, 1.01f, 1.21f };
+
+        Tensor32f dst(ToShape(1, 3, dstH, dstW, format), format), ref(ToShape(1, 3, dstH, dstW, format), format);
+        void * context = f.func(width, height, SimdSynetSourceYuv420p, SimdYuvBt601, dstW, dstH, SimdPixelFormatBgr24, lower, upper, format, SimdTensorData32f, SimdFalse, 0);
+        SimdSynetPreprocessRun(context, src, stride, NULL, 0, (uint8_t*)dst.Data());
+        SimdRelease(context);
+
+        View bgr(width, height, View::Bgr24), resized(dstW, dstH, View::Bgr24);
+        SimdYuv420pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, bgr.data, bgr.stride, SimdYuvBt601);
+        void * resizer = SimdResizerInit(width, height, dstW, dstH, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdResizerRun(resizer, bgr.data, bgr.stride, resized.data, resized.stride);
+        SimdRelease(resizer);
+        SimdSynetSetInput(resized.data, dstW, dstH, resized.stride, SimdPixelFormatBgr24, lower, upper, ref.Data(), 3, format);
+
+        // The three-pass pipeline rounds the resized image to 8 bits, so allow a bit more than one 8-bit step.
+        result = result && Compare(dst, ref, 1.5f * (upper[2] - lower[2]) / 255.0f, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetPreprocessAutoTest(const FuncSP& f1, const FuncSP& f2)
+    {
+        bool result = true;
+
+        SimdSynetSourceFormatType srcFormat[6] = { SimdSynetSourceGray8, SimdSynetSourceBgr24, SimdSynetSourceBgra32, SimdSynetSourceRgb24, SimdSynetSourceNv12, SimdSynetSourceYuv420p };
+        View::Format dstFormat[3] = { View::Gray8, View::Bgr24, View::Rgb24 };
+        SimdTensorFormatType format[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        size_t w = (W / 2) & ~1, h = (H / 2) & ~1;
+
+        for (int s = 0; s < 6; ++s)
+        {
+            for (int d = 0; d < 3; ++d)
+            {
+                for (int f = 0; f < 2; ++f)
+                {
+                    result = result && SynetPreprocessAutoTest(w, h, srcFormat[s], 160, 120, dstFormat[d], format[f], SimdTensorData32f, SimdFalse, 0, f1, f2);
+                    result = result && SynetPreprocessAutoTest(w + 2, h - 2, srcFormat[s], 96, 96, dstFormat[d], format[f], SimdTensorData8u, SimdTrue, 3, f1, f2);
+                }
+            }
+        }
+        result = result && SynetPreprocessAutoTest(w, h, SimdSynetSourceNv12, 128, 128, View::Rgb24, SimdTensorFormatNchw, SimdTensorData32f, SimdTrue, 2, f1, f2);
+        result = result && SynetPreprocessAutoTest(w, h, SimdSynetSourceBgra32, w * 2, h + O, View::Bgr24, SimdTensorFormatNhwc, SimdTensorData32f, SimdFalse, 0, f1, f2);
+
+        // The 8-bit resizer quantizes interpolation weights to 1/16, so the reference uses 2:1 scales where they are exact.
+        size_t sw = Simd::AlignLo(w / 2, 2), sh = Simd::AlignLo(h / 2, 2);
+        for (int f = 0; f < 2; ++f)
+        {
+            result = result && SynetPreprocessReferenceTest(sw * 2, sh * 2, sw, sh, format[f], f1);
+            result = result && SynetPreprocessReferenceTest(sw, sh, sw * 2, sh * 2, format[f], f1);
+        }
+
+        return result;
+    }
+
+    bool SynetPreprocessAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPreprocessAutoTest(FUNC_SP(Simd::Base::SynetPreprocessInit), FUNC_SP(SimdSynetPreprocessInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetPreprocessAutoTest(FUNC_SP(Simd::Avx2::SynetPreprocessInit), FUNC_SP(SimdSynetPreprocessInit));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncRT
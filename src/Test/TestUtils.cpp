@@ -26,6 +26,7 @@
 #include "Simd/SimdDrawing.hpp"
 #include "Simd/SimdFont.hpp"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdStream.h"
 
 #ifdef WIN32
 #define NOMINMAX
@@ -40,6 +41,11 @@
 
 namespace Test
 {
+    size_t StreamSizeMin()
+    {
+        return Simd::Max<size_t>(Simd::STREAM_SIZE_MIN, SimdCpuInfo(SimdCpuInfoCacheL3) / 2);
+    }
+
     void FillSequence(View & view)
     {
         for (size_t i = 0, n = view.DataSize(); i < n; ++i)
@@ -97,6 +103,35 @@ namespace Test
         }
     }
 
+    void FillKnownColors(SimdYuvType yuvType, int dx, int dy, View & bgr, View & y, View & u, View & v)
+    {
+        static const uint8_t colors[8][3] = { { 0, 0, 0 }, { 255, 255, 255 }, { 255, 0, 0 }, { 0, 255, 0 },
+            { 0, 0, 255 }, { 0, 255, 255 }, { 255, 255, 0 }, { 255, 0, 255 } };
+        double kr = 0.299, kb = 0.114;
+        if (yuvType == SimdYuvBt709 || yuvType == SimdYuvBt709Full)
+            kr = 0.2126, kb = 0.0722;
+        if (yuvType == SimdYuvBt2020 || yuvType == SimdYuvBt2020Full)
+            kr = 0.2627, kb = 0.0593;
+        bool full = yuvType == SimdYuvBt601Full || yuvType == SimdYuvBt709Full || yuvType == SimdYuvBt2020Full;
+        size_t stripe = bgr.width / 8;
+        assert(stripe % dx == 0 && bgr.height % dy == 0);
+        for (size_t row = 0; row < bgr.height; ++row)
+        {
+            for (size_t col = 0; col < bgr.width; ++col)
+            {
+                const uint8_t * c = colors[Simd::Min<size_t>(col / stripe, 7)];
+                double b = c[0] / 255.0, g = c[1] / 255.0, r = c[2] / 255.0;
+                double l = kr * r + (1.0 - kr - kb) * g + kb * b;
+                double cb = (b - l) / (2.0 * (1.0 - kb)), cr = (r - l) / (2.0 * (1.0 - kr));
+                for (size_t i = 0; i < 3; ++i)
+                    bgr.data[row * bgr.stride + col * 3 + i] = c[i];
+                y.At<uint8_t>(col, row) = (uint8_t)Simd::RestrictRange<int>(Simd::Round(full ? 255.0 * l : 16.0 + 219.0 * l), 0, 255);
+                u.At<uint8_t>(col / dx, row / dy) = (uint8_t)Simd::RestrictRange<int>(Simd::Round(128.0 + (full ? 255.0 : 224.0) * cb), 0, 255);
+                v.At<uint8_t>(col / dx, row / dy) = (uint8_t)Simd::RestrictRange<int>(Simd::Round(128.0 + (full ? 255.0 : 224.0) * cr), 0, 255);
+            }
+        }
+    }
+
     uint8_t g_rand8u[UINT16_MAX];
     bool InitRand8u()
     {
@@ -31,6 +31,8 @@ namespace Test
     void FillSequence(View & view);
     void FillPicture(View & view, uint64_t flag = 0x000000000000000F);
 
+    void FillKnownColors(SimdYuvType yuvType, int dx, int dy, View & bgr, View & y, View & u, View & v);
+
     SIMD_INLINE int Random(int range)
     {
         return ((::rand()&INT16_MAX)*range) / INT16_MAX;
@@ -41,6 +43,8 @@ namespace Test
         return ((::rand()&INT16_MAX)*1.0) / INT16_MAX;
     }
 
+    size_t StreamSizeMin();
+
     template<class T> inline void Fill(T * data, size_t size, T value)
     {
         for (size_t i = 0; i < size; ++i)
@@ -0,0 +1,396 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncU16
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride, size_t bitDepth, SimdDepthReductionType reduction);
+
+            FuncPtr func;
+            String description;
+
+            FuncU16(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t bitDepth, SimdDepthReductionType reduction)
+            {
+                description = description + "[" + ToString(bitDepth) + (reduction == SimdDepthReductionDither ? "-D]" : "-R]");
+            }
+
+            void Call(const View & src, View & dst, size_t bitDepth, SimdDepthReductionType reduction) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, dst.data, dst.stride, bitDepth, reduction);
+            }
+        };
+    }
+
+#define FUNC_U16(function) FuncU16(function, #function)
+
+    bool Uint16ToGrayAutoTest(int width, int height, size_t bitDepth, SimdDepthReductionType reduction, FuncU16 f1, FuncU16 f2)
+    {
+        bool result = true;
+
+        f1.Update(bitDepth, reduction);
+        f2.Update(bitDepth, reduction);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, bitDepth, reduction));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, bitDepth, reduction));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Uint16ToGrayAutoTest(const FuncU16 & f1, const FuncU16 & f2)
+    {
+        bool result = true;
+
+        for (size_t bitDepth = 10; bitDepth <= 16; bitDepth += 6)
+        {
+            for (int r = SimdDepthReductionRound; r <= SimdDepthReductionDither; ++r)
+            {
+                SimdDepthReductionType reduction = (SimdDepthReductionType)r;
+                result = result && Uint16ToGrayAutoTest(W, H, bitDepth, reduction, f1, f2);
+                result = result && Uint16ToGrayAutoTest(W + O, H - O, bitDepth, reduction, f1, f2);
+                result = result && Uint16ToGrayAutoTest(W - O, H + O, bitDepth, reduction, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool Uint16ToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && Uint16ToGrayAutoTest(FUNC_U16(Simd::Base::Uint16ToGray), FUNC_U16(SimdUint16ToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && Uint16ToGrayAutoTest(FUNC_U16(Simd::Sse2::Uint16ToGray), FUNC_U16(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Uint16ToGrayAutoTest(FUNC_U16(Simd::Avx2::Uint16ToGray), FUNC_U16(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Uint16ToGrayAutoTest(FUNC_U16(Simd::Avx512bw::Uint16ToGray), FUNC_U16(SimdUint16ToGray));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYuv16
+        {
+            typedef void(*FuncYuvPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+                uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, size_t bitDepth, SimdDepthReductionType reduction);
+            typedef void(*FuncBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, size_t bitDepth, SimdDepthReductionType reduction);
+
+            FuncYuvPtr funcYuv;
+            FuncBgraPtr funcBgra;
+            String description;
+
+            FuncYuv16(const FuncYuvPtr & f, const String & d) : funcYuv(f), funcBgra(NULL), description(d) {}
+            FuncYuv16(const FuncBgraPtr & f, const String & d) : funcYuv(NULL), funcBgra(f), description(d) {}
+
+            void Update(SimdDepthReductionType reduction)
+            {
+                description = description + (reduction == SimdDepthReductionDither ? "[D]" : "[R]");
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dy, View & du, View & dv, View & bgra, SimdDepthReductionType reduction) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcYuv)
+                    funcYuv(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height,
+                        dy.data, dy.stride, du.data, du.stride, dv.data, dv.stride, 10, reduction);
+                else
+                    funcBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height,
+                        bgra.data, bgra.stride, 0xFF, SimdYuvBt709, 10, reduction);
+            }
+        };
+
+        struct FuncP010
+        {
+            typedef void(*FuncYuvPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                uint8_t * dy, size_t dyStride, uint8_t * du, size_t duStride, uint8_t * dv, size_t dvStride, SimdDepthReductionType reduction);
+            typedef void(*FuncBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType, SimdDepthReductionType reduction);
+
+            FuncYuvPtr funcYuv;
+            FuncBgraPtr funcBgra;
+            String description;
+
+            FuncP010(const FuncYuvPtr & f, const String & d) : funcYuv(f), funcBgra(NULL), description(d) {}
+            FuncP010(const FuncBgraPtr & f, const String & d) : funcYuv(NULL), funcBgra(f), description(d) {}
+
+            void Update(SimdDepthReductionType reduction)
+            {
+                description = description + (reduction == SimdDepthReductionDither ? "[D]" : "[R]");
+            }
+
+            void Call(const View & y, const View & uv, View & dy, View & du, View & dv, View & bgra, SimdDepthReductionType reduction) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcYuv)
+                    funcYuv(y.data, y.stride, uv.data, uv.stride, y.width, y.height,
+                        dy.data, dy.stride, du.data, du.stride, dv.data, dv.stride, reduction);
+                else
+                    funcBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height,
+                        bgra.data, bgra.stride, 0xFF, SimdYuvBt709, reduction);
+            }
+        };
+    }
+
+#define FUNC_YUV16(function) FuncYuv16(function, #function)
+#define FUNC_P010(function) FuncP010(function, #function)
+
+    bool Yuv16ToAnyAutoTest(int width, int height, SimdDepthReductionType reduction, FuncYuv16 f1, FuncYuv16 f2)
+    {
+        bool result = true;
+
+        f1.Update(reduction);
+        f2.Update(reduction);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(u);
+        View v(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(v);
+
+        View dy1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View du1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dv1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View dy2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View du2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dv2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dy1, du1, dv1, bgra1, reduction));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dy2, du2, dv2, bgra2, reduction));
+
+        if (f1.funcYuv)
+        {
+            result = result && Compare(dy1, dy2, 0, true, 64, 0, "y");
+            result = result && Compare(du1, du2, 0, true, 64, 0, "u");
+            result = result && Compare(dv1, dv2, 0, true, 64, 0, "v");
+        }
+        else
+            result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuv16ToAnyAutoTest(const FuncYuv16 & f1, const FuncYuv16 & f2)
+    {
+        bool result = true;
+
+        for (int r = SimdDepthReductionRound; r <= SimdDepthReductionDither; ++r)
+        {
+            SimdDepthReductionType reduction = (SimdDepthReductionType)r;
+            result = result && Yuv16ToAnyAutoTest(W, H, reduction, f1, f2);
+            result = result && Yuv16ToAnyAutoTest(W + O * 2, H - O * 2, reduction, f1, f2);
+            result = result && Yuv16ToAnyAutoTest(W - O * 2, H + O * 2, reduction, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Yuv420p16ToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Base::Yuv420p16ToYuv420p), FUNC_YUV16(SimdYuv420p16ToYuv420p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Sse2::Yuv420p16ToYuv420p), FUNC_YUV16(SimdYuv420p16ToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Avx2::Yuv420p16ToYuv420p), FUNC_YUV16(SimdYuv420p16ToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Avx512bw::Yuv420p16ToYuv420p), FUNC_YUV16(SimdYuv420p16ToYuv420p));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Base::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Sse2::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Avx2::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(FUNC_YUV16(Simd::Avx512bw::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool P010ToAnyAutoTest(int width, int height, SimdDepthReductionType reduction, FuncP010 f1, FuncP010 f2)
+    {
+        bool result = true;
+
+        f1.Update(reduction);
+        f2.Update(reduction);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Int32, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dy1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View du1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dv1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View dy2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View du2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dv2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dy1, du1, dv1, bgra1, reduction));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dy2, du2, dv2, bgra2, reduction));
+
+        if (f1.funcYuv)
+        {
+            result = result && Compare(dy1, dy2, 0, true, 64, 0, "y");
+            result = result && Compare(du1, du2, 0, true, 64, 0, "u");
+            result = result && Compare(dv1, dv2, 0, true, 64, 0, "v");
+        }
+        else
+            result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        return result;
+    }
+
+    bool P010ToAnyAutoTest(const FuncP010 & f1, const FuncP010 & f2)
+    {
+        bool result = true;
+
+        for (int r = SimdDepthReductionRound; r <= SimdDepthReductionDither; ++r)
+        {
+            SimdDepthReductionType reduction = (SimdDepthReductionType)r;
+            result = result && P010ToAnyAutoTest(W, H, reduction, f1, f2);
+            result = result && P010ToAnyAutoTest(W + O * 2, H - O * 2, reduction, f1, f2);
+            result = result && P010ToAnyAutoTest(W - O * 2, H + O * 2, reduction, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool P010ToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Base::P010ToYuv420p), FUNC_P010(SimdP010ToYuv420p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Sse2::P010ToYuv420p), FUNC_P010(SimdP010ToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Avx2::P010ToYuv420p), FUNC_P010(SimdP010ToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Avx512bw::P010ToYuv420p), FUNC_P010(SimdP010ToYuv420p));
+#endif 
+
+        return result;
+    }
+
+    bool P010ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Base::P010ToBgra), FUNC_P010(SimdP010ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Sse2::P010ToBgra), FUNC_P010(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Avx2::P010ToBgra), FUNC_P010(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToAnyAutoTest(FUNC_P010(Simd::Avx512bw::P010ToBgra), FUNC_P010(SimdP010ToBgra));
+#endif 
+
+        return result;
+    }
+}
@@ -33,21 +33,30 @@ namespace Test
         {
             typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                 size_t width, size_t height, uint8_t * dst, size_t dstStride);
+            typedef void(*FuncV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
 
             FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
             String description;
 
-            Func(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            Func(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvUnknown), description(d) {}
+            Func(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "[" + ToString(t) + "]") {}
 
             void Call(const View & y, const View & u, const View & v, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
-                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride);
+                if (funcV2)
+                    funcV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride);
             }
         };
     }
 
 #define FUNC(function) Func(function, #function)
+#define FUNC_V2(function, type) Func(function, #function, type)
 
     bool YuvToAnyAutoTest(int width, int height, int dx, int dy, View::Format dstType, const Func & f1, const Func & f2, int maxDifference)
     {
@@ -88,6 +97,25 @@ namespace Test
         return result;
     }
 
+    bool YuvToBgrKnownColorTest(int dx, int dy, const Func & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " for known colors.");
+
+        const int width = 128, height = 2;
+        View bgr(width, height, View::Bgr24), y(width, height, View::Gray8);
+        View u(width / dx, height / dy, View::Gray8), v(width / dx, height / dy, View::Gray8);
+        FillKnownColors(f.yuvType, dx, dy, bgr, y, u, v);
+
+        View dst(width, height, View::Bgr24);
+        f.funcV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, dst.data, dst.stride, f.yuvType);
+
+        result = result && Compare(bgr, dst, 2, true, 32);
+
+        return result;
+    }
+
     bool Yuv444pToBgrAutoTest()
     {
         bool result = true;
@@ -122,6 +150,37 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Base::Yuv444pToBgrV2, type), FUNC_V2(SimdYuv444pToBgrV2, type));
+            result = result && YuvToBgrKnownColorTest(1, 1, FUNC_V2(Simd::Base::Yuv444pToBgrV2, type));
+            result = result && YuvToBgrKnownColorTest(1, 1, FUNC_V2(SimdYuv444pToBgrV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv444pToBgrV2, type), FUNC_V2(SimdYuv444pToBgrV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv444pToBgrV2, type), FUNC_V2(SimdYuv444pToBgrV2, type));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv444pToBgrV2, type), FUNC_V2(SimdYuv444pToBgrV2, type));
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv422pToBgrAutoTest()
     {
         bool result = true;
@@ -156,6 +215,37 @@ namespace Test
         return result;
     }
 
+    bool Yuv422pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Base::Yuv422pToBgrV2, type), FUNC_V2(SimdYuv422pToBgrV2, type));
+            result = result && YuvToBgrKnownColorTest(2, 1, FUNC_V2(Simd::Base::Yuv422pToBgrV2, type));
+            result = result && YuvToBgrKnownColorTest(2, 1, FUNC_V2(SimdYuv422pToBgrV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv422pToBgrV2, type), FUNC_V2(SimdYuv422pToBgrV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv422pToBgrV2, type), FUNC_V2(SimdYuv422pToBgrV2, type));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv422pToBgrV2, type), FUNC_V2(SimdYuv422pToBgrV2, type));
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv420pToBgrAutoTest()
     {
         bool result = true;
@@ -190,6 +280,37 @@ namespace Test
         return result;
     }
 
+    bool Yuv420pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Base::Yuv420pToBgrV2, type), FUNC_V2(SimdYuv420pToBgrV2, type));
+            result = result && YuvToBgrKnownColorTest(2, 2, FUNC_V2(Simd::Base::Yuv420pToBgrV2, type));
+            result = result && YuvToBgrKnownColorTest(2, 2, FUNC_V2(SimdYuv420pToBgrV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv420pToBgrV2, type), FUNC_V2(SimdYuv420pToBgrV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv420pToBgrV2, type), FUNC_V2(SimdYuv420pToBgrV2, type));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv420pToBgrV2, type), FUNC_V2(SimdYuv420pToBgrV2, type));
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv444pToHslAutoTest()
     {
         bool result = true;
@@ -311,6 +432,35 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Base::Yuv444pToRgbV2, type), FUNC_V2(SimdYuv444pToRgbV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Ssse3::Yuv444pToRgbV2, type), FUNC_V2(SimdYuv444pToRgbV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Avx2::Yuv444pToRgbV2, type), FUNC_V2(SimdYuv444pToRgbV2, type));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Avx512bw::Yuv444pToRgbV2, type), FUNC_V2(SimdYuv444pToRgbV2, type));
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv422pToRgbAutoTest()
     {
         bool result = true;
@@ -340,6 +490,35 @@ namespace Test
         return result;
     }
 
+    bool Yuv422pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Base::Yuv422pToRgbV2, type), FUNC_V2(SimdYuv422pToRgbV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Ssse3::Yuv422pToRgbV2, type), FUNC_V2(SimdYuv422pToRgbV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Avx2::Yuv422pToRgbV2, type), FUNC_V2(SimdYuv422pToRgbV2, type));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Avx512bw::Yuv422pToRgbV2, type), FUNC_V2(SimdYuv422pToRgbV2, type));
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv420pToRgbAutoTest()
     {
         bool result = true;
@@ -369,6 +548,35 @@ namespace Test
         return result;
     }
 
+    bool Yuv420pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Base::Yuv420pToRgbV2, type), FUNC_V2(SimdYuv420pToRgbV2, type));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Ssse3::Yuv420pToRgbV2, type), FUNC_V2(SimdYuv420pToRgbV2, type));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Avx2::Yuv420pToRgbV2, type), FUNC_V2(SimdYuv420pToRgbV2, type));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Avx512bw::Yuv420pToRgbV2, type), FUNC_V2(SimdYuv420pToRgbV2, type));
+#endif 
+        }
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool YuvToAnyDataTest(bool create, int width, int height, int dx, int dy, View::Format dstType, const Func & f, int maxDifference = 0)
@@ -124,21 +124,30 @@ namespace Test
         {
             typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            typedef void(*FuncV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
             FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
             String description;
 
-            FuncYuv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            FuncYuv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvUnknown), description(d) {}
+            FuncYuv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "[" + ToString(t) + "]") {}
 
             void Call(const View & y, const View & u, const View & v, View & bgra) const
             {
                 TEST_PERFORMANCE_TEST(description);
-                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
+                if (funcV2)
+                    funcV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF, yuvType);
+                else
+                    func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
             }
         };
     }
 
 #define FUNC_YUV(function) FuncYuv(function, #function)
+#define FUNC_YUV_V2(function, type) FuncYuv(function, #function, type)
 
     bool YuvToBgraAutoTest(int width, int height, const FuncYuv & f1, const FuncYuv & f2, int dx, int dy)
     {
@@ -213,6 +222,35 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Base::Yuv444pToBgraV2, type), FUNC_YUV_V2(SimdYuv444pToBgraV2, type), 1, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv444pToBgraV2, type), FUNC_YUV_V2(SimdYuv444pToBgraV2, type), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgraV2, type), FUNC_YUV_V2(SimdYuv444pToBgraV2, type), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgraV2, type), FUNC_YUV_V2(SimdYuv444pToBgraV2, type), 1, 1);
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv422pToBgraAutoTest()
     {
         bool result = true;
@@ -247,6 +285,35 @@ namespace Test
         return result;
     }
 
+    bool Yuv422pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Base::Yuv422pToBgraV2, type), FUNC_YUV_V2(SimdYuv422pToBgraV2, type), 2, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv422pToBgraV2, type), FUNC_YUV_V2(SimdYuv422pToBgraV2, type), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgraV2, type), FUNC_YUV_V2(SimdYuv422pToBgraV2, type), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgraV2, type), FUNC_YUV_V2(SimdYuv422pToBgraV2, type), 2, 1);
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv420pToBgraAutoTest()
     {
         bool result = true;
@@ -281,6 +348,35 @@ namespace Test
         return result;
     }
 
+    bool Yuv420pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int t = SimdYuvBt601; t <= SimdYuvBt2020Full; ++t)
+        {
+            SimdYuvType type = (SimdYuvType)t;
+
+            result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Base::Yuv420pToBgraV2, type), FUNC_YUV_V2(SimdYuv420pToBgraV2, type), 2, 2);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv420pToBgraV2, type), FUNC_YUV_V2(SimdYuv420pToBgraV2, type), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgraV2, type), FUNC_YUV_V2(SimdYuv420pToBgraV2, type), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgraV2, type), FUNC_YUV_V2(SimdYuv420pToBgraV2, type), 2, 2);
+#endif 
+        }
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool YuvToBgraDataTest(bool create, int width, int height, const FuncYuv & f, int dx, int dy)